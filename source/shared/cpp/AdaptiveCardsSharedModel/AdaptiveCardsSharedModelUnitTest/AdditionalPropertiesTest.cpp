@@ -3,6 +3,12 @@
 #include "stdafx.h"
 #include "ParseUtil.h"
 #include "TextRun.h"
+#include "Container.h"
+#include "Image.h"
+#include "TextBlock.h"
+#include "TextInput.h"
+
+#include <chrono>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace AdaptiveCards;
@@ -209,5 +215,104 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::AreEqual("{\"actions\":[],\"body\":[{\"text\":\"Standard textblock\",\"type\":\"TextBlock\"},{\"property\":\"value\",\"someOtherProperty\":\"some other value\",\"type\":\"SomeRandomType\"}],\"type\":\"AdaptiveCard\",\"version\":\"1.0\"}\n"s,
                 outputCard);
         }
+
+        TEST_METHOD(KnownPropertiesAreSharedPerTypeTest)
+        {
+            Container firstContainer;
+            Container secondContainer;
+            TextBlock textBlock;
+
+            // every instance of a type points at the same table
+            Assert::IsTrue(&firstContainer.GetKnownProperties() == &secondContainer.GetKnownProperties());
+            Assert::IsFalse(&firstContainer.GetKnownProperties() == &textBlock.GetKnownProperties());
+
+            // each table still carries the properties of every base type
+            const auto& containerProperties = firstContainer.GetKnownProperties();
+            for (const auto& property : {"id", "type", "spacing", "separator", "items", "bleed"})
+            {
+                Assert::IsTrue(containerProperties.count(property) == 1);
+            }
+            Assert::IsTrue(containerProperties.count("text") == 0);
+
+            const auto& textBlockProperties = textBlock.GetKnownProperties();
+            for (const auto& property : {"id", "isVisible", "text", "color", "wrap", "maxLines"})
+            {
+                Assert::IsTrue(textBlockProperties.count(property) == 1);
+            }
+            Assert::IsTrue(textBlockProperties.count("items") == 0);
+        }
+
+        TEST_METHOD(KnownPropertiesBenchmark)
+        {
+            constexpr int iterations = 50;
+            constexpr int elementCount = 2000;
+            Json::Value card;
+            card["type"] = "AdaptiveCard";
+            card["version"] = "1.5";
+            for (int i = 0; i < elementCount / 4; ++i)
+            {
+                Json::Value textBlock;
+                textBlock["type"] = "TextBlock";
+                textBlock["text"] = "Hello";
+                card["body"].append(textBlock);
+
+                Json::Value image;
+                image["type"] = "Image";
+                image["url"] = "https://adaptivecards.io/content/cats/1.png";
+                card["body"].append(image);
+
+                Json::Value input;
+                input["type"] = "Input.Text";
+                input["id"] = "input" + std::to_string(i);
+                card["body"].append(input);
+
+                Json::Value container;
+                container["type"] = "Container";
+                container["items"] = Json::Value(Json::arrayValue);
+                card["body"].append(container);
+            }
+
+            const auto toMicroseconds = [](std::chrono::steady_clock::duration time) {
+                return std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(time).count() / iterations) +
+                       "us";
+            };
+
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; ++i)
+            {
+                for (int j = 0; j < elementCount / 4; ++j)
+                {
+                    std::make_shared<TextBlock>();
+                    std::make_shared<Image>();
+                    std::make_shared<TextInput>();
+                    std::make_shared<Container>();
+                }
+            }
+            const auto constructTime = std::chrono::steady_clock::now() - start;
+
+            std::shared_ptr<AdaptiveCard> parsedCard;
+            start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; ++i)
+            {
+                ParseContext context;
+                parsedCard = AdaptiveCard::Deserialize(card, "1.5", context)->GetAdaptiveCard();
+            }
+            const auto parseTime = std::chrono::steady_clock::now() - start;
+
+            // parsed elements point at the same table as any other instance of their type, rather than holding a copy
+            const auto& body = parsedCard->GetBody();
+            Assert::AreEqual(static_cast<size_t>(elementCount), body.size());
+            Assert::IsTrue(&body[0]->GetKnownProperties() == &TextBlock().GetKnownProperties());
+            Assert::IsTrue(&body[1]->GetKnownProperties() == &Image().GetKnownProperties());
+            Assert::IsTrue(&body[2]->GetKnownProperties() == &TextInput().GetKnownProperties());
+            Assert::IsTrue(&body[3]->GetKnownProperties() == &Container().GetKnownProperties());
+
+            Logger::WriteMessage((std::to_string(elementCount) + " elements: construct " + toMicroseconds(constructTime) +
+                                  ", parse " + toMicroseconds(parseTime) + "; sizeof TextBlock " +
+                                  std::to_string(sizeof(TextBlock)) + ", Image " + std::to_string(sizeof(Image)) +
+                                  ", Input.Text " + std::to_string(sizeof(TextInput)) + ", Container " +
+                                  std::to_string(sizeof(Container)))
+                                     .c_str());
+        }
     };
 }
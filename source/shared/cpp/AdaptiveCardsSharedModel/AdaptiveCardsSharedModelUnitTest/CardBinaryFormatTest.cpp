@@ -0,0 +1,188 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "CardBinaryFormat.h"
+#include "Container.h"
+#include "ParseContext.h"
+#include "SharedAdaptiveCard.h"
+#include "TextBlock.h"
+#include "UnknownElement.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    std::shared_ptr<AdaptiveCard> BinaryRoundTrip(const AdaptiveCard& card)
+    {
+        return AdaptiveCard::DeserializeFromBinary(card.SerializeToBinary())->GetAdaptiveCard();
+    }
+
+    TEST_CLASS(CardBinaryFormatTest)
+    {
+    public:
+        TEST_METHOD(RoundTripTest)
+        {
+            const std::string cardJson = R"({
+                "type": "AdaptiveCard",
+                "version": "1.5",
+                "lang": "de",
+                "rtl": true,
+                "minHeight": "50px",
+                "backgroundImage": { "url": "https://adaptivecards.io/bg.png", "fillMode": "repeat" },
+                "refresh": { "action": { "type": "Action.Execute", "verb": "refresh" }, "userIds": [ "a", "b" ] },
+                "customCardProperty": { "list": [ 1, -2, 3.5, true, null, "x" ] },
+                "body": [
+                    { "type": "TextBlock", "id": "text", "text": "Hello", "size": "large", "isSubtle": false, "maxLines": 2, "wrap": true },
+                    {
+                        "type": "Container",
+                        "style": "emphasis",
+                        "bleed": true,
+                        "selectAction": { "type": "Action.OpenUrl", "url": "https://adaptivecards.io" },
+                        "items": [
+                            {
+                                "type": "ColumnSet",
+                                "columns": [
+                                    { "type": "Column", "width": "50px", "items": [ { "type": "Image", "url": "https://adaptivecards.io/a.png", "width": "20px" } ] },
+                                    { "type": "Column", "width": "stretch", "style": "good", "bleed": true }
+                                ]
+                            }
+                        ]
+                    },
+                    { "type": "FactSet", "facts": [ { "title": "Key", "value": "Value" } ] },
+                    { "type": "RichTextBlock", "inlines": [ "plain", { "type": "TextRun", "text": "run", "italic": true, "highlight": true } ] },
+                    { "type": "Input.Number", "id": "number", "value": 2.5, "max": 10, "label": "Number", "isRequired": true, "errorMessage": "Required" },
+                    { "type": "Input.ChoiceSet", "id": "choice", "isMultiSelect": true, "choices": [ { "title": "One", "value": "1" } ] },
+                    {
+                        "type": "Table",
+                        "columns": [ { "width": 1 }, { "width": "30px" } ],
+                        "rows": [ { "type": "TableRow", "cells": [ { "type": "TableCell", "items": [ { "type": "TextBlock", "text": "Cell" } ] } ] } ]
+                    },
+                    { "type": "Media", "poster": "https://adaptivecards.io/poster.png", "sources": [ { "mimeType": "video/mp4", "url": "https://adaptivecards.io/video.mp4" } ] },
+                    { "type": "TextBlock", "text": "Fallback", "fallback": { "type": "TextBlock", "text": "Fell back" }, "requires": { "feature": "1.2" } }
+                ],
+                "actions": [
+                    { "type": "Action.Submit", "title": "Submit", "data": { "key": "value" }, "associatedInputs": "none" },
+                    { "type": "Action.ToggleVisibility", "targetElements": [ "text", { "elementId": "number", "isVisible": false } ] },
+                    {
+                        "type": "Action.ShowCard",
+                        "card": { "type": "AdaptiveCard", "body": [ { "type": "Input.Text", "id": "comment", "isMultiline": true } ] }
+                    }
+                ]
+            })";
+
+            auto card = AdaptiveCard::DeserializeFromString(cardJson, "1.5")->GetAdaptiveCard();
+            const auto binary = card->SerializeToBinary();
+            Assert::IsTrue(binary.size() < cardJson.size());
+
+            auto roundTripped = AdaptiveCard::DeserializeFromBinary(binary)->GetAdaptiveCard();
+            Assert::AreEqual(card->Serialize(), roundTripped->Serialize());
+            Assert::IsTrue(roundTripped->GetElementById("number") != nullptr);
+        }
+
+        TEST_METHOD(RuntimeStateTest)
+        {
+            const std::string cardJson = R"({
+                "type": "AdaptiveCard",
+                "version": "1.5",
+                "lang": "fr",
+                "body": [
+                    {
+                        "type": "Container",
+                        "style": "emphasis",
+                        "items": [
+                            { "type": "Container", "style": "good", "bleed": true, "items": [ { "type": "TextBlock", "text": "Inner" } ] }
+                        ],
+                        "fallback": "drop"
+                    }
+                ]
+            })";
+
+            auto card = BinaryRoundTrip(*AdaptiveCard::DeserializeFromString(cardJson, "1.5")->GetAdaptiveCard());
+            auto outer = std::static_pointer_cast<Container>(card->GetBody().front());
+            auto inner = std::static_pointer_cast<Container>(outer->GetItems().front());
+            auto textBlock = std::static_pointer_cast<TextBlock>(inner->GetItems().front());
+
+            Assert::IsTrue(outer->GetPadding());
+            Assert::IsTrue(inner->GetPadding());
+            Assert::IsTrue(inner->GetBleed());
+            Assert::IsTrue(inner->GetParentalId() == outer->GetInternalId());
+            Assert::IsTrue(inner->CanFallbackToAncestor());
+            Assert::AreEqual(std::string("fr"), textBlock->GetLanguage());
+        }
+
+        TEST_METHOD(UnknownElementTest)
+        {
+            const std::string cardJson = R"({
+                "type": "AdaptiveCard",
+                "version": "1.5",
+                "body": [ { "type": "Unheard.Of", "id": "unknown", "extra": [ "a", { "b": 1 } ] } ],
+                "actions": [ { "type": "Action.Unheard.Of", "title": "Unknown" } ]
+            })";
+
+            auto card = AdaptiveCard::DeserializeFromString(cardJson, "1.5")->GetAdaptiveCard();
+            auto roundTripped = BinaryRoundTrip(*card);
+            Assert::AreEqual(card->Serialize(), roundTripped->Serialize());
+            Assert::IsTrue(roundTripped->GetBody().front()->GetElementType() == CardElementType::Unknown);
+            Assert::AreEqual(std::string("Unheard.Of"), roundTripped->GetBody().front()->GetElementTypeString());
+        }
+
+        TEST_METHOD(InvalidDataTest)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(
+                            R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ { "type": "TextBlock", "text": "Hi" } ] })", "1.5")
+                            ->GetAdaptiveCard();
+            const auto binary = card->SerializeToBinary();
+
+            const std::vector<char> notBinary{'{', '}'};
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { AdaptiveCard::DeserializeFromBinary(notBinary); });
+
+            const std::vector<char> truncated(binary.cbegin(), binary.cend() - 1);
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { AdaptiveCard::DeserializeFromBinary(truncated); });
+
+            // the version follows the four magic bytes
+            auto otherVersion = binary;
+            otherVersion[4] = static_cast<char>(c_cardBinaryFormatVersion + 1);
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { AdaptiveCard::DeserializeFromBinary(otherVersion); });
+        }
+
+        TEST_METHOD(CorruptDataTest)
+        {
+            const std::string cardJson = R"({
+                "type": "AdaptiveCard",
+                "version": "1.5",
+                "body": [ {
+                    "type": "Container",
+                    "style": "emphasis",
+                    "items": [ { "type": "TextBlock", "text": "Hi", "size": "large", "color": "accent", "horizontalAlignment": "right" } ]
+                } ],
+                "actions": [ { "type": "Action.Submit", "title": "Send", "associatedInputs": "none" } ]
+            })";
+
+            auto card = AdaptiveCard::DeserializeFromString(cardJson, "1.5")->GetAdaptiveCard();
+            const auto binary = card->SerializeToBinary();
+
+            // whatever byte is changed, the data either can't be read or is read as a card that can be written out:
+            // an enum can't be read as a value it doesn't have
+            for (size_t i = 0; i < binary.size(); ++i)
+            {
+                for (const char value : {'\x05', '\x7F'})
+                {
+                    auto corrupt = binary;
+                    corrupt[i] = value;
+
+                    std::shared_ptr<AdaptiveCard> corruptCard;
+                    try
+                    {
+                        corruptCard = AdaptiveCard::DeserializeFromBinary(corrupt)->GetAdaptiveCard();
+                    }
+                    catch (const AdaptiveCardParseException&)
+                    {
+                        continue;
+                    }
+                    corruptCard->Serialize();
+                }
+            }
+        }
+    };
+}
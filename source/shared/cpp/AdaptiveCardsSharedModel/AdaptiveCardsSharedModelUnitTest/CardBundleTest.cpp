@@ -0,0 +1,91 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "CardBundle.h"
+#include "ParseResult.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    std::shared_ptr<AdaptiveCard> BundleTestCard(const std::string& text, const std::string& language)
+    {
+        return AdaptiveCard::DeserializeFromString(
+                   "{ \"type\": \"AdaptiveCard\", \"version\": \"1.5\", \"lang\": \"" + language +
+                       "\", \"fallbackText\": \"Fallback\", \"body\": [ { \"type\": \"TextBlock\", \"text\": \"" + text + "\" } ] }",
+                   "1.5")
+            ->GetAdaptiveCard();
+    }
+
+    TEST_CLASS(CardBundleTest)
+    {
+    public:
+        TEST_METHOD(WriteAndReadTest)
+        {
+            const auto first = BundleTestCard("First", "en");
+            const auto second = BundleTestCard("Second", "de");
+            const auto third = BundleTestCard("Third", "en");
+
+            CardBundleWriter writer;
+            writer.AddCard("welcome", *second);
+            writer.AddCard("alert", *first);
+            writer.AddCard("reminder", *third);
+            auto bundle = CardBundle::FromData(writer.Write());
+
+            Assert::AreEqual(size_t{3}, bundle->GetCardCount());
+            Assert::IsTrue(bundle->GetCard(0).GetName() == "alert");
+            Assert::IsTrue(bundle->GetCard(2).GetName() == "welcome");
+            Assert::IsFalse(bundle->FindCard("missing").has_value());
+
+            const auto entry = bundle->FindCard("welcome");
+            Assert::IsTrue(entry.has_value());
+            Assert::AreEqual(size_t{2}, entry->GetIndex());
+            Assert::IsTrue(entry->GetVersion() == "1.5");
+            Assert::IsTrue(entry->GetFallbackText() == "Fallback");
+            Assert::IsTrue(entry->GetLanguage() == "de");
+            Assert::IsTrue(entry->GetSpeak().empty());
+
+            Assert::AreEqual(second->Serialize(), bundle->DeserializeCard(*entry)->GetAdaptiveCard()->Serialize());
+            Assert::AreEqual(first->Serialize(), bundle->DeserializeCard(bundle->GetCard(0))->GetAdaptiveCard()->Serialize());
+        }
+
+        TEST_METHOD(SharedStringsTest)
+        {
+            const auto card = BundleTestCard("The same text in every card", "en");
+
+            CardBundleWriter oneCard;
+            oneCard.AddCard("card0", *card);
+            CardBundleWriter tenCards;
+            for (int i = 0; i < 10; ++i)
+            {
+                tenCards.AddCard("card" + std::to_string(i), *card);
+            }
+
+            // each more card takes its name, its place in the index and the card itself, but no more of the text
+            const auto oneCardSize = oneCard.Write().size();
+            const auto tenCardsSize = tenCards.Write().size();
+            Assert::IsTrue(tenCardsSize - oneCardSize < 9 * oneCardSize / 2);
+        }
+
+        TEST_METHOD(InvalidBundleTest)
+        {
+            CardBundleWriter writer;
+            writer.AddCard("card", *BundleTestCard("Text", "en"));
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { writer.AddCard("card", *BundleTestCard("Other", "en")); });
+
+            const auto data = writer.Write();
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { CardBundle::FromData(std::vector<char>(data.cbegin(), data.cbegin() + 40)); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { CardBundle::FromData(std::vector<char>(32, 'A')); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { CardBundle::Open("this bundle does not exist.acbb"); });
+
+            auto bundle = CardBundle::FromData(data);
+            Assert::ExpectException<std::out_of_range>([&]() { bundle->GetCard(1); });
+
+            // a card cut short throws when it's deserialized
+            auto truncated = CardBundle::FromData(std::vector<char>(data.cbegin(), data.cend() - 1));
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { truncated->DeserializeCard(truncated->GetCard(0)); });
+        }
+    };
+}
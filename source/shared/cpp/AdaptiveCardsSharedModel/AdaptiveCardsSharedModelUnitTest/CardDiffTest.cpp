@@ -0,0 +1,199 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+
+#include <chrono>
+
+#include "CardDiff.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    std::shared_ptr<AdaptiveCard> DiffCardWithBody(const std::string& body)
+    {
+        return AdaptiveCard::DeserializeFromString(
+                   "{ \"type\": \"AdaptiveCard\", \"version\": \"1.5\", \"body\": [" + body + "] }", "1.5")
+            ->GetAdaptiveCard();
+    }
+
+    std::string DiffTextBlockJson(const std::string& id, const std::string& text)
+    {
+        return "{ \"type\": \"TextBlock\", \"id\": \"" + id + "\", \"text\": \"" + text + "\" }";
+    }
+
+    // A body of groupCount containers with four text blocks each, all with ids. With edited set, every hundredth
+    // group has its first text changed, moved to the end, removed, or followed by an inserted group (a quarter each).
+    std::string DiffGroupsJson(int groupCount, bool edited)
+    {
+        const auto group = [](int index, const std::string& text) {
+            std::string json = "{ \"type\": \"Container\", \"id\": \"c" + std::to_string(index) + "\", \"items\": [";
+            for (int i = 0; i < 4; ++i)
+            {
+                json += (i > 0 ? "," : "") +
+                    DiffTextBlockJson("t" + std::to_string(index) + "_" + std::to_string(i), i == 0 ? text : "x");
+            }
+            return json + "] }";
+        };
+
+        std::vector<std::string> groups;
+        std::vector<std::string> moved;
+        for (int i = 0; i < groupCount; ++i)
+        {
+            if (!edited)
+            {
+                groups.push_back(group(i, "x"));
+                continue;
+            }
+
+            switch (i % 100)
+            {
+            case 0:
+                groups.push_back(group(i, "changed"));
+                break;
+            case 25:
+                moved.push_back(group(i, "x"));
+                break;
+            case 50:
+                break;
+            case 75:
+                groups.push_back(group(i, "x"));
+                groups.push_back(group(groupCount + i, "x"));
+                break;
+            default:
+                groups.push_back(group(i, "x"));
+                break;
+            }
+        }
+        groups.insert(groups.end(), moved.cbegin(), moved.cend());
+
+        std::string body;
+        for (const auto& json : groups)
+        {
+            body += (body.empty() ? "" : ",") + json;
+        }
+        return body;
+    }
+
+    std::vector<CardEdit> DiffEditsOfType(const std::vector<CardEdit>& edits, CardEditType type)
+    {
+        std::vector<CardEdit> ofType;
+        std::copy_if(edits.cbegin(), edits.cend(), std::back_inserter(ofType), [type](const auto& edit) {
+            return edit.type == type;
+        });
+        return ofType;
+    }
+
+    TEST_CLASS(CardDiffTest)
+    {
+    public:
+        TEST_METHOD(SameCardTest)
+        {
+            const std::string body =
+                DiffTextBlockJson("a", "A") + ", { \"type\": \"Container\", \"items\": [" + DiffTextBlockJson("b", "B") + "] }";
+            Assert::IsTrue(Diff(*DiffCardWithBody(body), *DiffCardWithBody(body)).empty());
+        }
+
+        TEST_METHOD(InsertRemoveMoveTest)
+        {
+            auto oldCard = DiffCardWithBody(
+                DiffTextBlockJson("a", "A") + "," + DiffTextBlockJson("b", "B") + "," + DiffTextBlockJson("c", "C"));
+            auto newCard = DiffCardWithBody(
+                DiffTextBlockJson("c", "C") + "," + DiffTextBlockJson("a", "A") + "," + DiffTextBlockJson("d", "D"));
+
+            const auto edits = Diff(*oldCard, *newCard);
+            Assert::AreEqual(size_t{3}, edits.size());
+
+            const auto removes = DiffEditsOfType(edits, CardEditType::Remove);
+            Assert::AreEqual(size_t{1}, removes.size());
+            Assert::AreEqual(std::string("b"), removes[0].oldElement->GetId());
+            Assert::AreEqual(size_t{1}, removes[0].oldIndex);
+            Assert::IsTrue(removes[0].newParent == nullptr);
+            Assert::IsTrue(removes[0].collection == AdaptiveCardSchemaKey::Body);
+
+            // "a" stays put relative to "c", so only one of them moves
+            const auto moves = DiffEditsOfType(edits, CardEditType::Move);
+            Assert::AreEqual(size_t{1}, moves.size());
+            Assert::IsTrue(moves[0].oldElement == oldCard->GetBody().at(moves[0].oldIndex));
+            Assert::IsTrue(moves[0].newElement == newCard->GetBody().at(moves[0].newIndex));
+
+            const auto inserts = DiffEditsOfType(edits, CardEditType::Insert);
+            Assert::AreEqual(size_t{1}, inserts.size());
+            Assert::AreEqual(std::string("d"), inserts[0].newElement->GetId());
+            Assert::AreEqual(size_t{2}, inserts[0].newIndex);
+        }
+
+        TEST_METHOD(PropertyChangeTest)
+        {
+            auto oldCard = DiffCardWithBody(
+                "{ \"type\": \"Container\", \"id\": \"container\", \"items\": [" + DiffTextBlockJson("a", "A") + "," +
+                "{ \"type\": \"Image\", \"url\": \"http://x/1.png\" }] }");
+            auto newCard = DiffCardWithBody(
+                "{ \"type\": \"Container\", \"id\": \"container\", \"style\": \"emphasis\", \"items\": [" +
+                DiffTextBlockJson("a", "Changed") + "," + "{ \"type\": \"Image\", \"url\": \"http://x/2.png\" }] }");
+
+            const auto edits = Diff(*oldCard, *newCard);
+            Assert::AreEqual(size_t{3}, edits.size());
+            for (const auto& edit : edits)
+            {
+                Assert::IsTrue(edit.type == CardEditType::PropertyChange);
+            }
+
+            // the container's items don't count as a property of the container
+            Assert::AreEqual(std::string("container"), edits[0].newElement->GetId());
+            Assert::IsTrue(std::vector<std::string>{"style"} == edits[0].changedProperties);
+
+            // the image has no id, and is matched by type and position
+            Assert::AreEqual(std::string("a"), edits[1].newElement->GetId());
+            Assert::IsTrue(edits[1].newParent == newCard->GetBody().at(0));
+            Assert::IsTrue(edits[1].collection == AdaptiveCardSchemaKey::Items);
+            Assert::IsTrue(std::vector<std::string>{"text"} == edits[1].changedProperties);
+            Assert::IsTrue(std::vector<std::string>{"url"} == edits[2].changedProperties);
+        }
+
+        TEST_METHOD(TypeChangeTest)
+        {
+            auto oldCard = DiffCardWithBody(DiffTextBlockJson("a", "A"));
+            auto newCard = DiffCardWithBody("{ \"type\": \"Input.Text\", \"id\": \"a\" }");
+
+            const auto edits = Diff(*oldCard, *newCard);
+            Assert::AreEqual(size_t{2}, edits.size());
+            Assert::IsTrue(edits[0].type == CardEditType::Remove);
+            Assert::IsTrue(edits[1].type == CardEditType::Insert);
+        }
+
+        TEST_METHOD(DiffBenchmark)
+        {
+            for (const int groupCount : {200, 1000, 4000})
+            {
+                const auto oldCard = DiffCardWithBody(DiffGroupsJson(groupCount, false));
+                const auto newCard = DiffCardWithBody(DiffGroupsJson(groupCount, true));
+
+                constexpr int repeats = 3;
+                std::vector<CardEdit> edits;
+                const auto start = std::chrono::steady_clock::now();
+                for (int i = 0; i < repeats; ++i)
+                {
+                    edits = Diff(*oldCard, *newCard);
+                }
+                const auto end = std::chrono::steady_clock::now();
+
+                const size_t editCount = groupCount / 100;
+                for (const auto type :
+                     {CardEditType::Insert, CardEditType::Remove, CardEditType::Move, CardEditType::PropertyChange})
+                {
+                    Assert::AreEqual(editCount, DiffEditsOfType(edits, type).size());
+                }
+
+                Logger::WriteMessage(
+                    ("Diff, " + std::to_string(groupCount * 5) + " elements, " + std::to_string(edits.size()) +
+                     " edits: " +
+                     std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / repeats) +
+                     "us")
+                        .c_str());
+            }
+        }
+    };
+}
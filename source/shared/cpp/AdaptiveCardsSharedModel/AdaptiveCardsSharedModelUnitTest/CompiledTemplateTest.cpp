@@ -0,0 +1,400 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+
+#include <chrono>
+#include <thread>
+#ifdef _WIN32
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include "AdaptiveCardTemplate.h"
+#include "CompiledTemplate.h"
+#include "ParseUtil.h"
+#include "TemplateExpression.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    const std::string compiledTemplateTestData = R"({
+        "name": "Matt",
+        "peers": [ { "name": "Andrew" }, { "name": "Lei" }, { "name": "Mary Anne" } ],
+        "requests": [ { "type": "monitor", "price": 100 }, { "price": 2000 } ]
+    })";
+
+    // The most memory the process has had resident so far, in bytes
+    size_t PeakResidentMemory()
+    {
+#ifdef _WIN32
+        PROCESS_MEMORY_COUNTERS counters{};
+        GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+        return counters.PeakWorkingSetSize;
+#else
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+        return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+    }
+
+    // Counts what's written to it, and keeps none of it
+    class CountingBuffer : public std::streambuf
+    {
+    public:
+        size_t GetCount() const { return m_count; }
+
+    protected:
+        int_type overflow(int_type c) override
+        {
+            ++m_count;
+            return traits_type::not_eof(c);
+        }
+
+        std::streamsize xsputn(const char*, std::streamsize count) override
+        {
+            m_count += static_cast<size_t>(count);
+            return count;
+        }
+
+    private:
+        size_t m_count = 0;
+    };
+
+    // Expands the template both compiled and not, and checks that all three ways of expanding it agree
+    std::string ExpandCompiledTemplate(const std::string& templateJson, std::vector<std::string>& warnings)
+    {
+        const auto data = ParseUtil::GetJsonValueFromString(compiledTemplateTestData);
+        std::vector<std::string> expectedWarnings;
+        const auto expected = ParseUtil::JsonToString(AdaptiveCardTemplate(templateJson).Expand(data, expectedWarnings));
+
+        CompiledTemplate compiled(templateJson);
+        Assert::AreEqual(expected, ParseUtil::JsonToString(compiled.Expand(data, warnings)));
+        Assert::AreEqual(expected, compiled.ExpandToString(data) + '\n');
+        Assert::IsTrue(expectedWarnings == warnings);
+        return expected;
+    }
+
+    TEST_CLASS(CompiledTemplateTest)
+    {
+    public:
+        TEST_METHOD(SameAsTemplateTest)
+        {
+            std::vector<std::string> warnings;
+            Assert::AreEqual(std::string(R"({"body":[{"text":"Peers of Matt"},{"text":"1. Andrew"},{"text":"2. Lei"},{"text":"3. Mary Anne"}],"type":"AdaptiveCard"})"
+                                         "\n"),
+                             ExpandCompiledTemplate(R"({ "type": "AdaptiveCard", "body": [ { "text": "Peers of ${name}" },
+                                 { "$data": "${peers}", "text": "${string($index + 1)}. ${name}" } ] })",
+                                                    warnings));
+
+            ExpandCompiledTemplate(R"({ "items": [ null, [ 1, [ 2 ] ], "${peers}", "${missing}", { "$data": [], "a": 1 } ],
+                                        "one": { "$data": [ { "x": 1 } ], "x": "${x}" }, "none": { "$data": [], "x": 1 },
+                                        "many": { "$data": "${requests}", "$when": "${exists(type)}", "t": "${type}", "s": 1 },
+                                        "unknown": "${missing}", "$index": 5, "static": { "a": [ 1, 2 ], "b": "c" } })",
+                                   warnings);
+
+            ExpandCompiledTemplate(R"({ "body": [ { "$when": "${nothing}" }, { "$when": 5 } ] })", warnings);
+            Assert::AreEqual(size_t{2}, warnings.size());
+        }
+
+        TEST_METHOD(StaticSubtreeTest)
+        {
+            // nothing here binds to data: a constant expression is folded when it's compiled
+            CompiledTemplate staticTemplate(std::string(R"({ "body": [ { "text": "${1 + 2} items" }, { "items": [ 1, 2 ] } ] })"));
+            Assert::AreEqual(size_t{0}, staticTemplate.GetBindingCount());
+            Assert::AreEqual(std::string(R"({"body":[{"text":"3 items"},{"items":[1,2]}]})"), staticTemplate.ExpandToString(Json::Value()));
+
+            CompiledTemplate boundTemplate(std::string(R"({ "body": [ { "text": "${name}" }, { "$data": "${peers}", "$when": "${true}", "text": "static" } ] })"));
+            Assert::AreEqual(size_t{3}, boundTemplate.GetBindingCount());
+        }
+
+        TEST_METHOD(ParallelExpansionTest)
+        {
+            Json::Value data;
+            data["title"] = "Digest";
+            for (int i = 0; i < 1000; ++i)
+            {
+                Json::Value item;
+                item["id"] = i;
+                if (i % 7 != 0)
+                {
+                    item["kept"] = i % 3 != 0;
+                }
+                data["items"].append(item);
+            }
+
+            const std::string templateJson = R"({ "body": [ { "$data": "${items}", "$when": "${kept}",
+                "text": "${string($index)}: ${id} of ${$root.title}", "sub": { "$data": [ 1, 2 ], "n": "${$index}" } } ],
+                "single": { "$data": "${items}", "$when": "${id == 500}", "id": "${id}" } })";
+
+            CompiledTemplate serial(templateJson);
+            std::vector<std::string> serialWarnings;
+            const auto expected = serial.ExpandToString(data, serialWarnings);
+            std::vector<std::string> expandWarnings;
+            Assert::AreEqual(expected + '\n', ParseUtil::JsonToString(serial.Expand(data, expandWarnings)));
+            Assert::IsTrue(serialWarnings == expandWarnings);
+
+            // the data splits into chunks of various sizes, and one repetition is kept in all of them
+            for (const unsigned int threadCount : {2U, 3U, 8U})
+            {
+                CompiledTemplate parallel(templateJson);
+                parallel.SetThreadPool(std::make_shared<ThreadPool>(threadCount));
+                parallel.SetParallelThreshold(10);
+
+                std::vector<std::string> warnings;
+                Assert::AreEqual(expected, parallel.ExpandToString(data, warnings));
+                Assert::IsTrue(serialWarnings == warnings);
+
+                warnings.clear();
+                Assert::AreEqual(expected + '\n', ParseUtil::JsonToString(parallel.Expand(data, warnings)));
+                Assert::IsTrue(serialWarnings == warnings);
+            }
+            // an item without "kept" can't be decided
+            Assert::AreEqual(size_t{143}, serialWarnings.size());
+        }
+
+        // Times expanding a 10k-item digest on 1, 2, 4 and one thread per hardware thread. The scaling this shows is
+        // only that of the machine it runs on: with one core, it shows what the parallel path costs.
+        TEST_METHOD(ParallelExpansionBenchmark)
+        {
+            constexpr int itemCount = 10000;
+            constexpr int repetitions = 5;
+            Json::Value data;
+            data["title"] = "Digest";
+            for (int i = 0; i < itemCount; ++i)
+            {
+                Json::Value item;
+                item["id"] = i;
+                item["author"] = "Author " + std::to_string(i % 50);
+                item["subject"] = "Subject of item " + std::to_string(i);
+                item["unread"] = i % 3 == 0;
+                data["items"].append(item);
+            }
+
+            const std::string templateJson = R"({ "type": "AdaptiveCard", "version": "1.5", "body": [
+                { "type": "TextBlock", "text": "${title}", "size": "large" },
+                { "$data": "${items}", "type": "ColumnSet", "id": "row${id}", "columns": [
+                    { "type": "Column", "items": [ { "type": "TextBlock", "text": "${string($index + 1)}." } ] },
+                    { "type": "Column", "items": [
+                        { "type": "TextBlock", "text": "${subject}", "weight": "${if(unread, 'bolder', 'default')}" },
+                        { "type": "TextBlock", "text": "${author} in ${$root.title}", "isSubtle": true } ] } ] } ] })";
+
+            std::vector<unsigned int> threadCounts{1, 2, 4};
+            const auto hardwareThreadCount = std::thread::hardware_concurrency();
+            if (hardwareThreadCount > 4)
+            {
+                threadCounts.push_back(hardwareThreadCount);
+            }
+
+            const auto expected = CompiledTemplate(templateJson).ExpandToString(data);
+            for (const auto threadCount : threadCounts)
+            {
+                CompiledTemplate compiled(templateJson);
+                compiled.SetThreadPool(std::make_shared<ThreadPool>(threadCount));
+                Assert::AreEqual(expected, compiled.ExpandToString(data));
+
+                auto start = std::chrono::steady_clock::now();
+                for (int i = 0; i < repetitions; ++i)
+                {
+                    Assert::AreEqual(expected.size(), compiled.ExpandToString(data).size());
+                }
+                const auto stringTime = std::chrono::steady_clock::now() - start;
+
+                start = std::chrono::steady_clock::now();
+                for (int i = 0; i < repetitions; ++i)
+                {
+                    Assert::AreEqual(Json::ArrayIndex{itemCount + 1}, compiled.Expand(data)["body"].size());
+                }
+                const auto valueTime = std::chrono::steady_clock::now() - start;
+
+                const auto toMicroseconds = [](std::chrono::steady_clock::duration time) {
+                    return std::to_string(
+                        std::chrono::duration_cast<std::chrono::microseconds>(time).count() / repetitions);
+                };
+                const auto actualThreadCount = compiled.GetThreadPool()->GetThreadCount();
+                Logger::WriteMessage(("CompiledTemplate, " + std::to_string(actualThreadCount) + " threads, " +
+                                      std::to_string(itemCount) + " items: ExpandToString " +
+                                      toMicroseconds(stringTime) + "us, Expand " + toMicroseconds(valueTime) + "us")
+                                         .c_str());
+            }
+        }
+
+        TEST_METHOD(ReexpansionBenchmark)
+        {
+            constexpr int payloadCount = 100;
+            std::vector<Json::Value> payloads;
+            for (int i = 0; i < payloadCount; ++i)
+            {
+                Json::Value payload;
+                payload["flight"] = "KL" + std::to_string(600 + i);
+                payload["gate"] = "B" + std::to_string(i % 40);
+                payload["delayed"] = i % 4 == 0;
+                payload["passengers"] = i;
+                payloads.push_back(payload);
+            }
+
+            // a handful of bindings, with more and more of the card around them static
+            const std::string bound = R"({ "type": "TextBlock", "text": "Flight ${flight} leaves from gate ${gate}" },
+                { "type": "TextBlock", "$when": "${delayed}", "text": "Delayed", "color": "attention" },
+                { "type": "TextBlock", "text": "${string(passengers)} passengers", "isSubtle": true })";
+            const std::string staticBlock = R"({ "type": "ColumnSet", "columns": [
+                { "type": "Column", "width": "auto", "items": [ { "type": "Image", "url": "https://adaptivecards.io/content/airplane.png", "size": "small" } ] },
+                { "type": "Column", "items": [ { "type": "TextBlock", "text": "Amsterdam", "size": "extraLarge" },
+                    { "type": "FactSet", "facts": [ { "title": "Terminal", "value": "2" }, { "title": "Boarding", "value": "45 minutes before departure" } ] } ] } ] })";
+
+            for (const int staticBlockCount : {1, 10, 100})
+            {
+                std::string body = bound;
+                for (int i = 0; i < staticBlockCount; ++i)
+                {
+                    body += "," + staticBlock;
+                }
+                const std::string templateJson = R"({ "type": "AdaptiveCard", "version": "1.5", "body": [ )" + body + " ] }";
+
+                const AdaptiveCardTemplate raw(templateJson);
+                const CompiledTemplate compiled(templateJson);
+
+                const auto time = [&](const std::function<size_t(const Json::Value&)>& expand) {
+                    size_t size = 0;
+                    const auto start = std::chrono::steady_clock::now();
+                    for (const auto& payload : payloads)
+                    {
+                        size += expand(payload);
+                    }
+                    const auto end = std::chrono::steady_clock::now();
+                    const auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+                    return std::make_pair(size, std::to_string(microseconds / payloadCount));
+                };
+
+                const auto rawString = time([&](const Json::Value& payload) {
+                    std::string json;
+                    ParseUtil::WriteJson(raw.Expand(payload), json);
+                    return json.size();
+                });
+                const auto compiledString =
+                    time([&](const Json::Value& payload) { return compiled.ExpandToString(payload).size(); });
+                const auto rawValue = time([&](const Json::Value& payload) { return raw.Expand(payload)["body"].size(); });
+                const auto compiledValue =
+                    time([&](const Json::Value& payload) { return compiled.Expand(payload)["body"].size(); });
+                Assert::AreEqual(rawString.first, compiledString.first);
+                Assert::AreEqual(rawValue.first, compiledValue.first);
+
+                Logger::WriteMessage(("Re-expanding, " + std::to_string(templateJson.size()) +
+                                      " byte template: raw Expand and WriteJson " + rawString.second +
+                                      "us, ExpandToString " + compiledString.second + "us, raw Expand " +
+                                      rawValue.second + "us, compiled Expand " + compiledValue.second + "us")
+                                         .c_str());
+            }
+        }
+
+        TEST_METHOD(StreamingExpansionTest)
+        {
+            Json::Value data;
+            for (int i = 0; i < 5000; ++i)
+            {
+                Json::Value item;
+                item["name"] = "Item " + std::to_string(i);
+                if (i % 1000 != 0)
+                {
+                    item["kept"] = i % 2 == 0;
+                }
+                data["items"].append(item);
+            }
+
+            // more than is written before it's flushed, and objects repeated as values whose $when warns, both around
+            // the objects nested in them and before the first is kept
+            const std::string templateJson = R"({ "body": [ { "$data": "${items}", "text": "${name}", "missing": "${nothing}",
+                "inner": { "$data": [ 1 ], "$when": "${notInData}" } } ],
+                "repeated": { "$data": "${items}", "$when": "${kept}", "inner": { "$when": "${alsoNotInData}" } },
+                "none": { "$data": "${items}", "$when": "${name == 'none'}" }, "unknown": "${missing}", "spliced": [ "${items}" ] })";
+
+            CompiledTemplate compiled(templateJson);
+            std::vector<std::string> expectedWarnings;
+            const auto expected = compiled.ExpandToString(data, expectedWarnings);
+
+            std::ostringstream output;
+            std::vector<std::string> warnings;
+            compiled.ExpandTo(data, output, warnings);
+            Assert::AreEqual(expected, output.str());
+            Assert::IsTrue(expectedWarnings == warnings);
+            // one for each item's inner object, each item without "kept", and each repetition that's kept
+            Assert::AreEqual(size_t{5000 + 5 + 2495}, warnings.size());
+
+            std::ostringstream nullOutput;
+            CompiledTemplate(std::string(R"({ "$data": [], "a": 1 })")).ExpandTo(data, nullOutput);
+            Assert::AreEqual(std::string("null"), nullOutput.str());
+        }
+
+        TEST_METHOD(StreamingMemoryBenchmark)
+        {
+            // about 100 MB of data as JSON
+            constexpr size_t dataSize = 100 * 1024 * 1024;
+            Json::Value data;
+            data["title"] = "Digest";
+            size_t itemsSize = 0;
+            for (int i = 0; itemsSize < dataSize; ++i)
+            {
+                Json::Value item;
+                item["id"] = i;
+                item["author"] = "Author " + std::to_string(i % 50);
+                item["subject"] = "Subject of item " + std::to_string(i);
+                item["unread"] = i % 3 == 0;
+                std::string itemJson;
+                ParseUtil::WriteJson(item, itemJson);
+                itemsSize += itemJson.size();
+                data["items"].append(std::move(item));
+            }
+
+            const CompiledTemplate compiled(std::string(R"({ "type": "AdaptiveCard", "version": "1.5", "body": [
+                { "type": "TextBlock", "text": "${title}", "size": "large" },
+                { "$data": "${items}", "type": "ColumnSet", "id": "row${id}", "columns": [
+                    { "type": "Column", "items": [ { "type": "TextBlock", "text": "${string($index + 1)}." } ] },
+                    { "type": "Column", "items": [
+                        { "type": "TextBlock", "text": "${subject}", "weight": "${if(unread, 'bolder', 'default')}" },
+                        { "type": "TextBlock", "text": "${author} in ${$root.title}", "isSubtle": true } ] } ] } ] })"));
+
+            // the peak only goes up, so ExpandTo is measured first. Expanding this much to a Json::Value takes several
+            // GB, which is more than the test should need.
+            const auto dataPeak = PeakResidentMemory();
+            const auto time = [&](const std::function<size_t()>& expand) {
+                const auto start = std::chrono::steady_clock::now();
+                const auto size = expand();
+                const auto end = std::chrono::steady_clock::now();
+                const auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+                return std::make_pair(size,
+                                      std::to_string((PeakResidentMemory() - dataPeak) / 1024) + " KB, " +
+                                          std::to_string(milliseconds) + "ms");
+            };
+
+            const auto streamed = time([&]() {
+                CountingBuffer buffer;
+                std::ostream output(&buffer);
+                compiled.ExpandTo(data, output);
+                return buffer.GetCount();
+            });
+            const auto string = time([&]() { return compiled.ExpandToString(data).size(); });
+            Assert::IsTrue(streamed.first > dataSize);
+            Assert::AreEqual(streamed.first, string.first);
+
+            Logger::WriteMessage(("Expanding " + std::to_string(data["items"].size()) + " items to " +
+                                  std::to_string(streamed.first / (1024 * 1024)) +
+                                  " MB, peak memory above the data: ExpandTo " + streamed.second +
+                                  ", ExpandToString " + string.second)
+                                     .c_str());
+        }
+
+        TEST_METHOD(ConstantFoldingTest)
+        {
+            Assert::IsTrue(TemplateExpression::Parse("1 + 2 * 3")->GetKind() == TemplateExpressionKind::Constant);
+            Assert::IsTrue(TemplateExpression::Parse("toUpper(concat('a', 'b'))")->GetConstant() == Json::Value("AB"));
+            Assert::IsTrue(TemplateExpression::Parse("price + 2 * 3")->GetChildren()[1]->GetKind() == TemplateExpressionKind::Constant);
+
+            // what isn't decided by constants alone is left for when the template is expanded
+            Assert::IsTrue(TemplateExpression::Parse("utcNow()")->GetKind() == TemplateExpressionKind::Call);
+            Assert::IsTrue(TemplateExpression::Parse("1 / 0")->GetKind() == TemplateExpressionKind::Binary);
+            Assert::IsTrue(TemplateExpression::Parse("[1][0]")->GetKind() == TemplateExpressionKind::Index);
+        }
+    };
+}
@@ -0,0 +1,418 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+#include "BatchDeserializer.h"
+#include "Container.h"
+#include "InternalId.h"
+#include "ParseContext.h"
+#include "ParseUtil.h"
+#include "TextBlock.h"
+#include "ThreadPool.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    constexpr unsigned int c_threadCount = 8;
+
+    // An element and its fallback content are allowed to share an id, so parsing this card on several threads at
+    // once only succeeds if every thread's ParseContext sees the internal ids its own elements were given.
+    const std::string c_cardWithFallback =
+        "{\
+            \"type\": \"AdaptiveCard\",\
+            \"version\": \"1.2\",\
+            \"body\": [\
+                {\
+                    \"type\": \"Container\",\
+                    \"id\": \"outer\",\
+                    \"items\": [\
+                        {\
+                            \"type\": \"Graph\",\
+                            \"id\": \"chart\",\
+                            \"fallback\": {\
+                                \"type\": \"TextBlock\",\
+                                \"id\": \"chart\",\
+                                \"text\": \"No graphs here\"\
+                            }\
+                        },\
+                        {\
+                            \"type\": \"TextBlock\",\
+                            \"id\": \"caption\",\
+                            \"text\": \"Caption\"\
+                        }\
+                    ]\
+                }\
+            ]\
+        }";
+
+    const std::string c_cardWithCollision =
+        "{\
+            \"type\": \"AdaptiveCard\",\
+            \"version\": \"1.2\",\
+            \"body\": [\
+                {\
+                    \"type\": \"TextBlock\",\
+                    \"id\": \"duplicate\",\
+                    \"text\": \"first\"\
+                },\
+                {\
+                    \"type\": \"TextBlock\",\
+                    \"id\": \"duplicate\",\
+                    \"text\": \"second\"\
+                }\
+            ]\
+        }";
+
+    const std::string c_cardWithInvalidLanguage =
+        "{\
+            \"type\": \"AdaptiveCard\",\
+            \"version\": \"1.2\",\
+            \"lang\": \"not a language\",\
+            \"body\": []\
+        }";
+
+    // The sample cards the unit test project copies next to the tests, by path
+    std::vector<std::pair<std::string, std::string>> ReadSampleCards(const std::filesystem::path& directory)
+    {
+        std::vector<std::pair<std::string, std::string>> cards;
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(directory))
+        {
+            auto extension = entry.path().extension().string();
+            std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) {
+                return static_cast<char>(std::tolower(c));
+            });
+            if (entry.is_regular_file() && extension == ".json")
+            {
+                std::ifstream file(entry.path());
+                cards.emplace_back(entry.path().string(),
+                                   std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()));
+            }
+        }
+        return cards;
+    }
+
+    // What parsing a card gave: the card serialized again and its warnings, or the error it was rejected with
+    std::string DescribeParseResult(const ParseResult& parseResult)
+    {
+        std::string description = ParseUtil::JsonToString(parseResult.GetAdaptiveCard()->SerializeToJsonValue());
+        for (const auto& warning : parseResult.GetWarnings())
+        {
+            description += "warning: " + warning->GetReason() + "\n";
+        }
+        return description;
+    }
+
+    std::string DescribeParseError(const std::string& message) { return "error: " + message; }
+
+    std::string DescribeParse(const std::string& card)
+    {
+        try
+        {
+            return DescribeParseResult(*AdaptiveCard::DeserializeFromString(card, "1.5"));
+        }
+        catch (const AdaptiveCardParseException& e)
+        {
+            return DescribeParseError(e.GetReason());
+        }
+        catch (const std::exception& e)
+        {
+            return DescribeParseError(e.what());
+        }
+    }
+
+    TEST_CLASS(ConcurrentParsingTest)
+    {
+    public:
+        TEST_METHOD(InternalIdsAreUniqueAcrossThreadsTest)
+        {
+            constexpr unsigned int idsPerThread = 10000;
+            std::vector<std::vector<unsigned int>> idsByThread(c_threadCount);
+            std::vector<std::thread> threads;
+            for (unsigned int i = 0; i < c_threadCount; ++i)
+            {
+                threads.emplace_back([&ids = idsByThread[i]]() {
+                    for (unsigned int j = 0; j < idsPerThread; ++j)
+                    {
+                        const auto internalId = InternalId::Next();
+                        // the id just handed out is this thread's current id, whatever the other threads are doing
+                        if (InternalId::Current() == internalId)
+                        {
+                            ids.push_back(internalId.Hash());
+                        }
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            std::unordered_set<unsigned int> allIds;
+            for (const auto& ids : idsByThread)
+            {
+                Assert::AreEqual(static_cast<size_t>(idsPerThread), ids.size());
+                allIds.insert(ids.begin(), ids.end());
+            }
+            Assert::AreEqual(static_cast<size_t>(c_threadCount * idsPerThread), allIds.size());
+        }
+
+        TEST_METHOD(ParseCardsOnManyThreadsTest)
+        {
+            constexpr unsigned int cardsPerThread = 200;
+            std::atomic<unsigned int> parsedCards{0};
+            std::atomic<unsigned int> detectedCollisions{0};
+            std::vector<std::thread> threads;
+            for (unsigned int i = 0; i < c_threadCount; ++i)
+            {
+                threads.emplace_back([&]() {
+                    for (unsigned int j = 0; j < cardsPerThread; ++j)
+                    {
+                        auto parseResult = AdaptiveCard::DeserializeFromString(c_cardWithFallback, "1.2");
+                        const auto container =
+                            std::dynamic_pointer_cast<Container>(parseResult->GetAdaptiveCard()->GetBody().at(0));
+                        if (container && container->GetItems().size() == 2 &&
+                            container->GetItems().at(0)->GetFallbackType() == FallbackType::Content)
+                        {
+                            ++parsedCards;
+                        }
+
+                        try
+                        {
+                            AdaptiveCard::DeserializeFromString(c_cardWithCollision, "1.2");
+                        }
+                        catch (const AdaptiveCardParseException& e)
+                        {
+                            if (e.GetStatusCode() == ErrorStatusCode::IdCollision)
+                            {
+                                ++detectedCollisions;
+                            }
+                        }
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            Assert::AreEqual(c_threadCount * cardsPerThread, parsedCards.load());
+            Assert::AreEqual(c_threadCount * cardsPerThread, detectedCollisions.load());
+        }
+
+        // Parses every card in samples/v1.5 on several threads at once, and through a batch, and checks that each
+        // comes out the same as when it's parsed alone. This and the other tests here are also worth running under
+        // ThreadSanitizer (-fsanitize=thread with GCC or Clang) after a change to anything parsing shares between
+        // threads.
+        TEST_METHOD(ParseSamplesOnManyThreadsTest)
+        {
+            constexpr unsigned int passesPerThread = 5;
+            const auto samples = ReadSampleCards("samples/v1.5");
+            Assert::IsFalse(samples.empty(), L"the v1.5 samples weren't copied next to the tests");
+
+            std::vector<std::string> expected;
+            for (const auto& sample : samples)
+            {
+                expected.push_back(DescribeParse(sample.second));
+            }
+
+            // each thread starts at a different sample, so different cards are being parsed at the same time
+            std::vector<std::vector<std::string>> mismatchesByThread(c_threadCount);
+            std::vector<std::thread> threads;
+            for (unsigned int i = 0; i < c_threadCount; ++i)
+            {
+                threads.emplace_back([&, i]() {
+                    for (unsigned int pass = 0; pass < passesPerThread; ++pass)
+                    {
+                        for (size_t j = 0; j < samples.size(); ++j)
+                        {
+                            const size_t sample = (i + j) % samples.size();
+                            if (DescribeParse(samples[sample].second) != expected[sample])
+                            {
+                                mismatchesByThread[i].push_back(samples[sample].first);
+                            }
+                        }
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+            for (const auto& mismatches : mismatchesByThread)
+            {
+                for (const auto& path : mismatches)
+                {
+                    Logger::WriteMessage(("Parsed differently on another thread: " + path).c_str());
+                }
+                Assert::IsTrue(mismatches.empty());
+            }
+
+            std::vector<std::string> cards;
+            for (unsigned int pass = 0; pass < passesPerThread; ++pass)
+            {
+                for (const auto& sample : samples)
+                {
+                    cards.push_back(sample.second);
+                }
+            }
+            const auto results = BatchDeserializer(c_threadCount).DeserializeBatch(cards, "1.5");
+            Assert::AreEqual(cards.size(), results.size());
+            for (size_t i = 0; i < results.size(); ++i)
+            {
+                const auto& want = expected[i % samples.size()];
+                Assert::AreEqual(want,
+                                 results[i].HasValue() ? DescribeParseResult(*results[i].GetValue()) :
+                                                         DescribeParseError(results[i].GetError().message));
+            }
+        }
+
+        TEST_METHOD(DeserializeBatchTest)
+        {
+            constexpr unsigned int cardsPerKind = 50;
+            std::vector<std::string> cards;
+            for (unsigned int i = 0; i < cardsPerKind; ++i)
+            {
+                cards.push_back(c_cardWithFallback);
+                cards.push_back(c_cardWithCollision);
+                cards.push_back(c_cardWithInvalidLanguage);
+                cards.push_back("{ not json");
+            }
+
+            const BatchDeserializer deserializer(c_threadCount);
+            Assert::AreEqual(c_threadCount, deserializer.GetThreadCount());
+            const auto results = deserializer.DeserializeBatch(cards, "1.2");
+            Assert::AreEqual(cards.size(), results.size());
+
+            // results come back in input order, and each card's warnings and errors are its own
+            for (size_t i = 0; i < results.size(); i += 4)
+            {
+                Assert::IsTrue(results[i].HasValue());
+                Assert::IsTrue(results[i].GetValue()->GetWarnings().empty());
+                Assert::AreEqual(size_t{1}, results[i].GetValue()->GetAdaptiveCard()->GetBody().size());
+
+                Assert::IsFalse(results[i + 1].HasValue());
+                Assert::IsTrue(results[i + 1].GetError().statusCode == ErrorStatusCode::IdCollision);
+
+                Assert::IsTrue(results[i + 2].HasValue());
+                const auto warnings = results[i + 2].GetValue()->GetWarnings();
+                Assert::AreEqual(size_t{1}, warnings.size());
+                Assert::IsTrue(warnings[0]->GetStatusCode() == WarningStatusCode::InvalidLanguage);
+
+                Assert::IsFalse(results[i + 3].HasValue());
+                Assert::IsTrue(results[i + 3].GetError().statusCode == ErrorStatusCode::InvalidJson);
+            }
+        }
+
+        TEST_METHOD(DeserializeBatchContextTest)
+        {
+            const std::string card = R"({ "type": "AdaptiveCard", "version": "1.2", "body": [ { "type": "TextBlock", "text": "Hallo" } ] })";
+            ParseContext context;
+            context.SetLanguage("de");
+            context.SetArena(std::make_shared<ParseArena>(256));
+
+            const BatchDeserializer deserializer(c_threadCount);
+            const auto results = deserializer.DeserializeBatch(std::vector<std::string>(100, card), "1.2", context);
+            for (const auto& result : results)
+            {
+                Assert::IsTrue(result.HasValue());
+                const auto textBlock = std::static_pointer_cast<TextBlock>(result.GetValue()->GetAdaptiveCard()->GetBody().front());
+                Assert::AreEqual(std::string("de"), textBlock->GetLanguage());
+            }
+
+            // an arena is only for one parse at a time, so the cards were each given one of their own
+            Assert::AreEqual(size_t{0}, context.GetArena()->GetBytesAllocated());
+        }
+
+        TEST_METHOD(ConcurrentParallelForTest)
+        {
+            ThreadPool pool(2);
+            Assert::AreEqual(2U, pool.GetThreadCount());
+
+            // the second call comes from another thread while the workers are busy with the first. It waits for them
+            // rather than running on its calling thread alone, so both of its items are running at once.
+            std::atomic<bool> isSecondCallMade{false};
+            std::atomic<int> secondCallItemsStarted{0};
+            std::atomic<int> secondCallItemsMet{0};
+            std::thread secondCaller;
+            pool.ParallelFor(2, [&](size_t i) {
+                if (i == 0)
+                {
+                    secondCaller = std::thread([&]() {
+                        isSecondCallMade = true;
+                        pool.ParallelFor(2, [&](size_t) {
+                            ++secondCallItemsStarted;
+                            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+                            while (secondCallItemsStarted < 2 && std::chrono::steady_clock::now() < deadline)
+                            {
+                                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                            }
+                            if (secondCallItemsStarted == 2)
+                            {
+                                ++secondCallItemsMet;
+                            }
+                        });
+                    });
+                }
+                while (!isSecondCallMade)
+                {
+                    std::this_thread::yield();
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            });
+            secondCaller.join();
+            Assert::AreEqual(2, secondCallItemsMet.load());
+
+            // a call made from an item runs on its calling thread, rather than waiting on the call it's part of
+            std::atomic<int> nestedItems{0};
+            pool.ParallelFor(2, [&](size_t) { pool.ParallelFor(3, [&](size_t) { ++nestedItems; }); });
+            Assert::AreEqual(6, nestedItems.load());
+        }
+
+        // Times the same batch on 1, 2, 4 and one thread per hardware thread, each with a deserializer built once and
+        // reused, as a host would; the first batch on each is a warm-up and isn't timed. Only as many threads as the
+        // machine has hardware threads (which is logged) can speed the batch up; past that the times show the cost of
+        // the threads.
+        TEST_METHOD(DeserializeBatchThreadCountBenchmark)
+        {
+            constexpr unsigned int cardCount = 2000;
+            constexpr int repetitions = 5;
+            const std::vector<std::string> cards(cardCount, c_cardWithFallback);
+
+            std::vector<unsigned int> threadCounts{1, 2, 4};
+            const auto hardwareThreadCount = std::thread::hardware_concurrency();
+            if (hardwareThreadCount > 4)
+            {
+                threadCounts.push_back(hardwareThreadCount);
+            }
+
+            for (const auto threadCount : threadCounts)
+            {
+                const BatchDeserializer deserializer(threadCount);
+                Assert::AreEqual(size_t{cardCount}, deserializer.DeserializeBatch(cards, "1.2").size());
+
+                const auto start = std::chrono::steady_clock::now();
+                for (int i = 0; i < repetitions; ++i)
+                {
+                    const auto results = deserializer.DeserializeBatch(cards, "1.2");
+                    Assert::IsTrue(results.back().HasValue());
+                }
+                const auto end = std::chrono::steady_clock::now();
+
+                const auto time = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+                Logger::WriteMessage(("DeserializeBatch, " + std::to_string(deserializer.GetThreadCount()) +
+                                      " threads on " + std::to_string(hardwareThreadCount) +
+                                      " hardware threads: " + std::to_string(time / repetitions) + "us per " +
+                                      std::to_string(cardCount) + " cards")
+                                         .c_str());
+            }
+        }
+    };
+}
@@ -0,0 +1,227 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+
+#include <chrono>
+
+#include "Column.h"
+#include "Container.h"
+#include "ElementIdIndex.h"
+#include "ParseContext.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    const std::string c_cardToIndex =
+        "{\
+            \"type\": \"AdaptiveCard\",\
+            \"version\": \"1.5\",\
+            \"body\": [\
+                {\
+                    \"type\": \"Container\",\
+                    \"id\": \"container\",\
+                    \"items\": [\
+                        {\
+                            \"type\": \"ColumnSet\",\
+                            \"columns\": [\
+                                {\
+                                    \"type\": \"Column\",\
+                                    \"id\": \"column\",\
+                                    \"items\": [ { \"type\": \"Input.Text\", \"id\": \"input\" } ]\
+                                }\
+                            ]\
+                        }\
+                    ],\
+                    \"fallback\": { \"type\": \"TextBlock\", \"id\": \"container\", \"text\": \"Fallback\" }\
+                }\
+            ],\
+            \"actions\": [\
+                {\
+                    \"type\": \"Action.ShowCard\",\
+                    \"id\": \"showCard\",\
+                    \"card\": {\
+                        \"type\": \"AdaptiveCard\",\
+                        \"body\": [ { \"type\": \"TextBlock\", \"id\": \"nested\", \"text\": \"Nested\" } ]\
+                    }\
+                }\
+            ]\
+        }";
+
+    TEST_CLASS(ElementIdIndexTest)
+    {
+    public:
+        TEST_METHOD(IndexBuiltWhileParsingTest)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(c_cardToIndex, "1.5")->GetAdaptiveCard();
+
+            auto container = card->GetBody().at(0);
+            Assert::IsTrue(card->GetElementById("container") == container);
+            Assert::IsTrue(card->GetElementById("input") != nullptr);
+            Assert::AreEqual(std::string("column"), card->GetElementById("column")->GetId());
+            Assert::IsTrue(card->GetElementById("showCard") == card->GetActions().at(0));
+            Assert::IsTrue(card->GetElementById("missing") == nullptr);
+
+            // the fallback content shares its id with the container and is marked as fallback
+            const auto entries = card->GetIdIndex().FindAll("container");
+            Assert::AreEqual(size_t{2}, entries.size());
+            const auto fallbackEntry =
+                std::find_if(entries.cbegin(), entries.cend(), [](const auto& entry) { return entry.isFallback; });
+            Assert::IsTrue(fallbackEntry != entries.cend());
+            Assert::IsTrue(fallbackEntry->element.lock() == container->GetFallbackContent());
+
+            // the show card's elements are in the show card's index
+            Assert::IsTrue(card->GetElementById("nested") == nullptr);
+            auto showCard = std::static_pointer_cast<ShowCardAction>(card->GetActions().at(0))->GetCard();
+            Assert::IsTrue(showCard->GetElementById("nested") == showCard->GetBody().at(0));
+
+            // container, its fallback, column, input and showCard
+            Assert::AreEqual(size_t{5}, card->GetIdIndex().GetSize());
+        }
+
+        TEST_METHOD(IndexFollowsChangesTest)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(c_cardToIndex, "1.5")->GetAdaptiveCard();
+
+            auto container = std::static_pointer_cast<Container>(card->GetBody().at(0));
+            card->GetBody().clear();
+            Assert::IsTrue(card->GetElementById("container") == nullptr);
+            Assert::IsTrue(card->GetElementById("input") == nullptr);
+            Assert::IsTrue(card->GetIdIndex().FindAll("container").empty());
+
+            auto textBlock = std::make_shared<TextBlock>();
+            textBlock->SetId("added");
+            container->GetItems().push_back(textBlock);
+            card->GetBody().push_back(container);
+            Assert::IsTrue(card->GetElementById("added") == textBlock);
+            Assert::IsTrue(card->GetElementById("input") != nullptr);
+
+            textBlock->SetId("renamed");
+            Assert::IsTrue(card->GetElementById("added") == nullptr);
+            Assert::IsTrue(card->GetElementById("renamed") == textBlock);
+
+            auto column = std::static_pointer_cast<Column>(card->GetElementById("column"));
+            auto columnItem = std::make_shared<TextBlock>();
+            columnItem->SetId("inColumn");
+            column->GetItems().push_back(columnItem);
+            Assert::IsTrue(card->GetElementById("inColumn") == columnItem);
+            column->GetItems().clear();
+            Assert::IsTrue(card->GetElementById("inColumn") == nullptr);
+            Assert::IsTrue(card->GetElementById("input") == nullptr);
+
+            auto selectAction = std::make_shared<ShowCardAction>();
+            selectAction->SetId("select");
+            card->SetSelectAction(selectAction);
+            Assert::IsTrue(card->GetElementById("select") == selectAction);
+            card->SetSelectAction(nullptr);
+            Assert::IsTrue(card->GetElementById("select") == nullptr);
+
+            // the show card's elements are in the index of the card it's given
+            auto showCardAction = std::static_pointer_cast<ShowCardAction>(card->GetActions().at(0));
+            auto replacement = std::make_shared<AdaptiveCard>();
+            auto replacementItem = std::make_shared<TextBlock>();
+            replacementItem->SetId("replacement");
+            replacement->GetBody().push_back(replacementItem);
+            showCardAction->SetCard(replacement);
+            Assert::IsTrue(showCardAction->GetCard()->GetElementById("replacement") == replacementItem);
+            Assert::IsTrue(card->GetElementById("replacement") == nullptr);
+            Assert::IsTrue(card->GetElementById("showCard") == showCardAction);
+
+            // an element replaced in place, or moved to another card, isn't found where it was
+            auto replacedItem = std::make_shared<TextBlock>();
+            replacedItem->SetId("renamed");
+            auto renamed = container->GetItems().back();
+            container->GetItems().back() = replacedItem;
+            Assert::IsTrue(card->GetElementById("renamed") == replacedItem);
+            auto otherCard = std::make_shared<AdaptiveCard>();
+            otherCard->GetBody().push_back(replacedItem);
+            container->GetItems().pop_back();
+            Assert::IsTrue(card->GetElementById("renamed") == nullptr);
+            Assert::IsTrue(otherCard->GetElementById("renamed") == replacedItem);
+            container->GetItems().push_back(renamed);
+
+            // a copy of the card has its own index
+            AdaptiveCard copy = *card;
+            copy.GetBody().clear();
+            Assert::IsTrue(copy.GetElementById("renamed") == nullptr);
+            Assert::IsTrue(card->GetElementById("renamed") == textBlock);
+        }
+
+        // Times lookups on a card of 500 elements with ids, as they are and after changing another card and then this
+        // one; only the lookup after a change to this card that moves the element walks it
+        TEST_METHOD(LookupBenchmark)
+        {
+            constexpr int elementCount = 500;
+            constexpr int lookups = 10000;
+            auto card = std::make_shared<AdaptiveCard>();
+            auto container = std::make_shared<Container>();
+            for (int i = 0; i < elementCount; ++i)
+            {
+                auto textBlock = std::make_shared<TextBlock>();
+                textBlock->SetId("text" + std::to_string(i));
+                container->GetItems().push_back(textBlock);
+            }
+            card->GetBody().push_back(container);
+            auto otherCard = std::make_shared<AdaptiveCard>();
+            const std::string lastId = "text" + std::to_string(elementCount - 1);
+            Assert::IsTrue(card->GetElementById(lastId) != nullptr);
+
+            const auto time = [&](const std::function<void()>& change) {
+                const auto start = std::chrono::steady_clock::now();
+                for (int i = 0; i < lookups; ++i)
+                {
+                    change();
+                    Assert::IsTrue(card->GetElementById(lastId) != nullptr);
+                }
+                const auto end = std::chrono::steady_clock::now();
+                return std::to_string(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / lookups);
+            };
+
+            const auto unchanged = time([]() {});
+            const auto otherCardChanged = time([&]() { otherCard->GetBody().clear(); });
+            // a first item is added and removed before each lookup, so the element is never where it was indexed
+            const auto moved = time([&]() {
+                auto& items = container->GetItems();
+                if (items.front()->GetId().empty())
+                {
+                    items.erase(items.begin());
+                }
+                else
+                {
+                    items.insert(items.begin(), std::make_shared<TextBlock>());
+                }
+            });
+            Logger::WriteMessage(("GetElementById, " + std::to_string(elementCount) + " elements: " + unchanged +
+                                  "ns, after a change to another card " + otherCardChanged +
+                                  "ns, after the element moved " + moved + "ns")
+                                     .c_str());
+        }
+
+        TEST_METHOD(IndexDroppedWhenParsingThrowsTest)
+        {
+            const std::string cardWithCollision =
+                "{\
+                    \"type\": \"AdaptiveCard\",\
+                    \"version\": \"1.5\",\
+                    \"body\": [\
+                        { \"type\": \"TextBlock\", \"id\": \"same\", \"text\": \"One\" },\
+                        { \"type\": \"TextBlock\", \"id\": \"same\", \"text\": \"Two\" }\
+                    ]\
+                }";
+
+            ParseContext context;
+            Assert::ExpectException<AdaptiveCardParseException>(
+                [&]() { AdaptiveCard::DeserializeFromString(cardWithCollision, "1.5", context); });
+
+            // the context is left as it was: the next card parsed with it gets an index of its own elements only
+            auto card = AdaptiveCard::DeserializeFromString(c_cardToIndex, "1.5", context)->GetAdaptiveCard();
+            Assert::IsTrue(card->GetElementById("same") == nullptr);
+            Assert::IsTrue(card->GetElementById("input") != nullptr);
+        }
+    };
+}
@@ -0,0 +1,145 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "ElementVisitor.h"
+#include "Inline.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    const std::string c_cardToWalk =
+        "{\
+            \"type\": \"AdaptiveCard\",\
+            \"version\": \"1.5\",\
+            \"body\": [\
+                {\
+                    \"type\": \"Container\",\
+                    \"id\": \"container\",\
+                    \"items\": [\
+                        {\
+                            \"type\": \"RichTextBlock\",\
+                            \"id\": \"richText\",\
+                            \"inlines\": [ \"one\", \"two\" ]\
+                        }\
+                    ],\
+                    \"fallback\": { \"type\": \"TextBlock\", \"id\": \"fallback\", \"text\": \"Fallback\" }\
+                },\
+                {\
+                    \"type\": \"TextBlock\",\
+                    \"id\": \"last\",\
+                    \"text\": \"Last\"\
+                }\
+            ],\
+            \"actions\": [\
+                {\
+                    \"type\": \"Action.ShowCard\",\
+                    \"id\": \"showCard\",\
+                    \"card\": {\
+                        \"type\": \"AdaptiveCard\",\
+                        \"body\": [ { \"type\": \"TextBlock\", \"id\": \"nested\", \"text\": \"Nested\" } ]\
+                    }\
+                }\
+            ]\
+        }";
+
+    // Records the hooks called, and skips or stops at the element with the given id
+    class RecordingVisitor : public ElementVisitor
+    {
+    public:
+        std::vector<std::string> visits;
+        std::string skipId;
+        std::string stopId;
+
+        VisitResult PreVisitCard(AdaptiveCard& /*card*/) override
+        {
+            visits.push_back("card");
+            return VisitResult::Continue;
+        }
+
+        VisitResult PostVisitCard(AdaptiveCard& /*card*/) override
+        {
+            visits.push_back("/card");
+            return VisitResult::Continue;
+        }
+
+        VisitResult PreVisitElement(BaseCardElement& element, WalkPosition position) override
+        {
+            visits.push_back((position == WalkPosition::Fallback ? "fallback:" : "") + element.GetId());
+            return ResultFor(element.GetId());
+        }
+
+        VisitResult PostVisitElement(BaseCardElement& element, WalkPosition /*position*/) override
+        {
+            visits.push_back("/" + element.GetId());
+            return VisitResult::Continue;
+        }
+
+        VisitResult PreVisitAction(BaseActionElement& action, WalkPosition /*position*/) override
+        {
+            visits.push_back(action.GetId());
+            return ResultFor(action.GetId());
+        }
+
+        VisitResult VisitInline(Inline& /*inlineElement*/) override
+        {
+            visits.push_back("inline");
+            return VisitResult::Continue;
+        }
+
+    private:
+        VisitResult ResultFor(const std::string& id) const
+        {
+            if (id == stopId)
+            {
+                return VisitResult::Stop;
+            }
+            return (id == skipId) ? VisitResult::SkipChildren : VisitResult::Continue;
+        }
+    };
+
+    TEST_CLASS(ElementVisitorTest)
+    {
+    public:
+        TEST_METHOD(WalkOrderTest)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(c_cardToWalk, "1.5")->GetAdaptiveCard();
+
+            RecordingVisitor visitor;
+            Assert::IsTrue(Walk(*card, visitor));
+
+            const std::vector<std::string> expected = {
+                "card", "container", "richText", "inline", "inline", "/richText", "fallback:fallback", "/fallback",
+                "/container", "last", "/last", "showCard", "card", "nested", "/nested", "/card", "/card"};
+            Assert::IsTrue(expected == visitor.visits);
+        }
+
+        TEST_METHOD(SkipChildrenTest)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(c_cardToWalk, "1.5")->GetAdaptiveCard();
+
+            RecordingVisitor visitor;
+            visitor.skipId = "container";
+            Assert::IsTrue(Walk(*card, visitor));
+
+            // neither the items nor the fallback of the container are walked, but its post-visit hook is still called
+            const std::vector<std::string> expected = {
+                "card", "container", "/container", "last", "/last", "showCard", "card", "nested", "/nested", "/card", "/card"};
+            Assert::IsTrue(expected == visitor.visits);
+        }
+
+        TEST_METHOD(StopTest)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(c_cardToWalk, "1.5")->GetAdaptiveCard();
+
+            RecordingVisitor visitor;
+            visitor.stopId = "richText";
+            Assert::IsFalse(Walk(*card, visitor));
+
+            const std::vector<std::string> expected = {"card", "container", "richText"};
+            Assert::IsTrue(expected == visitor.visits);
+        }
+    };
+}
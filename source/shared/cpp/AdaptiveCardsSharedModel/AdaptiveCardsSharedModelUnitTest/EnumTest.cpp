@@ -2,6 +2,8 @@
 // Licensed under the MIT License.
 #include "stdafx.h"
 
+#include <chrono>
+
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace AdaptiveCards;
 using namespace std::string_literals;
@@ -12,6 +14,8 @@ using namespace std::string_literals;
 #define ENUM_TO_FROM_STRING_TEST(ENUMNAME, VALIDVALUE, VALIDSTRING) \
         Assert::AreEqual(ENUMNAME##ToString(VALIDVALUE), VALIDSTRING); \
         Assert::IsTrue(ENUMNAME##FromString(VALIDSTRING) == VALIDVALUE); \
+        Assert::IsTrue(ENUMNAME##TryFromString(VALIDSTRING) == VALIDVALUE); \
+        Assert::IsFalse(ENUMNAME##TryFromString("This is invalid.").has_value()); \
 
 #define ENUM_TEST(ENUMNAME, VALIDVALUE, VALIDSTRING) \
     ENUM_TEST_START(ENUMNAME)                                           \
@@ -29,6 +33,7 @@ using namespace std::string_literals;
         for (const auto& key : reverseMap)                              \
         {                                                               \
             Assert::IsTrue(ENUMNAME##FromString(key.first) == key.second); \
+            Assert::IsTrue(ENUMNAME##TryFromString(key.first) == key.second); \
         }                                                               \
     }                                                                   \
 
@@ -58,5 +63,73 @@ namespace AdaptiveCardsSharedModelUnitTest
         ENUM_TEST_WITH_REVERSE_MAP(TextSize, TextSize::Large, "Large"s, {{"Normal", TextSize::Default}});
         ENUM_TEST_WITH_REVERSE_MAP(TextWeight, TextWeight::Bolder, "Bolder"s, {{"Normal", TextWeight::Default}});
         ENUM_TEST(VerticalContentAlignment, VerticalContentAlignment::Center, "Center"s);
+
+        TEST_METHOD(CaseInsensitiveFromStringTest)
+        {
+            Assert::IsTrue(AdaptiveCardSchemaKeyTryFromString("ACCENT") == AdaptiveCardSchemaKey::Accent);
+            Assert::IsTrue(AdaptiveCardSchemaKeyTryFromString("minheight") == AdaptiveCardSchemaKey::MinHeight);
+            Assert::IsTrue(CardElementTypeTryFromString("input.text") == CardElementType::TextInput);
+            Assert::IsTrue(TextSizeTryFromString("NORMAL") == TextSize::Default);
+
+            // a prefix of a known value is not a match
+            Assert::IsFalse(AdaptiveCardSchemaKeyTryFromString("minHeigh").has_value());
+            Assert::IsFalse(AdaptiveCardSchemaKeyTryFromString("").has_value());
+        }
+
+        TEST_METHOD(LookupBenchmark)
+        {
+            constexpr int repetitions = 200;
+            std::vector<std::string> hits;
+            std::vector<std::string> misses;
+            for (const auto& entry : EnumHelpers::getAdaptiveCardSchemaKeyEnum().entries())
+            {
+                hits.push_back(entry.second);
+                misses.push_back(entry.second + "x");
+            }
+
+            const auto time = [&](const std::function<size_t(const std::string&)>& lookup,
+                                  const std::vector<std::string>& strings) {
+                size_t found = 0;
+                const auto start = std::chrono::steady_clock::now();
+                for (int i = 0; i < repetitions; ++i)
+                {
+                    for (const auto& string : strings)
+                    {
+                        found += lookup(string);
+                    }
+                }
+                const auto end = std::chrono::steady_clock::now();
+                Assert::AreEqual(&strings == &hits ? strings.size() * repetitions : size_t{0}, found);
+                return std::to_string(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() /
+                                      (repetitions * strings.size())) +
+                       "ns";
+            };
+
+            const auto tryFromString = [](const std::string& string) {
+                return size_t{AdaptiveCardSchemaKeyTryFromString(string).has_value()};
+            };
+            // what a caller that only has FromString has to do for a string that may not map
+            const auto fromString = [](const std::string& string) {
+                try
+                {
+                    AdaptiveCardSchemaKeyFromString(string);
+                    return size_t{1};
+                }
+                catch (const std::out_of_range&)
+                {
+                    return size_t{0};
+                }
+            };
+            const auto toString = [](const std::string& string) {
+                return size_t{AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKeyFromString(string)) == string};
+            };
+
+            Logger::WriteMessage(("AdaptiveCardSchemaKey, " + std::to_string(hits.size()) +
+                                  " strings: TryFromString hit " + time(tryFromString, hits) + ", miss " +
+                                  time(tryFromString, misses) +
+                                  "; FromString hit " + time(fromString, hits) + ", miss caught " +
+                                  time(fromString, misses) + "; FromString and ToString " + time(toString, hits))
+                                     .c_str());
+        }
     };
 }
@@ -0,0 +1,211 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "MarkDownParser.h"
+#include <chrono>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    const std::vector<std::string> markDownDocumentTestCorpus = {
+        "Hello world",
+        "Your **flight** to *Seattle* has been _delayed_ by 45 minutes.",
+        "Click [here](https://adaptivecards.io/designer) to open the **designer**.",
+        "- Item one\r- Item **two**\r- Item [three](https://example.com)",
+        "1. First step\n2. Second *step*\n3. Third step",
+        "Meeting with Matt & Lei at 10:00 <b>room 42</b>",
+        "A longer paragraph of plain text, with no markdown at all, describing an event or a notification in a sentence or two.",
+        "***Important:*** please review the __quarterly__ report before *Friday*, and reply to [the thread](https://example.com/?a=1&b=2) with comments.\n\nThanks!",
+        "Status: **Approved** by _J. Smith_ on {{DATE(2017-02-14T06:08:39Z, SHORT)}}",
+        "- **Build** passed\n- *Tests* 1234 of 1240 passed\n- [Logs](https://ci.example.com/build/9876)\n\nSee details above."};
+
+    std::string UnescapeHtml(const std::string& html)
+    {
+        std::string text;
+        for (size_t i = 0; i < html.size(); ++i)
+        {
+            if (html[i] != '&')
+            {
+                text += html[i];
+                continue;
+            }
+
+            const auto end = html.find(';', i);
+            const auto entity = html.substr(i, end - i + 1);
+            text += (entity == "&lt;") ? '<' : (entity == "&gt;") ? '>' : (entity == "&quot;") ? '"' : '&';
+            i = end;
+        }
+        return text;
+    }
+
+    // Reads the runs of text back from the HTML, as a renderer that builds its text from HTML does
+    std::vector<MarkDownRun> ReadRunsFromHtml(const std::string& html)
+    {
+        std::vector<MarkDownRun> runs;
+        int boldCount = 0;
+        int italicCount = 0;
+        std::vector<std::string> links;
+        bool isNewBlock = true;
+        for (size_t i = 0; i < html.size();)
+        {
+            if (html[i] == '<')
+            {
+                const auto end = html.find('>', i);
+                const auto tag = html.substr(i + 1, end - i - 1);
+                if (tag == "strong" || tag == "/strong")
+                {
+                    boldCount += (tag[0] == '/') ? -1 : 1;
+                }
+                else if (tag == "em" || tag == "/em")
+                {
+                    italicCount += (tag[0] == '/') ? -1 : 1;
+                }
+                else if (tag.rfind("a href=\"", 0) == 0)
+                {
+                    links.push_back(UnescapeHtml(tag.substr(8, tag.size() - 9)));
+                }
+                else if (tag == "/a")
+                {
+                    links.pop_back();
+                }
+                else
+                {
+                    isNewBlock = true;
+                }
+                i = end + 1;
+                continue;
+            }
+
+            const auto end = std::min(html.find('<', i), html.size());
+            MarkDownRun run{UnescapeHtml(html.substr(i, end - i)), boldCount > 0, italicCount > 0, !links.empty(), links.empty() ? "" : links.back()};
+            if (!isNewBlock && runs.back().isBold == run.isBold && runs.back().isItalic == run.isItalic &&
+                runs.back().isLink == run.isLink && runs.back().linkDestination == run.linkDestination)
+            {
+                runs.back().text += run.text;
+            }
+            else
+            {
+                runs.push_back(std::move(run));
+            }
+            isNewBlock = false;
+            i = end;
+        }
+        return runs;
+    }
+
+    void AssertSameRuns(const std::vector<MarkDownRun>& expected, const std::vector<MarkDownRun>& actual)
+    {
+        Assert::AreEqual(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            Assert::AreEqual(expected[i].text, actual[i].text);
+            Assert::AreEqual(expected[i].isBold, actual[i].isBold);
+            Assert::AreEqual(expected[i].isItalic, actual[i].isItalic);
+            Assert::AreEqual(expected[i].isLink, actual[i].isLink);
+            Assert::AreEqual(expected[i].linkDestination, actual[i].linkDestination);
+        }
+    }
+
+    TEST_CLASS(MarkDownDocumentTest)
+    {
+    public:
+        TEST_METHOD(RunsTest)
+        {
+            MarkDownParser parser("Your **flight** to *Seattle* & <b>x</b>");
+            const auto document = parser.TransformToDocument();
+            Assert::IsTrue(parser.HasHtmlTags());
+            Assert::IsTrue(parser.IsEscaped());
+
+            Assert::AreEqual(size_t{1}, document.GetBlocks().size());
+            Assert::IsTrue(MarkDownBlockType::Paragraph == document.GetBlocks()[0].type);
+            Assert::AreEqual(size_t{5}, document.GetBlocks()[0].runCount);
+
+            // text is as written, not escaped
+            const auto& runs = document.GetRuns();
+            Assert::AreEqual(std::string("flight"), runs[1].text);
+            Assert::IsTrue(runs[1].isBold && !runs[1].isItalic);
+            Assert::AreEqual(std::string("Seattle"), runs[3].text);
+            Assert::IsTrue(runs[3].isItalic && !runs[3].isBold);
+            Assert::AreEqual(std::string(" & <b>x</b>"), runs[4].text);
+        }
+
+        TEST_METHOD(LinkTest)
+        {
+            const auto document = MarkDownParser("Click [here *now*](https://example.com/?a=1&b=2) to see").TransformToDocument();
+            const auto& runs = document.GetRuns();
+            Assert::AreEqual(size_t{4}, runs.size());
+            Assert::IsFalse(runs[0].isLink);
+            Assert::AreEqual(std::string("here "), runs[1].text);
+            Assert::IsTrue(runs[1].isLink);
+            Assert::AreEqual(std::string("https://example.com/?a=1&b=2"), runs[1].linkDestination);
+            Assert::IsTrue(runs[2].isLink && runs[2].isItalic);
+            Assert::AreEqual(std::string(" to see"), runs[3].text);
+        }
+
+        TEST_METHOD(ListTest)
+        {
+            const auto document = MarkDownParser("Steps:\r3. **one**\r4. two\r\r- a\r- - b").TransformToDocument();
+            const auto& blocks = document.GetBlocks();
+            Assert::AreEqual(size_t{6}, blocks.size());
+
+            Assert::IsTrue(MarkDownBlockType::Paragraph == blocks[0].type);
+            Assert::IsTrue(MarkDownBlockType::OrderedListItem == blocks[1].type);
+            Assert::AreEqual(std::string("3"), blocks[1].listStart);
+            Assert::AreEqual(0U, blocks[1].itemIndex);
+            Assert::AreEqual(1U, blocks[2].itemIndex);
+            Assert::IsTrue(document.GetRuns()[blocks[1].firstRun].isBold);
+
+            // an item nested in another starts a list of its own
+            Assert::IsTrue(MarkDownBlockType::ListItem == blocks[3].type);
+            Assert::AreEqual(0U, blocks[3].itemIndex);
+            Assert::AreEqual(1U, blocks[4].itemIndex);
+            Assert::AreEqual(0U, blocks[4].depth);
+            Assert::AreEqual(size_t{0}, blocks[4].runCount);
+            Assert::AreEqual(1U, blocks[5].depth);
+            Assert::AreEqual(0U, blocks[5].itemIndex);
+            Assert::AreEqual(std::string("b"), document.GetRuns()[blocks[5].firstRun].text);
+        }
+
+        // Building the document is what a renderer would otherwise do by writing the HTML and reading it back
+        TEST_METHOD(SameAsHtmlBenchmark)
+        {
+            for (const auto& text : markDownDocumentTestCorpus)
+            {
+                MarkDownParser htmlParser(text);
+                const auto expected = ReadRunsFromHtml(htmlParser.TransformToHtml());
+                MarkDownParser documentParser(text);
+                AssertSameRuns(expected, documentParser.TransformToDocument().GetRuns());
+                Assert::AreEqual(htmlParser.HasHtmlTags(), documentParser.HasHtmlTags());
+            }
+
+            constexpr int repetitions = 1000;
+            size_t runCount = 0;
+            const auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < repetitions; ++i)
+            {
+                for (const auto& text : markDownDocumentTestCorpus)
+                {
+                    runCount += MarkDownParser(text).TransformToDocument().GetRuns().size();
+                }
+            }
+            const auto documentEnd = std::chrono::steady_clock::now();
+            for (int i = 0; i < repetitions; ++i)
+            {
+                for (const auto& text : markDownDocumentTestCorpus)
+                {
+                    runCount -= ReadRunsFromHtml(MarkDownParser(text).TransformToHtml()).size();
+                }
+            }
+            const auto htmlEnd = std::chrono::steady_clock::now();
+            Assert::AreEqual(size_t{0}, runCount);
+
+            const auto documentTime = std::chrono::duration_cast<std::chrono::microseconds>(documentEnd - start).count();
+            const auto htmlTime = std::chrono::duration_cast<std::chrono::microseconds>(htmlEnd - documentEnd).count();
+            Logger::WriteMessage(("MarkDownDocument: " + std::to_string(documentTime) + "us, HTML read back into runs: " +
+                                  std::to_string(htmlTime) + "us")
+                                     .c_str());
+        }
+    };
+}
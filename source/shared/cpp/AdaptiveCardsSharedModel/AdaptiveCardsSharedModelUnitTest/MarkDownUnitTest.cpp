@@ -808,6 +808,49 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::AreEqual<std::string>("<p>Hello***World***</p>", MarkDownParser("Hello***World***").TransformToHtml());
         }
 
+        TEST_METHOD(LinkTextAndDestinationTest)
+        {
+            // the inner link is captured, so the outer one is left as text
+            MarkDownParser nested("[a [b](c) d](e)");
+            Assert::AreEqual<std::string>("<p>[a <a href=\"c\">b</a> d](e)</p>", nested.TransformToHtml());
+            Assert::IsTrue(nested.HasHtmlTags());
+
+            // emphasis is matched in the text of a link, but not in its destination
+            Assert::AreEqual<std::string>("<p><a href=\"*b*\"><strong>a</strong></a></p>", MarkDownParser("[**a**](*b*)").TransformToHtml());
+        }
+
+        TEST_METHOD(EscapedKeywordsTest)
+        {
+            MarkDownParser parser("\\*not bold\\* and \\[not a link]");
+            Assert::AreEqual<std::string>("<p>\\*not bold\\* and [not a link]</p>", parser.TransformToHtml());
+            Assert::IsFalse(parser.HasHtmlTags());
+
+            Assert::AreEqual<std::string>("<p><em>a <strong>b</strong> c</em></p>", MarkDownParser("*a **b** c*").TransformToHtml());
+        }
+
+        TEST_METHOD(PlainTextTest)
+        {
+            // text without markdown skips the scanner, and is written just as the scanner would write it
+            const std::vector<std::string> plainTexts = {
+                "3 new messages", "2020-01-01 (updated)", "Total: 1.5 - 2 hours", "a < b & \"c\"", "1.5", "-1 degrees"};
+            for (const auto& text : plainTexts)
+            {
+                Assert::IsFalse(TextFeatures::Classify(text).mayHaveMarkDown);
+
+                std::string expected;
+                MarkDownScanner(text).WriteHtml(expected);
+                MarkDownParser parser(text);
+                Assert::AreEqual(expected, parser.TransformToHtml());
+                Assert::IsFalse(parser.HasHtmlTags());
+            }
+
+            // a list can start a block after ']' or ')', or after a number that isn't a list's
+            for (const std::string text : {"*a*", "a\rb", "- a", "10. a", "(a)- b", "1- a", "a\\)"})
+            {
+                Assert::IsTrue(TextFeatures::Classify(text).mayHaveMarkDown);
+            }
+        }
+
 
     };
 }
@@ -10,6 +10,7 @@
 #include "Media.h"
 #include "OpenUrlAction.h"
 #include "ParseContext.h"
+#include "ParseUtil.h"
 #include "ShowCardAction.h"
 #include "SubmitAction.h"
 #include "TextBlock.h"
@@ -17,6 +18,9 @@
 #include "ToggleInput.h"
 #include "UnknownElement.h"
 
+#include <chrono>
+#include <thread>
+
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace AdaptiveCards;
 using namespace std::string_literals;
@@ -346,6 +350,229 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::AreEqual(roundTrippedShowCard->GetActions()[0]->GetTitle(), "Neat!"s);
         }
 
+        TEST_METHOD(DeferredShowCardTest)
+        {
+            std::string cardWithShowCard = "{\
+                \"type\" : \"AdaptiveCard\",\
+                \"version\" : \"1.2\",\
+                \"actions\": [\
+                    {\
+                        \"type\": \"Action.ShowCard\",\
+                        \"title\" : \"Action.ShowCard\",\
+                        \"card\" : {\
+                            \"type\": \"AdaptiveCard\",\
+                            \"body\" : [\
+                                {\
+                                    \"type\": \"TextBlock\",\
+                                    \"text\" : \"What do you think?\"\
+                                },\
+                                {\
+                                    \"type\": \"Image\",\
+                                    \"url\" : \"http://example.com/image.png\",\
+                                    \"width\" : \"12 px\"\
+                                }\
+                            ]\
+                        }\
+                    }\
+                ]\
+            }";
+
+            ParseContext eagerContext;
+            eagerContext.SetLanguage("fr");
+            auto eagerResult = AdaptiveCard::DeserializeFromString(cardWithShowCard, "1.2", eagerContext);
+            Assert::IsFalse(eagerResult->GetWarnings().empty());
+
+            ParseContext deferredContext;
+            deferredContext.SetLanguage("fr");
+            deferredContext.SetDeferShowCardParsing(true);
+            auto deferredResult = AdaptiveCard::DeserializeFromString(cardWithShowCard, "1.2", deferredContext);
+            Assert::IsTrue(deferredResult->GetWarnings().empty());
+
+            auto showCardAction = std::static_pointer_cast<ShowCardAction>(deferredResult->GetAdaptiveCard()->GetActions()[0]);
+            Assert::IsFalse(showCardAction->IsCardParsed());
+
+            // the card is parsed on first use, with the version and language it would have inherited
+            auto showCard = showCardAction->GetCard();
+            Assert::IsTrue(showCardAction->IsCardParsed());
+            Assert::IsTrue(showCard == showCardAction->GetCard());
+            Assert::AreEqual("1.2"s, showCard->GetVersion());
+            Assert::AreEqual("fr"s, std::static_pointer_cast<TextBlock>(showCard->GetBody()[0])->GetLanguage());
+
+            const auto warnings = showCardAction->GetCardWarnings();
+            Assert::AreEqual((size_t)1, warnings.size());
+            Assert::IsTrue(warnings[0]->GetStatusCode() == WarningStatusCode::InvalidDimensionSpecified);
+
+            Assert::AreEqual(eagerResult->GetAdaptiveCard()->Serialize(), deferredResult->GetAdaptiveCard()->Serialize());
+        }
+
+        TEST_METHOD(DeferredShowCardArenaTest)
+        {
+            std::string cardWithShowCard = "{\
+                \"type\" : \"AdaptiveCard\",\
+                \"version\" : \"1.2\",\
+                \"actions\": [\
+                    {\
+                        \"type\": \"Action.ShowCard\",\
+                        \"title\" : \"Action.ShowCard\",\
+                        \"card\" : {\
+                            \"type\": \"AdaptiveCard\",\
+                            \"body\" : [\
+                                {\
+                                    \"type\": \"TextBlock\",\
+                                    \"text\" : \"What do you think?\"\
+                                }\
+                            ]\
+                        }\
+                    }\
+                ]\
+            }";
+
+            const auto arena = std::make_shared<ParseArena>();
+            ParseContext context;
+            context.SetArena(arena);
+            context.SetDeferShowCardParsing(true);
+            auto result = AdaptiveCard::DeserializeFromString(cardWithShowCard, "1.2", context);
+            auto showCardAction = std::static_pointer_cast<ShowCardAction>(result->GetAdaptiveCard()->GetActions()[0]);
+
+            // a language set before first use is picked up by the parse
+            showCardAction->SetLanguage("de");
+
+            // the card is parsed into an arena of its own, so the parse's arena can be reused meanwhile
+            const auto bytesAllocated = arena->GetBytesAllocated();
+            std::vector<std::shared_ptr<AdaptiveCard>> cards(4);
+            std::vector<std::thread> threads;
+            for (auto& card : cards)
+            {
+                threads.emplace_back([&]() { card = showCardAction->GetCard(); });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            Assert::AreEqual(bytesAllocated, arena->GetBytesAllocated());
+            for (const auto& card : cards)
+            {
+                Assert::IsTrue(card == cards[0]);
+            }
+            Assert::AreEqual("de"s, std::static_pointer_cast<TextBlock>(cards[0]->GetBody()[0])->GetLanguage());
+        }
+
+        // every level holds an image with an invalid width and a show card with the next level in it
+        static Json::Value MakeNestedShowCard(int depth)
+        {
+            Json::Value card;
+            for (int level = 0; level < depth; ++level)
+            {
+                Json::Value image;
+                image["type"] = "Image";
+                image["url"] = "http://example.com/image.png";
+                image["width"] = "12 px";
+
+                Json::Value outerCard;
+                outerCard["type"] = "AdaptiveCard";
+                outerCard["version"] = "1.2";
+                outerCard["body"].append(image);
+                if (!card.isNull())
+                {
+                    Json::Value showCardAction;
+                    showCardAction["type"] = "Action.ShowCard";
+                    showCardAction["title"] = "More";
+                    showCardAction["card"] = card;
+                    outerCard["actions"].append(showCardAction);
+                }
+                card = outerCard;
+            }
+            return card;
+        }
+
+        TEST_METHOD(NestedShowCardWarningsTest)
+        {
+            // each warning is reported once, however deep the card it came from
+            ParseContext context;
+            auto parseResult = AdaptiveCard::Deserialize(MakeNestedShowCard(6), "1.2", context);
+            Assert::AreEqual((size_t)6, parseResult->GetWarnings().size());
+            Assert::AreEqual((size_t)6, context.warnings.size());
+        }
+
+        TEST_METHOD(NestedShowCardWarningsBenchmark)
+        {
+            constexpr int iterations = 2000;
+            std::string message = "Nested ShowCard card with one warning per level:";
+            for (const int depth : {1, 6})
+            {
+                const auto card = MakeNestedShowCard(depth);
+                size_t warningCount = 0;
+                const auto start = std::chrono::steady_clock::now();
+                for (int i = 0; i < iterations; ++i)
+                {
+                    ParseContext context;
+                    warningCount = AdaptiveCard::Deserialize(card, "1.2", context)->GetWarnings().size();
+                }
+                const auto end = std::chrono::steady_clock::now();
+
+                // a level's warnings used to be reported again by every level above it
+                Assert::AreEqual(static_cast<size_t>(depth), warningCount);
+                message += " depth " + std::to_string(depth) + " " +
+                           std::to_string(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() /
+                                          iterations / 1000) +
+                           "us/card, " + std::to_string(warningCount) + " warnings;";
+            }
+            Logger::WriteMessage(message.c_str());
+        }
+
+        static Json::Value MakeNestedContainers(int depth)
+        {
+            Json::Value element;
+            element["type"] = "TextBlock";
+            element["text"] = "Innermost";
+            for (int level = 0; level < depth; ++level)
+            {
+                Json::Value container;
+                container["type"] = "Container";
+                container["items"].append(element);
+                element = container;
+            }
+
+            Json::Value card;
+            card["type"] = "AdaptiveCard";
+            card["version"] = "1.5";
+            card["body"].append(element);
+            return card;
+        }
+
+        TEST_METHOD(NestedContainersBenchmark)
+        {
+            constexpr int iterations = 500;
+            std::string message = "Containers nested in each other:";
+            for (const int depth : {8, 16, 32, 64})
+            {
+                const auto card = MakeNestedContainers(depth);
+                std::shared_ptr<AdaptiveCard> parsedCard;
+                const auto start = std::chrono::steady_clock::now();
+                for (int i = 0; i < iterations; ++i)
+                {
+                    ParseContext context;
+                    parsedCard = AdaptiveCard::Deserialize(card, "1.5", context)->GetAdaptiveCard();
+                }
+                const auto end = std::chrono::steady_clock::now();
+
+                // GetArray used to copy the items of every container, and so everything inside it, at each level
+                auto element = parsedCard->GetBody().at(0);
+                for (int level = 0; level < depth; ++level)
+                {
+                    element = std::static_pointer_cast<Container>(element)->GetItems().at(0);
+                }
+                Assert::IsTrue(element->GetElementType() == CardElementType::TextBlock);
+
+                message += " depth " + std::to_string(depth) + " " +
+                           std::to_string(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() /
+                                          iterations / 1000) +
+                           "us/card;";
+            }
+            Logger::WriteMessage(message.c_str());
+        }
+
         template<typename T>
             void runWrapTest(const std::vector<std::shared_ptr<BaseCardElement>> &body, int index, bool expectation)
         {
@@ -739,5 +966,74 @@ namespace AdaptiveCardsSharedModelUnitTest
             const auto serializedCard = card->SerializeToJsonValue();
             Assert::IsTrue(serializedCard["body"][0]["isMultiline"].asBool());
         }
+
+        TEST_METHOD(JsonWriterMatchesStreamWriterTest)
+        {
+            Json::Value json(Json::objectValue);
+            json["escapes"] = "quote\" backslash\\ tab\t newline\n bell\a slash/";
+            json["unicode"] = u8"caf\u00e9 \u20ac \U0001F600";
+            json["invalid"] = "\xff\xc3";
+            json["int"] = Json::Value::minLargestInt;
+            json["uint"] = Json::Value::maxLargestUInt;
+            json["real"] = 0.1;
+            json["whole"] = 2.0;
+            json["bool"] = false;
+            json["null"] = Json::Value();
+            json["emptyArray"] = Json::Value(Json::arrayValue);
+            json["emptyObject"] = Json::Value(Json::objectValue);
+            json["nested"]["b"].append(1);
+            json["nested"]["b"].append("two");
+            json["nested"]["a"] = -3;
+
+            Json::StreamWriterBuilder builder;
+            builder["commentStyle"] = "None";
+            builder["indentation"] = "";
+            const std::string expected = Json::writeString(builder, json) + "\n";
+            Assert::AreEqual(expected, ParseUtil::JsonToString(json));
+
+            const auto card = AdaptiveCard::DeserializeFromFile("EverythingBagel.json", "1.5")->GetAdaptiveCard();
+            std::string buffer = "prefix";
+            card->SerializeTo(buffer);
+            std::ostringstream stream;
+            card->SerializeTo(stream);
+            Assert::AreEqual("prefix" + Json::writeString(builder, card->SerializeToJsonValue()) + "\n", buffer);
+            Assert::AreEqual(card->Serialize(), stream.str());
+        }
+
+        // Records how much is written to a stream at once
+        class WriteSizeRecorder : public std::stringbuf
+        {
+        public:
+            std::vector<std::streamsize> writeSizes;
+
+        protected:
+            std::streamsize xsputn(const char* s, std::streamsize count) override
+            {
+                writeSizes.push_back(count);
+                return std::stringbuf::xsputn(s, count);
+            }
+        };
+
+        TEST_METHOD(JsonWrittenToStreamAsItsWrittenTest)
+        {
+            Json::Value json(Json::arrayValue);
+            for (int i = 0; i < 10000; ++i)
+            {
+                json.append("item " + std::to_string(i) + " of a large array");
+            }
+
+            WriteSizeRecorder recorder;
+            std::ostream stream(&recorder);
+            ParseUtil::WriteJson(json, stream);
+
+            std::string expected;
+            ParseUtil::WriteJson(json, expected);
+            Assert::AreEqual(expected, recorder.str());
+            Assert::IsTrue(recorder.writeSizes.size() > 1);
+            for (const auto size : recorder.writeSizes)
+            {
+                Assert::IsTrue(size < static_cast<std::streamsize>(expected.size() / 4));
+            }
+        }
     };
 }
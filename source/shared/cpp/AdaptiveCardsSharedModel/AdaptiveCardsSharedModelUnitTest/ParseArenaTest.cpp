@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "ParseArena.h"
+#include "ParseContext.h"
+#include "SharedAdaptiveCard.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    const std::string c_cardWithChoices =
+        "{\
+            \"type\": \"AdaptiveCard\",\
+            \"version\": \"1.2\",\
+            \"body\": [\
+                {\
+                    \"type\": \"TextBlock\",\
+                    \"text\": \"Pick one\"\
+                },\
+                {\
+                    \"type\": \"Input.ChoiceSet\",\
+                    \"id\": \"choice\",\
+                    \"choices\": [\
+                        { \"title\": \"Red\", \"value\": \"1\" },\
+                        { \"title\": \"Green\", \"value\": \"2\" }\
+                    ]\
+                }\
+            ],\
+            \"actions\": [\
+                {\
+                    \"type\": \"Action.Submit\",\
+                    \"title\": \"Send\"\
+                }\
+            ]\
+        }";
+
+    TEST_CLASS(ParseArenaTest)
+    {
+    public:
+        TEST_METHOD(AllocateRespectsAlignmentTest)
+        {
+            ParseArena arena(256);
+
+            // small requests share a chunk; one larger than the chunk gets its own
+            for (size_t alignment : {1, 2, 4, 8, 16, 32})
+            {
+                void* allocation = arena.Allocate(3, alignment);
+                Assert::AreEqual(size_t{0}, reinterpret_cast<uintptr_t>(allocation) % alignment);
+            }
+            Assert::AreEqual(size_t{1}, arena.GetChunkCount());
+
+            arena.Allocate(1000, 8);
+            Assert::AreEqual(size_t{2}, arena.GetChunkCount());
+            Assert::AreEqual(size_t{1018}, arena.GetBytesAllocated());
+        }
+
+        TEST_METHOD(CardOutlivesContextTest)
+        {
+            std::weak_ptr<ParseArena> weakArena;
+            std::shared_ptr<ParseResult> parseResult;
+            {
+                auto arena = std::make_shared<ParseArena>();
+                weakArena = arena;
+
+                ParseContext context;
+                context.SetArena(arena);
+                parseResult = AdaptiveCard::DeserializeFromString(c_cardWithChoices, "1.2", context);
+                Assert::IsTrue(arena->GetBytesAllocated() > 0);
+            }
+
+            // the elements keep the arena alive once the context and the caller have let go of it
+            Assert::IsFalse(weakArena.expired());
+
+            auto textBlock = std::static_pointer_cast<TextBlock>(parseResult->GetAdaptiveCard()->GetBody().at(0));
+            Assert::AreEqual(std::string("Pick one"), textBlock->GetText());
+
+            const auto withoutArena = AdaptiveCard::DeserializeFromString(c_cardWithChoices, "1.2");
+            Assert::AreEqual(withoutArena->GetAdaptiveCard()->Serialize(), parseResult->GetAdaptiveCard()->Serialize());
+
+            textBlock.reset();
+            parseResult.reset();
+            Assert::IsTrue(weakArena.expired());
+        }
+    };
+}
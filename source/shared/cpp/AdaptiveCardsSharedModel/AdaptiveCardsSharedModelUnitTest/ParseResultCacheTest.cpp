@@ -0,0 +1,101 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "ParseResultCache.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    const std::string c_simpleCard =
+        "{\
+            \"type\": \"AdaptiveCard\",\
+            \"version\": \"1.2\",\
+            \"body\": [\
+                {\
+                    \"type\": \"TextBlock\",\
+                    \"text\": \"Hello\"\
+                }\
+            ]\
+        }";
+
+    const std::string c_cardWithInvalidLanguage =
+        "{\
+            \"type\": \"AdaptiveCard\",\
+            \"version\": \"1.2\",\
+            \"lang\": \"not a language\",\
+            \"body\": []\
+        }";
+
+    TEST_CLASS(ParseResultCacheTest)
+    {
+    public:
+        TEST_METHOD(HitReturnsSharedResultTest)
+        {
+            ParseResultCache cache(1024 * 1024);
+            const auto first = cache.DeserializeFromString(c_simpleCard, "1.2");
+            const auto second = cache.DeserializeFromString(c_simpleCard, "1.2");
+            Assert::IsTrue(first == second);
+            Assert::AreEqual(size_t{1}, cache.GetHitCount());
+            Assert::AreEqual(size_t{1}, cache.GetMissCount());
+            Assert::AreEqual(size_t{1}, cache.GetEntryCount());
+
+            // a different renderer version or registration is a different entry
+            const auto otherVersion = cache.DeserializeFromString(c_simpleCard, "1.3");
+            Assert::IsFalse(first == otherVersion);
+
+            ParseContext context;
+            const auto otherRegistration = cache.DeserializeFromString(c_simpleCard, "1.2", context);
+            Assert::IsFalse(first == otherRegistration);
+            Assert::AreEqual(size_t{3}, cache.GetMissCount());
+            Assert::AreEqual(size_t{3}, cache.GetEntryCount());
+
+            cache.Clear();
+            Assert::AreEqual(size_t{0}, cache.GetEntryCount());
+            Assert::AreEqual(size_t{0}, cache.GetSizeInBytes());
+        }
+
+        TEST_METHOD(WarningsOnHitTest)
+        {
+            ParseResultCache cache(1024 * 1024);
+            ParseContext context;
+            cache.DeserializeFromString(c_cardWithInvalidLanguage, "1.2", context);
+            Assert::AreEqual(size_t{1}, context.warnings.size());
+
+            // the cached result has only its own warnings, and a hit reports them to the caller's context too
+            const auto cachedResult = cache.DeserializeFromString(c_cardWithInvalidLanguage, "1.2", context);
+            Assert::AreEqual(size_t{1}, cache.GetHitCount());
+            Assert::AreEqual(size_t{1}, cachedResult->GetWarnings().size());
+            Assert::AreEqual(size_t{2}, context.warnings.size());
+        }
+
+        TEST_METHOD(EvictionTest)
+        {
+            // room for one of these cards, but not two
+            ParseResultCache cache(c_simpleCard.size() * 6);
+
+            cache.DeserializeFromString(c_simpleCard, "1.2");
+            cache.DeserializeFromString(c_simpleCard, "1.3");
+            Assert::AreEqual(size_t{1}, cache.GetEntryCount());
+            Assert::IsTrue(cache.GetSizeInBytes() <= cache.GetCapacityInBytes());
+
+            // the least recently used entry was evicted
+            cache.DeserializeFromString(c_simpleCard, "1.3");
+            Assert::AreEqual(size_t{1}, cache.GetHitCount());
+            cache.DeserializeFromString(c_simpleCard, "1.2");
+            Assert::AreEqual(size_t{1}, cache.GetHitCount());
+            Assert::AreEqual(size_t{3}, cache.GetMissCount());
+        }
+
+        TEST_METHOD(FailedParseIsNotCachedTest)
+        {
+            ParseResultCache cache(1024 * 1024);
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { cache.DeserializeFromString("{ not json", "1.2"); });
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { cache.DeserializeFromString("{ not json", "1.2"); });
+            Assert::AreEqual(size_t{0}, cache.GetEntryCount());
+            Assert::AreEqual(size_t{2}, cache.GetMissCount());
+        }
+    };
+}
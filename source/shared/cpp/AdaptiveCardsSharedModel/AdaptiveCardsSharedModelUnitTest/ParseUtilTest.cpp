@@ -3,6 +3,8 @@
 #include "stdafx.h"
 #include "ParseUtil.h"
 
+#include <chrono>
+
 using namespace std::string_literals;
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
@@ -181,6 +183,22 @@ namespace AdaptiveCardsSharedModelUnitTest
             auto arrayRet = ParseUtil::GetArray(jsonObjWithAccentArray, AdaptiveCardSchemaKey::Accent, true);
             Assert::AreEqual(arrayRet[0].asCString(), "thing1");
             Assert::AreEqual(arrayRet[1].asCString(), "thing2");
+
+            // GetArray borrows from the source json rather than copying
+            Assert::IsTrue(&ParseUtil::GetArray(jsonObjWithAccentArray, AdaptiveCardSchemaKey::Accent) == &jsonObjWithAccentArray["accent"]);
+        }
+
+        TEST_METHOD(FindJsonValueTests)
+        {
+            auto jsonObj = s_GetValidJsonObject();
+            Assert::IsNull(ParseUtil::FindJsonValue(jsonObj, AdaptiveCardSchemaKey::Accent));
+            Assert::IsNull(ParseUtil::FindJsonValue(Json::Value(), AdaptiveCardSchemaKey::Accent));
+
+            auto jsonObjWithAccent = s_GetJsonObjectWithAccent("true"s);
+            const Json::Value* accentValue = ParseUtil::FindJsonValue(jsonObjWithAccent, AdaptiveCardSchemaKey::Accent);
+            Assert::IsNotNull(accentValue);
+            Assert::IsTrue(accentValue == &jsonObjWithAccent["accent"]);
+            Assert::IsTrue(accentValue->asBool());
         }
 
         TEST_METHOD(GetBoolTests)
@@ -196,6 +214,32 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::ExpectException<AdaptiveCardParseException>([&]() { ParseUtil::GetBool(jsonObjWithAccentArray, AdaptiveCardSchemaKey::Accent, false, true); });
         }
 
+        TEST_METHOD(TryGetTests)
+        {
+            // a type that isn't a string is reported as an invalid value, or returned as empty by TryGetTypeAsString
+            auto jsonObjWithObjectType = ParseUtil::GetJsonValueFromString(R"({ "type": { "name": "TextBlock" } })");
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { ParseUtil::GetTypeAsString(jsonObjWithObjectType); });
+            Assert::AreEqual(ParseUtil::TryGetTypeAsString(jsonObjWithObjectType), ""s);
+
+            // a value that isn't an object has no properties, rather than causing a Json::Exception
+            Json::Value array(Json::arrayValue);
+            Assert::IsTrue(ParseUtil::FindJsonValue(array, AdaptiveCardSchemaKey::Accent) == nullptr);
+            Assert::AreEqual(ParseUtil::TryGetString(array, AdaptiveCardSchemaKey::Accent), ""s);
+            Assert::AreEqual(ParseUtil::TryGetTypeAsString(array), ""s);
+        }
+
+        TEST_METHOD(GetOptionalEnumValueTests)
+        {
+            auto jsonObjWithUnknownEnum = s_GetJsonObjectWithAccent("\"notASpacing\""s);
+            auto jsonObjWithEnum = s_GetJsonObjectWithAccent("\"large\""s);
+
+            // an unknown value is no value, whether the converter returns an optional or throws
+            Assert::IsFalse(ParseUtil::GetOptionalEnumValue<Spacing>(jsonObjWithUnknownEnum, AdaptiveCardSchemaKey::Accent, SpacingTryFromString).has_value());
+            Assert::IsFalse(ParseUtil::GetOptionalEnumValue<Spacing>(jsonObjWithUnknownEnum, AdaptiveCardSchemaKey::Accent, SpacingFromString).has_value());
+            Assert::IsTrue(Spacing::Large == ParseUtil::GetOptionalEnumValue<Spacing>(jsonObjWithEnum, AdaptiveCardSchemaKey::Accent, SpacingFromString).value());
+            Assert::IsTrue(Spacing::Large == ParseUtil::GetEnumValue<Spacing>(jsonObjWithEnum, AdaptiveCardSchemaKey::Accent, Spacing::Default, SpacingTryFromString));
+        }
+
         TEST_METHOD(GetIntTests)
         {
             auto jsonObj = s_GetValidJsonObject();
@@ -271,5 +315,60 @@ namespace AdaptiveCardsSharedModelUnitTest
             auto actualString = ParseUtil::GetJsonString(jsonObjWithValidType, AdaptiveCardSchemaKey::Accent, true);
             Assert::AreEqual(actualString, "\"Valid\"\n"s);
         }
+
+        TEST_METHOD(JsonKeyTests)
+        {
+            for (const auto& entry : EnumHelpers::getAdaptiveCardSchemaKeyEnum().entries())
+            {
+                Assert::AreEqual(entry.second, std::string(AdaptiveCardSchemaKeyToJsonKey(entry.first).c_str()));
+            }
+
+            // a member added through a key handle can be found again by name
+            Json::Value jsonObj;
+            jsonObj[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Accent)] = "Valid";
+            Assert::AreEqual(ParseUtil::GetString(jsonObj, AdaptiveCardSchemaKey::Accent, true), "Valid"s);
+            Assert::AreEqual(jsonObj["accent"].asString(), "Valid"s);
+        }
+
+        TEST_METHOD(JsonKeyBenchmark)
+        {
+            constexpr int repetitions = 500;
+            std::vector<AdaptiveCardSchemaKey> keys;
+            for (const auto& entry : EnumHelpers::getAdaptiveCardSchemaKeyEnum().entries())
+            {
+                keys.push_back(entry.first);
+            }
+
+            // what a serializer does: add one member per key to a new object
+            Json::Value json;
+            const auto time = [&](const std::function<void(Json::Value&, AdaptiveCardSchemaKey)>& addMember) {
+                const auto start = std::chrono::steady_clock::now();
+                for (int i = 0; i < repetitions; ++i)
+                {
+                    json = Json::Value();
+                    for (const auto key : keys)
+                    {
+                        addMember(json, key);
+                    }
+                }
+                const auto end = std::chrono::steady_clock::now();
+                return std::to_string(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() /
+                                      (repetitions * keys.size())) +
+                       "ns";
+            };
+
+            const auto byName = time([](Json::Value& object, AdaptiveCardSchemaKey key) {
+                object[AdaptiveCardSchemaKeyToString(key)] = true;
+            });
+            const auto namedJson = json;
+            const auto byHandle = time([](Json::Value& object, AdaptiveCardSchemaKey key) {
+                object[AdaptiveCardSchemaKeyToJsonKey(key)] = true;
+            });
+            Assert::IsTrue(namedJson == json);
+
+            Logger::WriteMessage(("Adding " + std::to_string(keys.size()) + " members, by name " + byName +
+                                  ", by key handle " + byHandle)
+                                     .c_str());
+        }
     };
 }
@@ -121,5 +121,50 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::ExpectException<AdaptiveCardParseException>([&]() { elementParser.RemoveParser(CardElementTypeToString(CardElementType::Container)); });
             Assert::IsTrue((bool)elementParser.GetParser(CardElementTypeToString(CardElementType::Container)));
         }
+
+        TEST_METHOD(ParserRegistrationCopyOnWriteTests)
+        {
+            class TestCustomActionParser : public ActionElementParser
+            {
+            public:
+                virtual ~TestCustomActionParser() {};
+                virtual std::shared_ptr<BaseActionElement> Deserialize(ParseContext &/*context*/, const Json::Value& /*value*/) override
+                {
+                    return nullptr;
+                }
+                virtual std::shared_ptr<BaseActionElement> DeserializeFromString(ParseContext &/*context*/, const std::string& /*value*/) override
+                {
+                    return nullptr;
+                }
+            };
+
+            ActionParserRegistration customized;
+            ActionParserRegistration untouched;
+            const std::string openUrl = ActionTypeToString(ActionType::OpenUrl);
+
+            // registrations share the built-in parsers
+            Assert::IsNotNull(customized.FindParser(openUrl));
+            Assert::IsTrue(customized.FindParser(openUrl) == untouched.FindParser(openUrl));
+            Assert::IsTrue(customized.FindParser("action.openurl") == untouched.FindParser(openUrl));
+
+            // adding a parser to one registration leaves the others alone
+            auto customParser = std::make_shared<TestCustomActionParser>();
+            customized.AddParser("Action.Custom", customParser);
+            Assert::IsTrue(customized.FindParser("Action.Custom") == customParser.get());
+            Assert::IsNull(untouched.FindParser("Action.Custom"));
+            Assert::IsNull(ActionParserRegistration().FindParser("Action.Custom"));
+            Assert::IsTrue(customized.FindParser(openUrl) == untouched.FindParser(openUrl));
+
+            // copies are independent too
+            ActionParserRegistration copy = customized;
+            copy.RemoveParser("Action.Custom");
+            Assert::IsNull(copy.FindParser("Action.Custom"));
+            Assert::IsTrue(customized.FindParser("Action.Custom") == customParser.get());
+
+            ParseContext firstContext;
+            ParseContext secondContext;
+            Assert::IsTrue(firstContext.elementParserRegistration->FindParser("TextBlock") ==
+                           secondContext.elementParserRegistration->FindParser("TextBlock"));
+        }
     };
 }
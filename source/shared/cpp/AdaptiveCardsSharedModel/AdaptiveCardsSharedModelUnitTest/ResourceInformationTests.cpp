@@ -313,5 +313,78 @@ namespace AdaptiveCardsSharedModelUnitTest
             auto resourceInformation = AdaptiveCard::DeserializeFromString(testJsonString, "1.0")->GetAdaptiveCard()->GetResourceInformation();
             ValidateResourceInformation(expectedValues, resourceInformation);
         }
+
+        TEST_METHOD(CanGatherImagesInTablesAndSelectActions)
+        {
+            std::vector<RemoteResourceInformation> expectedValues = {
+                {"Cell.png", "image"},
+                {"SelectAction.png", "image"},
+                {"ActionSet.png", "image"},
+                {"Main.png", "image"},
+                {"ShowCard.png", "image"},
+                {"InShowCard.png", "image"}};
+
+            std::string testJsonString =
+            "{\
+                \"$schema\": \"http://adaptivecards.io/schemas/adaptive-card.json\",\
+                \"type\": \"AdaptiveCard\",\
+                \"version\": \"1.5\",\
+                \"body\": [\
+                    {\
+                        \"type\": \"Table\",\
+                        \"columns\": [ { \"width\": 1 } ],\
+                        \"rows\": [\
+                            {\
+                                \"type\": \"TableRow\",\
+                                \"cells\": [\
+                                    {\
+                                        \"type\": \"TableCell\",\
+                                        \"items\": [ { \"type\": \"Image\", \"url\": \"Cell.png\" } ]\
+                                    }\
+                                ]\
+                            }\
+                        ]\
+                    },\
+                    {\
+                        \"type\": \"Container\",\
+                        \"items\": [ { \"type\": \"TextBlock\", \"text\": \"Select me\" } ],\
+                        \"selectAction\": {\
+                            \"type\": \"Action.OpenUrl\",\
+                            \"url\": \"http://adaptivecards.io\",\
+                            \"iconUrl\": \"SelectAction.png\"\
+                        }\
+                    },\
+                    {\
+                        \"type\": \"ActionSet\",\
+                        \"actions\": [\
+                            {\
+                                \"type\": \"Action.Submit\",\
+                                \"title\": \"Send\",\
+                                \"iconUrl\": \"ActionSet.png\"\
+                            }\
+                        ]\
+                    },\
+                    {\
+                        \"type\": \"Image\",\
+                        \"url\": \"Main.png\",\
+                        \"fallback\": { \"type\": \"Image\", \"url\": \"Fallback.png\" }\
+                    }\
+                ],\
+                \"actions\": [\
+                    {\
+                        \"type\": \"Action.ShowCard\",\
+                        \"title\": \"More\",\
+                        \"iconUrl\": \"ShowCard.png\",\
+                        \"card\": {\
+                            \"type\": \"AdaptiveCard\",\
+                            \"body\": [ { \"type\": \"Image\", \"url\": \"InShowCard.png\" } ]\
+                        }\
+                    }\
+                ]\
+            }";
+
+            auto resourceInformation = AdaptiveCard::DeserializeFromString(testJsonString, "1.5")->GetAdaptiveCard()->GetResourceInformation();
+            ValidateResourceInformation(expectedValues, resourceInformation);
+        }
     };
 }
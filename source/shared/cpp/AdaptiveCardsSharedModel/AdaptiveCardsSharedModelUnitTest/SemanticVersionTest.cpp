@@ -73,6 +73,18 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::ExpectException<AdaptiveCardParseException>([&]() { SemanticVersion version("1.c"); });
         }
 
+        TEST_METHOD(TryParseTest)
+        {
+            const auto version = SemanticVersion::TryParse("1.2.3.4");
+            Assert::IsTrue(version.has_value());
+            Assert::IsTrue(*version == SemanticVersion("1.2.3.4"));
+
+            Assert::IsFalse(SemanticVersion::TryParse("").has_value());
+            Assert::IsFalse(SemanticVersion::TryParse("1.").has_value());
+            Assert::IsFalse(SemanticVersion::TryParse("1234567890123456789012345678901234567890").has_value());
+            Assert::IsFalse(SemanticVersion::TryParse("1.2.3.4.5").has_value());
+        }
+
         TEST_METHOD(CompareTest)
         {
             {
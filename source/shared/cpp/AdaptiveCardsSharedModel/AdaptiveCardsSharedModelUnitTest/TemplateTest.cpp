@@ -0,0 +1,167 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "AdaptiveCardTemplate.h"
+#include "CompiledTemplate.h"
+#include "ParseUtil.h"
+#include "TemplateExpression.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    const std::string templateTestData = R"({
+        "employee": {
+            "name": "Matt",
+            "manager": { "name": "Thomas" },
+            "peers": [ { "name": "Andrew" }, { "name": "Lei" }, { "name": "Mary Anne" } ]
+        },
+        "requests": [
+            { "type": "monitor", "price": 100 },
+            { "type": "laptop", "price": 2000 },
+            { "price": 2000 }
+        ],
+        "date": "03/15/2018 12:00:00",
+        "commitMessage": "{\"buildId\":\"9542982\"}"
+    })";
+
+    void AssertTemplateExpandsTo(const std::string& expected, const std::string& templateJson, std::vector<std::string>* warnings = nullptr)
+    {
+        AdaptiveCardTemplate cardTemplate(templateJson);
+        const auto data = ParseUtil::GetJsonValueFromString(templateTestData);
+        std::vector<std::string> expandWarnings;
+        const auto expanded = cardTemplate.Expand(data, warnings ? *warnings : expandWarnings);
+        Assert::AreEqual(ParseUtil::JsonToString(ParseUtil::GetJsonValueFromString(expected)), ParseUtil::JsonToString(expanded));
+    }
+
+    std::string EvaluateTemplateString(const std::string& value)
+    {
+        const auto data = ParseUtil::GetJsonValueFromString(templateTestData);
+        const TemplateScope scope{&data, nullptr, nullptr, std::nullopt};
+        return ParseUtil::JsonToString(TemplateString::Parse(value)->Evaluate(scope).Get());
+    }
+
+    TEST_CLASS(TemplateTest)
+    {
+    public:
+        TEST_METHOD(DataBindingTest)
+        {
+            AssertTemplateExpandsTo(
+                R"({ "type": "TextBlock", "text": "Hi Matt! Your manager is Thomas", "peers": 3, "first": { "name": "Andrew" } })",
+                R"({ "type": "TextBlock", "text": "Hi ${employee.name}! Your manager is ${employee.manager.name}",
+                     "peers": "${length(employee.peers)}", "first": "${employee.peers[0]}" })");
+
+            // a property the data doesn't have is left as written, and one that's unknown in any case is found
+            AssertTemplateExpandsTo(
+                R"({ "text": "${employee.age} and ${unknownFunction(employee.name)}", "name": "Matt", "missing": "${nothing}" })",
+                R"({ "text": "${employee.age} and ${unknownFunction(employee.name)}", "name": "${EMPLOYEE.Name}", "missing": "${nothing}" })");
+
+            // $data changes what expressions bind to, and $root still refers to all of the data
+            AssertTemplateExpandsTo(
+                R"({ "body": [ { "text": "Thomas reports to nobody; Matt" }, { "buildId": "9542982" } ] })",
+                R"({ "body": [ { "$data": "${employee.manager}", "text": "${name} reports to nobody; ${$root.employee.name}" },
+                               { "$data": "${json(commitMessage)}", "buildId": "${buildId}" } ] })");
+        }
+
+        TEST_METHOD(RepeatingTest)
+        {
+            AssertTemplateExpandsTo(
+                R"({ "body": [ { "text": "header" }, { "text": "1. Andrew" }, { "text": "2. Lei" }, { "text": "3. Mary Anne" } ] })",
+                R"({ "body": [ { "text": "header" }, { "$data": "${employee.peers}", "text": "${string($index + 1)}. ${name}" } ] })");
+
+            // inline data, and an object that's repeated as a property rather than an item of an array
+            AssertTemplateExpandsTo(
+                R"({ "items": [ { "n": 1 }, { "n": 2 } ], "single": { "n": 3 }, "none": null })",
+                R"({ "items": { "$data": [ { "x": 1 }, { "x": 2 } ], "n": "${x}" }, "single": { "$data": { "x": 3 }, "n": "${x}" },
+                     "none": { "$data": [], "n": 0 } })");
+
+            // every repetition dropped leaves an empty array
+            AssertTemplateExpandsTo(R"({ "body": [] })", R"({ "body": [ { "$data": "${requests}", "$when": "${price > 5000}" } ] })");
+        }
+
+        TEST_METHOD(WhenTest)
+        {
+            std::vector<std::string> warnings;
+            AssertTemplateExpandsTo(
+                R"({ "body": [ { "text": "monitor", "color": "good" }, { "text": "laptop", "color": "attention" } ] })",
+                R"({ "body": [ { "$data": "${requests}", "$when": "${exists(type)}", "text": "${type}",
+                                 "color": "${if(price <= 500, 'good', 'attention')}" } ] })",
+                &warnings);
+            Assert::IsTrue(warnings.empty());
+
+            AssertTemplateExpandsTo(
+                R"({ "body": [] })",
+                R"({ "body": [ { "$when": "${notInData}" }, { "$when": "not an expression" }, { "$when": "${price <}" } ] })",
+                &warnings);
+            Assert::AreEqual(size_t{3}, warnings.size());
+            Assert::AreEqual(std::string("WARN: Could not evaluate ${notInData} because it could not be found in the provided data. "
+                                         "The condition has been set to false by default."),
+                             warnings[0]);
+        }
+
+        TEST_METHOD(FunctionsTest)
+        {
+            Assert::AreEqual(std::string("\"matt MATT Anne 3\"\n"),
+                             EvaluateTemplateString("${toLower(employee.name)} ${toUpper(employee.name)} "
+                                                    "${substring(employee.peers[2].name, 5, 4)} ${indexOf(employee.peers[0].name, 'r')}"));
+            Assert::AreEqual(std::string("\"100 2000 4100 2\"\n"),
+                             EvaluateTemplateString("${min(select(requests, r, r.price))} ${max(select(requests, r, r.price))} "
+                                                    "${sum(select(requests, r, r.price))} ${count(where(requests, r, r.price > 500))}"));
+            Assert::AreEqual(std::string("\"2018-03-15T12:00:00Z Thursday, March 15\"\n"),
+                             EvaluateTemplateString("${formatDateTime(date, 'yyyy-MM-ddTHH:mm:ssZ')} ${formatDateTime(date, 'dddd, MMMM d')}"));
+            Assert::AreEqual(std::string("\"Andrew, Lei and Mary Anne\"\n"),
+                             EvaluateTemplateString("${join(select(employee.peers, p, p.name), ', ', ' and ')}"));
+            Assert::AreEqual(std::string("2.5\n"), EvaluateTemplateString("${5 / 2.0}"));
+            Assert::AreEqual(std::string("7\n"), EvaluateTemplateString("${1 + 2 * 3}"));
+            Assert::AreEqual(std::string("true\n"), EvaluateTemplateString("${!(1 > 2) && 'a' == \"a\"}"));
+            Assert::AreEqual(std::string("\"1,234.50\"\n"), EvaluateTemplateString("${formatNumber(1234.5, 2)}"));
+        }
+
+        TEST_METHOD(InvalidExpressionTest)
+        {
+            Assert::ExpectException<AdaptiveCardParseException>([]() { TemplateExpression::Parse("price <"); });
+            Assert::ExpectException<AdaptiveCardParseException>([]() { TemplateExpression::Parse("if(a, b"); });
+            Assert::ExpectException<AdaptiveCardParseException>([]() { TemplateExpression::Parse("length(a, b)"); });
+            Assert::ExpectException<AdaptiveCardParseException>([]() { TemplateExpression::Parse("'unterminated"); });
+            Assert::ExpectException<AdaptiveCardParseException>([]() { AdaptiveCardTemplate(std::string("{ not json")); });
+
+            // an expression that fails is left as written
+            Assert::AreEqual(std::string("\"${if(employee, 'yes', 'no'} ${1 / 0}\"\n"), EvaluateTemplateString("${if(employee, 'yes', 'no'} ${1 / 0}"));
+            Assert::IsFalse(TemplateString::Parse("no expressions {here}").has_value());
+        }
+
+        TEST_METHOD(NestingTest)
+        {
+            const auto repeated = [](const std::string& text, size_t count) {
+                std::string result;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    result += text;
+                }
+                return result;
+            };
+
+            // nesting that's deep but not absurdly so is evaluated
+            Assert::AreEqual(std::string("1\n"), EvaluateTemplateString("${" + repeated("(", 100) + "1" + repeated(")", 100) + "}"));
+            Assert::AreEqual(std::string("1\n"), EvaluateTemplateString("${" + repeated("-", 100) + "1}"));
+
+            // anything deeper is left as written, however it's nested, rather than overflowing the stack
+            const std::vector<std::string> tooDeep{repeated("(", 10000) + "1" + repeated(")", 10000),
+                                                   repeated("-", 10000) + "1",
+                                                   repeated("[", 10000) + "1" + repeated("]", 10000),
+                                                   repeated("max(", 10000) + "1" + repeated(")", 10000),
+                                                   repeated("employee + ", 10000) + "1",
+                                                   "employee" + repeated(".name", 10000)};
+            for (const auto& expression : tooDeep)
+            {
+                const auto templateString = "${" + expression + "}";
+                Assert::ExpectException<AdaptiveCardParseException>([&]() { TemplateExpression::Parse(expression); });
+                const auto templateJson = ParseUtil::JsonToString(Json::Value(templateString));
+                Assert::AreEqual(templateJson, EvaluateTemplateString(templateString));
+                AssertTemplateExpandsTo(templateJson, templateJson);
+                Assert::AreEqual(templateJson, ParseUtil::JsonToString(CompiledTemplate(templateJson).Expand(Json::Value())));
+            }
+        }
+    };
+}
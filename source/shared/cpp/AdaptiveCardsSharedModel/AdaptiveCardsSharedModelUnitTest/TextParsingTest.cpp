@@ -44,6 +44,27 @@ namespace AdaptiveCardsSharedModelUnitTest
             }
         }
 
+        TEST_METHOD(TextFeaturesTest)
+        {
+            TextBlock textBlock;
+            textBlock.SetText("Meeting moved to room 42");
+            Assert::IsTrue(textBlock.GetTextFeatures().IsPlainText());
+            Assert::AreEqual(size_t{1}, textBlock.GetTextForDateParsing().GetTextTokens().size());
+
+            // the features are those of the text once its entities are decoded
+            textBlock.SetText("&lt;b&gt; on {{DATE(2017-02-14T06:08:39Z, SHORT)}}");
+            const auto& features = textBlock.GetTextFeatures();
+            Assert::IsFalse(features.mayHaveMarkDown);
+            Assert::IsFalse(features.mayHaveHtmlEntities);
+            Assert::IsTrue(features.hasHtmlCharacters);
+            Assert::IsTrue(features.mayHaveDateTokens);
+            Assert::IsTrue(textBlock.GetTextForDateParsing().HasDateTokens());
+
+            textBlock.SetText("**Approved** by _J. Smith_ & co");
+            Assert::IsTrue(textBlock.GetTextFeatures().mayHaveMarkDown);
+            Assert::IsTrue(textBlock.GetTextFeatures().mayHaveHtmlEntities);
+        }
+
     private:
         std::string _GetTextBlockText(const std::string& testString)
         {
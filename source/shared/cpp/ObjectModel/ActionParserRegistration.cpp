@@ -20,11 +20,17 @@ ActionElementParserWrapper::ActionElementParserWrapper(std::shared_ptr<ActionEle
 }
 
 std::shared_ptr<BaseActionElement> ActionElementParserWrapper::Deserialize(ParseContext& context, const Json::Value& value)
+{
+    return Deserialize(context, *m_parser, value);
+}
+
+std::shared_ptr<BaseActionElement> ActionElementParserWrapper::Deserialize(
+    ParseContext& context, ActionElementParser& parser, const Json::Value& value)
 {
     const auto& idProperty = ParseUtil::GetString(value, AdaptiveCardSchemaKey::Id);
     const AdaptiveCards::InternalId internalId = AdaptiveCards::InternalId::Next();
     context.PushElement(idProperty, internalId);
-    std::shared_ptr<BaseActionElement> element = m_parser->Deserialize(context, value);
+    std::shared_ptr<BaseActionElement> element = parser.Deserialize(context, value);
     context.PopElement();
 
     return element;
@@ -35,32 +41,55 @@ std::shared_ptr<BaseActionElement> ActionElementParserWrapper::DeserializeFromSt
     return Deserialize(context, ParseUtil::GetJsonValueFromString(value));
 }
 
-ActionParserRegistration::ActionParserRegistration()
+namespace
 {
-    m_knownElements.insert({
-        ActionTypeToString(ActionType::Execute),
-        ActionTypeToString(ActionType::OpenUrl),
-        ActionTypeToString(ActionType::ShowCard),
-        ActionTypeToString(ActionType::Submit),
-        ActionTypeToString(ActionType::ToggleVisibility),
-        ActionTypeToString(ActionType::UnknownAction),
-    });
+    // Action types whose parsers hosts may not override or remove
+    const std::unordered_set<std::string>& KnownActions()
+    {
+        static const std::unordered_set<std::string> knownActions{
+            ActionTypeToString(ActionType::Execute),
+            ActionTypeToString(ActionType::OpenUrl),
+            ActionTypeToString(ActionType::ShowCard),
+            ActionTypeToString(ActionType::Submit),
+            ActionTypeToString(ActionType::ToggleVisibility),
+            ActionTypeToString(ActionType::UnknownAction)};
+        return knownActions;
+    }
 
-    m_cardElementParsers.insert(
-        {{ActionTypeToString(ActionType::Execute), std::make_shared<ExecuteActionParser>()},
-         {ActionTypeToString(ActionType::OpenUrl), std::make_shared<OpenUrlActionParser>()},
-         {ActionTypeToString(ActionType::ShowCard), std::make_shared<ShowCardActionParser>()},
-         {ActionTypeToString(ActionType::Submit), std::make_shared<SubmitActionParser>()},
-         {ActionTypeToString(ActionType::ToggleVisibility), std::make_shared<ToggleVisibilityActionParser>()},
-         {ActionTypeToString(ActionType::UnknownAction), std::make_shared<UnknownActionParser>()}});
+    // Built once and shared by every registration until it adds or removes a parser
+    const std::shared_ptr<ActionParserRegistration::ParserMap>& DefaultParsers()
+    {
+        static const auto defaultParsers = std::make_shared<ActionParserRegistration::ParserMap>(ActionParserRegistration::ParserMap{
+            {ActionTypeToString(ActionType::Execute), std::make_shared<ExecuteActionParser>()},
+            {ActionTypeToString(ActionType::OpenUrl), std::make_shared<OpenUrlActionParser>()},
+            {ActionTypeToString(ActionType::ShowCard), std::make_shared<ShowCardActionParser>()},
+            {ActionTypeToString(ActionType::Submit), std::make_shared<SubmitActionParser>()},
+            {ActionTypeToString(ActionType::ToggleVisibility), std::make_shared<ToggleVisibilityActionParser>()},
+            {ActionTypeToString(ActionType::UnknownAction), std::make_shared<UnknownActionParser>()}});
+        return defaultParsers;
+    }
+} // namespace
+
+ActionParserRegistration::ActionParserRegistration() : m_cardElementParsers{DefaultParsers()}
+{
+}
+
+ActionParserRegistration::ParserMap& ActionParserRegistration::GetParsersForWrite()
+{
+    // the default table is always shared, as DefaultParsers() holds on to it
+    if (m_cardElementParsers.use_count() > 1)
+    {
+        m_cardElementParsers = std::make_shared<ParserMap>(*m_cardElementParsers);
+    }
+    return *m_cardElementParsers;
 }
 
 void ActionParserRegistration::AddParser(std::string const& elementType, std::shared_ptr<ActionElementParser> parser)
 {
     // make sure caller isn't attempting to overwrite a known element's parser
-    if (m_knownElements.find(elementType) == m_knownElements.end())
+    if (KnownActions().find(elementType) == KnownActions().end())
     {
-        ActionParserRegistration::m_cardElementParsers[elementType] = parser;
+        GetParsersForWrite()[elementType] = parser;
     }
     else
     {
@@ -72,9 +101,9 @@ void ActionParserRegistration::AddParser(std::string const& elementType, std::sh
 void ActionParserRegistration::RemoveParser(std::string const& elementType)
 {
     // make sure caller isn't attempting to remove a known element's parser
-    if (m_knownElements.find(elementType) == m_knownElements.end())
+    if (KnownActions().find(elementType) == KnownActions().end())
     {
-        ActionParserRegistration::m_cardElementParsers.erase(elementType);
+        GetParsersForWrite().erase(elementType);
     }
     else
     {
@@ -85,8 +114,8 @@ void ActionParserRegistration::RemoveParser(std::string const& elementType)
 
 std::shared_ptr<ActionElementParser> ActionParserRegistration::GetParser(std::string const& elementType) const
 {
-    auto parser = m_cardElementParsers.find(elementType);
-    if (parser != ActionParserRegistration::m_cardElementParsers.end())
+    auto parser = m_cardElementParsers->find(elementType);
+    if (parser != m_cardElementParsers->end())
     {
         // Why do we wrap the parser? As we parse elements, we need to push and pop state from the stack for ID
         // collision detection. We *could* do this within the implementation of parsers themselves, but that would
@@ -101,4 +130,10 @@ std::shared_ptr<ActionElementParser> ActionParserRegistration::GetParser(std::st
         return std::shared_ptr<ActionElementParser>(nullptr);
     }
 }
+
+ActionElementParser* ActionParserRegistration::FindParser(std::string const& elementType) const
+{
+    auto parser = m_cardElementParsers->find(elementType);
+    return (parser != m_cardElementParsers->end()) ? parser->second.get() : nullptr;
+}
 } // namespace AdaptiveCards
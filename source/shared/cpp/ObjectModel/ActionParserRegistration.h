@@ -36,6 +36,11 @@ public:
         return m_parser;
     }
 
+    // Performs the ID collision bookkeeping around a call to parser.Deserialize(). This is what Deserialize() does
+    // for the wrapped parser; it is exposed so that callers holding an unwrapped parser from FindParser() don't need
+    // to allocate a wrapper for every element they parse.
+    static std::shared_ptr<BaseActionElement> Deserialize(ParseContext& context, ActionElementParser& parser, const Json::Value& value);
+
 private:
     std::shared_ptr<ActionElementParser> m_parser;
 };
@@ -43,14 +48,25 @@ private:
 class ActionParserRegistration
 {
 public:
+    using ParserMap =
+        std::unordered_map<std::string, std::shared_ptr<AdaptiveCards::ActionElementParser>, CaseInsensitiveHash, CaseInsensitiveEqualTo>;
+
     ActionParserRegistration();
 
     void AddParser(std::string const& elementType, std::shared_ptr<AdaptiveCards::ActionElementParser> parser);
     void RemoveParser(std::string const& elementType);
     std::shared_ptr<AdaptiveCards::ActionElementParser> GetParser(std::string const& elementType) const;
 
+    // Returns the parser registered for elementType without wrapping it, or nullptr if there is none. The pointer
+    // stays valid until this registration is next modified. Parse with ActionElementParserWrapper::Deserialize()
+    // so that ID collision detection still happens.
+    AdaptiveCards::ActionElementParser* FindParser(std::string const& elementType) const;
+
 private:
-    std::unordered_set<std::string> m_knownElements;
-    std::unordered_map<std::string, std::shared_ptr<AdaptiveCards::ActionElementParser>, CaseInsensitiveHash, CaseInsensitiveEqualTo> m_cardElementParsers;
+    ParserMap& GetParsersForWrite();
+
+    // Every registration starts out sharing one immutable table of the built-in parsers. The table is copied the
+    // first time a registration adds or removes a parser, so hosts customizing one context don't affect any other.
+    std::shared_ptr<ParserMap> m_cardElementParsers;
 };
 } // namespace AdaptiveCards
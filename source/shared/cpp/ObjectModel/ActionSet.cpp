@@ -33,7 +33,7 @@ Json::Value ActionSet::SerializeToJsonValue() const
 {
     Json::Value root = BaseCardElement::SerializeToJsonValue();
 
-    const std::string& actionsPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions);
+    const Json::StaticString& actionsPropertyName = AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Actions);
     root[actionsPropertyName] = Json::Value(Json::arrayValue);
 
     for (const auto& actionElement : m_actions)
@@ -64,5 +64,8 @@ std::shared_ptr<BaseCardElement> ActionSetParser::DeserializeFromString(ParseCon
 
 void ActionSet::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions));
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Actions});
+    m_knownProperties = &knownProperties;
 }
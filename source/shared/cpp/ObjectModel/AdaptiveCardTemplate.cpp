@@ -0,0 +1,187 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "AdaptiveCardTemplate.h"
+#include "AdaptiveCardParseException.h"
+#include "ParseUtil.h"
+#include "TemplateExpression.h"
+#include <cstring>
+
+using namespace AdaptiveCards;
+
+namespace
+{
+constexpr const char* c_dataProperty = "$data";
+constexpr const char* c_whenProperty = "$when";
+
+class TemplateExpander
+{
+public:
+    explicit TemplateExpander(std::vector<std::string>* warnings) : m_warnings(warnings) {}
+
+    // nullopt for a value that's left out: a property the data doesn't have
+    std::optional<Json::Value> Expand(const Json::Value& node, const TemplateScope& scope)
+    {
+        if (node.isArray())
+        {
+            return ExpandArray(node, scope);
+        }
+        if (node.isObject())
+        {
+            return ExpandObject(node, scope);
+        }
+        if (node.isString())
+        {
+            const auto templateString = TemplateString::Parse(node.asString());
+            if (templateString.has_value())
+            {
+                auto value = templateString->Evaluate(scope);
+                if (value.IsUndefined())
+                {
+                    return std::nullopt;
+                }
+                return value.Release();
+            }
+        }
+        return node;
+    }
+
+private:
+    // Items that expand to null are dropped, and ones that expand to arrays (the repetitions of an object with a
+    // $data array) are spliced in
+    Json::Value ExpandArray(const Json::Value& node, const TemplateScope& scope)
+    {
+        Json::Value result(Json::arrayValue);
+        for (const auto& item : node)
+        {
+            auto expanded = Expand(item, scope);
+            if (!expanded.has_value() || expanded->isNull())
+            {
+                continue;
+            }
+
+            if (expanded->isArray())
+            {
+                for (auto& expandedItem : *expanded)
+                {
+                    result.append(std::move(expandedItem));
+                }
+            }
+            else
+            {
+                result.append(std::move(*expanded));
+            }
+        }
+        return result;
+    }
+
+    // null when every repetition of the object is dropped, and an array when more than one is kept
+    Json::Value ExpandObject(const Json::Value& node, const TemplateScope& scope)
+    {
+        // the value of $data may refer to the constants of its expression, so the expression is kept until the
+        // object is expanded
+        TemplateValue data;
+        std::optional<TemplateString> dataString;
+        if (const auto* dataProperty = node.find(c_dataProperty, c_dataProperty + std::strlen(c_dataProperty)))
+        {
+            dataString = dataProperty->isString() ? TemplateString::Parse(dataProperty->asString()) : std::nullopt;
+            data = dataString.has_value() ? dataString->Evaluate(scope) : TemplateValue::Reference(*dataProperty);
+        }
+        const auto* when = node.find(c_whenProperty, c_whenProperty + std::strlen(c_whenProperty));
+
+        std::vector<Json::Value> results;
+        TemplateScope itemScope = scope;
+        if (data.Get().isArray())
+        {
+            const auto& items = data.Get();
+            for (Json::ArrayIndex i = 0; i < items.size(); ++i)
+            {
+                itemScope.data = &items[i];
+                itemScope.index = i;
+                ExpandRepetition(node, when, itemScope, results);
+            }
+        }
+        else
+        {
+            if (!data.IsUndefined())
+            {
+                itemScope.data = &data.Get();
+            }
+            ExpandRepetition(node, when, itemScope, results);
+        }
+
+        if (results.empty())
+        {
+            return Json::Value();
+        }
+        if (results.size() == 1)
+        {
+            return std::move(results[0]);
+        }
+
+        Json::Value result(Json::arrayValue);
+        for (auto& item : results)
+        {
+            result.append(std::move(item));
+        }
+        return result;
+    }
+
+    void ExpandRepetition(const Json::Value& node, const Json::Value* when, const TemplateScope& scope, std::vector<Json::Value>& results)
+    {
+        if (when != nullptr)
+        {
+            const auto condition = when->isString() ? TemplateString::Parse(when->asString()) : std::nullopt;
+            if (!EvaluateTemplateCondition(*when, condition ? &*condition : nullptr, scope, m_warnings))
+            {
+                return;
+            }
+        }
+
+        Json::Value result(Json::objectValue);
+        for (auto it = node.begin(); it != node.end(); ++it)
+        {
+            auto name = it.name();
+            if (IsTemplateKeyword(name))
+            {
+                continue;
+            }
+
+            auto value = Expand(*it, scope);
+            if (value.has_value())
+            {
+                result[name] = std::move(*value);
+            }
+        }
+        results.push_back(std::move(result));
+    }
+
+    std::vector<std::string>* m_warnings;
+};
+
+Json::Value ExpandTemplate(const Json::Value& templateJson, const Json::Value& data, std::vector<std::string>* warnings)
+{
+    const TemplateScope scope{&data, nullptr, nullptr, std::nullopt};
+    auto result = TemplateExpander(warnings).Expand(templateJson, scope);
+    return result.has_value() ? std::move(*result) : Json::Value();
+}
+} // namespace
+
+AdaptiveCardTemplate::AdaptiveCardTemplate(Json::Value templateJson) : m_template(std::move(templateJson))
+{
+}
+
+AdaptiveCardTemplate::AdaptiveCardTemplate(const std::string& templateString) :
+    m_template(ParseUtil::GetJsonValueFromString(templateString))
+{
+}
+
+Json::Value AdaptiveCardTemplate::Expand(const Json::Value& data) const
+{
+    return ExpandTemplate(m_template, data, nullptr);
+}
+
+Json::Value AdaptiveCardTemplate::Expand(const Json::Value& data, std::vector<std::string>& warnings) const
+{
+    return ExpandTemplate(m_template, data, &warnings);
+}
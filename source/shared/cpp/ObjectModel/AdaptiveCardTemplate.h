@@ -0,0 +1,33 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveCards
+{
+// A card template, expanded with data into the JSON of a card the way the templating SDKs (adaptivecards-templating,
+// AdaptiveCards.Templating) expand it:
+//   - "${expression}" in a string binds to the data; a string that is a single expression takes on the type of its
+//     value, and a property the data doesn't have is left as written
+//   - "$data" on an object changes the data its expressions bind to; when it's an array, the object is repeated for
+//     each item, with $index set to the index of the item
+//   - "$when" on an object drops it unless its expression is true
+//   - $root is the data the template was expanded with, and $data the data of the innermost "$data"
+class AdaptiveCardTemplate
+{
+public:
+    explicit AdaptiveCardTemplate(Json::Value templateJson);
+    // Throws an AdaptiveCardParseException when templateString isn't valid JSON
+    explicit AdaptiveCardTemplate(const std::string& templateString);
+
+    const Json::Value& GetTemplate() const { return m_template; }
+
+    Json::Value Expand(const Json::Value& data) const;
+    // Adds a warning for each $when that couldn't be evaluated (and so dropped its object)
+    Json::Value Expand(const Json::Value& data, std::vector<std::string>& warnings) const;
+
+private:
+    Json::Value m_template;
+};
+} // namespace AdaptiveCards
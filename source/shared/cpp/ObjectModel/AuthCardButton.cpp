@@ -83,22 +83,22 @@ Json::Value AuthCardButton::SerializeToJsonValue() const
 
     if (!m_type.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = m_type;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Type)] = m_type;
     }
 
     if (!m_title.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title)] = m_title;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Title)] = m_title;
     }
 
     if (!m_image.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Image)] = m_image;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Image)] = m_image;
     }
 
     if (!m_value.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value)] = m_value;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Value)] = m_value;
     }
 
     return root;
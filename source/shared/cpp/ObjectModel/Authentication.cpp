@@ -84,28 +84,28 @@ Json::Value Authentication::SerializeToJsonValue() const
 
     if (!m_text.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Text)] = m_text;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Text)] = m_text;
     }
 
     if (!m_connectionName.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ConnectionName)] = m_connectionName;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::ConnectionName)] = m_connectionName;
     }
 
     if (m_tokenExchangeResource != nullptr && m_tokenExchangeResource->ShouldSerialize())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TokenExchangeResource)] =
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::TokenExchangeResource)] =
             m_tokenExchangeResource->SerializeToJsonValue();
     }
 
     if (!m_buttons.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Buttons)] = Json::Value(Json::arrayValue);
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Buttons)] = Json::Value(Json::arrayValue);
         for (std::shared_ptr<AuthCardButton> button : m_buttons)
         {
             if (button != nullptr && button->ShouldSerialize())
             {
-                root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Buttons)].append(button->SerializeToJsonValue());
+                root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Buttons)].append(button->SerializeToJsonValue());
             }
         }
     }
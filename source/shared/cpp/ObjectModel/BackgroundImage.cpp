@@ -74,23 +74,23 @@ Json::Value BackgroundImage::SerializeToJsonValue() const
     {
         if (!m_url.empty())
         {
-            root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url)] = m_url;
+            root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Url)] = m_url;
         }
 
         if (m_fillMode != ImageFillMode::Cover)
         {
-            root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FillMode)] = ImageFillModeToString(m_fillMode);
+            root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::FillMode)] = ImageFillModeToString(m_fillMode);
         }
 
         if (m_hAlignment != HorizontalAlignment::Left)
         {
-            root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment)] =
+            root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::HorizontalAlignment)] =
                 HorizontalAlignmentToString(m_hAlignment);
         }
 
         if (m_vAlignment != VerticalAlignment::Top)
         {
-            root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalAlignment)] = VerticalAlignmentToString(m_vAlignment);
+            root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::VerticalAlignment)] = VerticalAlignmentToString(m_vAlignment);
         }
     }
     return root;
@@ -118,13 +118,13 @@ std::shared_ptr<BackgroundImage> BackgroundImage::Deserialize(const Json::Value&
     image->SetUrl(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Url, true));
 
     image->SetFillMode(ParseUtil::GetEnumValue<ImageFillMode>(
-        json, AdaptiveCardSchemaKey::FillMode, ImageFillMode::Cover, ImageFillModeFromString));
+        json, AdaptiveCardSchemaKey::FillMode, ImageFillMode::Cover, ImageFillModeTryFromString));
 
     image->SetHorizontalAlignment(ParseUtil::GetEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignment::Left, HorizontalAlignmentFromString));
+        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignment::Left, HorizontalAlignmentTryFromString));
 
     image->SetVerticalAlignment(ParseUtil::GetEnumValue<VerticalAlignment>(
-        json, AdaptiveCardSchemaKey::VerticalAlignment, VerticalAlignment::Top, VerticalAlignmentFromString));
+        json, AdaptiveCardSchemaKey::VerticalAlignment, VerticalAlignment::Top, VerticalAlignmentTryFromString));
 
     return image;
 }
@@ -4,6 +4,7 @@
 #include "BaseActionElement.h"
 #include "BaseElement.h"
 #include "ParseUtil.h"
+#include "Util.h"
 
 using namespace AdaptiveCards;
 
@@ -107,31 +108,31 @@ Json::Value BaseActionElement::SerializeToJsonValue() const
 
     if (!m_iconUrl.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IconUrl)] = m_iconUrl;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::IconUrl)] = m_iconUrl;
     }
 
     if (!m_title.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title)] = m_title;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Title)] = m_title;
     }
 
     if (!m_style.empty() && (m_style.compare(defaultStyle) != 0))
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style)] = m_style;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Style)] = m_style;
     }
     if (m_mode != Mode::Primary)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Mode)] = ModeToString(m_mode);
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Mode)] = ModeToString(m_mode);
     }
 
     if (!m_tooltip.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Tooltip)] = m_tooltip;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Tooltip)] = m_tooltip;
     }
 
     if (!m_isEnabled)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsEnabled)] = m_isEnabled;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::IsEnabled)] = m_isEnabled;
     }
 
     return root;
@@ -139,13 +140,15 @@ Json::Value BaseActionElement::SerializeToJsonValue() const
 
 void BaseActionElement::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IconUrl),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Mode),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Tooltip),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsEnabled)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::IconUrl,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::Title,
+         AdaptiveCardSchemaKey::Mode,
+         AdaptiveCardSchemaKey::Tooltip,
+         AdaptiveCardSchemaKey::IsEnabled});
+    m_knownProperties = &knownProperties;
 }
 
 void BaseActionElement::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -184,7 +187,7 @@ void BaseActionElement::DeserializeBaseProperties(ParseContext& context, const J
     element->SetTitle(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Title));
     element->SetIconUrl(ParseUtil::GetString(json, AdaptiveCardSchemaKey::IconUrl));
     element->SetStyle(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Style, defaultStyle, false));
-    element->SetMode(ParseUtil::GetEnumValue<Mode>(json, AdaptiveCardSchemaKey::Mode, Mode::Primary, ModeFromString));
+    element->SetMode(ParseUtil::GetEnumValue<Mode>(json, AdaptiveCardSchemaKey::Mode, Mode::Primary, ModeTryFromString));
     element->SetTooltip(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Tooltip));
     element->SetIsEnabled(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::IsEnabled, true));
 }
@@ -8,6 +8,7 @@
 #include "ShowCardAction.h"
 #include "OpenUrlAction.h"
 #include "SubmitAction.h"
+#include "Util.h"
 
 using namespace AdaptiveCards;
 
@@ -27,12 +28,14 @@ BaseCardElement::BaseCardElement(CardElementType type) :
 
 void BaseCardElement::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsVisible),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MinHeight),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Separator),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Spacing)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Height,
+         AdaptiveCardSchemaKey::IsVisible,
+         AdaptiveCardSchemaKey::MinHeight,
+         AdaptiveCardSchemaKey::Separator,
+         AdaptiveCardSchemaKey::Spacing});
+    m_knownProperties = &knownProperties;
 }
 
 bool BaseCardElement::GetSeparator() const
@@ -86,22 +89,22 @@ Json::Value BaseCardElement::SerializeToJsonValue() const
 
     if (m_height != HeightType::Auto)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height)] = HeightTypeToString(GetHeight());
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Height)] = HeightTypeToString(GetHeight());
     }
 
     if (m_spacing != Spacing::Default)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Spacing)] = SpacingToString(m_spacing);
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Spacing)] = SpacingToString(m_spacing);
     }
 
     if (m_separator)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Separator)] = true;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Separator)] = true;
     }
 
     if (!m_isVisible)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsVisible)] = false;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::IsVisible)] = false;
     }
 
     return root;
@@ -119,14 +122,14 @@ Json::Value BaseCardElement::SerializeSelectAction(const std::shared_ptr<BaseAct
 void BaseCardElement::ParseJsonObject(AdaptiveCards::ParseContext& context, const Json::Value& json, std::shared_ptr<BaseElement>& element)
 {
     const std::string typeString = ParseUtil::GetTypeAsString(json);
-    std::shared_ptr<BaseCardElementParser> parser = context.elementParserRegistration->GetParser(typeString);
+    BaseCardElementParser* parser = context.elementParserRegistration->FindParser(typeString);
 
     if (parser == nullptr)
     {
-        parser = context.elementParserRegistration->GetParser("Unknown");
+        parser = context.elementParserRegistration->FindParser("Unknown");
     }
 
-    auto parsedElement = parser->Deserialize(context, json);
+    auto parsedElement = BaseCardElementParserWrapper::Deserialize(context, *parser, json);
     if (parsedElement != nullptr)
     {
         element = std::move(parsedElement);
@@ -154,8 +157,8 @@ void BaseCardElement::DeserializeBaseProperties(ParseContext& context, const Jso
 
     element->DeserializeBase<BaseCardElement>(context, json);
     element->SetCanFallbackToAncestor(context.GetCanFallbackToAncestor());
-    element->SetHeight(ParseUtil::GetEnumValue<HeightType>(json, AdaptiveCardSchemaKey::Height, HeightType::Auto, HeightTypeFromString));
+    element->SetHeight(ParseUtil::GetEnumValue<HeightType>(json, AdaptiveCardSchemaKey::Height, HeightType::Auto, HeightTypeTryFromString));
     element->SetIsVisible(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::IsVisible, true));
     element->SetSeparator(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Separator, false));
-    element->SetSpacing(ParseUtil::GetEnumValue<Spacing>(json, AdaptiveCardSchemaKey::Spacing, Spacing::Default, SpacingFromString));
+    element->SetSpacing(ParseUtil::GetEnumValue<Spacing>(json, AdaptiveCardSchemaKey::Spacing, Spacing::Default, SpacingTryFromString));
 }
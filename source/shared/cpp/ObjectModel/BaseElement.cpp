@@ -5,10 +5,16 @@
 #include "BaseElement.h"
 #include "ParseUtil.h"
 #include "SemanticVersion.h"
+#include "Util.h"
 
 namespace AdaptiveCards
 {
-unsigned int InternalId::s_currentInternalId = 1;
+// Ids are handed out from a single counter shared by all threads, so they stay unique when several cards are
+// parsed concurrently. The id most recently handed out is tracked per thread: element parser wrappers call Next()
+// and push the id onto their ParseContext right before the parser constructs the element, and the element picks
+// the same id back up through Current(). See the giant comment on ID collision detection in ParseContext.cpp.
+std::atomic<unsigned int> InternalId::s_lastInternalId{1};
+thread_local unsigned int InternalId::s_currentInternalId = 1;
 
 InternalId InternalId::Current()
 {
@@ -18,14 +24,15 @@ InternalId InternalId::Current()
 
 InternalId InternalId::Next()
 {
-    s_currentInternalId++;
+    unsigned int nextInternalId = ++s_lastInternalId;
 
     // handle overflow case
-    if (s_currentInternalId == InternalId::Invalid)
+    if (nextInternalId == InternalId::Invalid)
     {
-        s_currentInternalId++;
+        nextInternalId = ++s_lastInternalId;
     }
 
+    s_currentInternalId = nextInternalId;
     return Current();
 }
 
@@ -72,11 +79,18 @@ void BaseElement::SetElementTypeString(const std::string& value)
 
 void BaseElement::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Fallback),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Id),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Requires),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        {},
+        {AdaptiveCardSchemaKey::Fallback,
+         AdaptiveCardSchemaKey::Id,
+         AdaptiveCardSchemaKey::Requires,
+         AdaptiveCardSchemaKey::Type});
+    m_knownProperties = &knownProperties;
+}
+
+const std::unordered_set<std::string>& BaseElement::GetKnownProperties() const
+{
+    return *m_knownProperties;
 }
 
 const Json::Value& BaseElement::GetAdditionalProperties() const
@@ -139,21 +153,21 @@ Json::Value BaseElement::SerializeToJsonValue() const
 
     // Important -- we're explicitly getting the type as a string here because that's where we store the type that
     // was specified by the card author.
-    root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = GetElementTypeString();
+    root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Type)] = GetElementTypeString();
 
     if (!m_id.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Id)] = m_id;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Id)] = m_id;
     }
 
     // Handle fallback
     if (m_fallbackType == FallbackType::Drop)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Fallback)] = "drop";
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Fallback)] = "drop";
     }
     else if (m_fallbackType == FallbackType::Content)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Fallback)] = m_fallbackContent->SerializeToJsonValue();
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Fallback)] = m_fallbackContent->SerializeToJsonValue();
     }
 
     // Handle requires
@@ -165,7 +179,7 @@ Json::Value BaseElement::SerializeToJsonValue() const
             jsonRequires[requirement.first] = static_cast<std::string>(requirement.second);
         }
 
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Requires)] = jsonRequires;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Requires)] = jsonRequires;
     }
 
     return root;
@@ -179,7 +193,7 @@ void BaseElement::GetResourceInformation(std::vector<RemoteResourceInformation>&
 
 void BaseElement::ParseRequires(ParseContext& /*context*/, const Json::Value& json)
 {
-    const auto requiresValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Requires, false);
+    const auto& requiresValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Requires, false);
     if (!requiresValue.isNull())
     {
         if (requiresValue.isObject())
@@ -198,17 +212,14 @@ void BaseElement::ParseRequires(ParseContext& /*context*/, const Json::Value& js
                 }
                 else
                 {
-                    try
-                    {
-                        SemanticVersion memberVersion(memberValue);
-                        m_requires.emplace(memberName, memberVersion);
-                    }
-                    catch (const AdaptiveCardParseException&)
+                    const auto memberVersion = SemanticVersion::TryParse(memberValue);
+                    if (!memberVersion.has_value())
                     {
                         throw AdaptiveCardParseException(
                             ErrorStatusCode::InvalidPropertyValue,
                             "Invalid version in requires value: '" + memberValue + "'");
                     }
+                    m_requires.emplace(memberName, *memberVersion);
                 }
             }
             return;
@@ -20,6 +20,8 @@ class FeatureRegistration;
 
 class BaseElement
 {
+    friend class CardBinaryReader;
+
 public:
     BaseElement() :
         m_typeString{}, m_additionalProperties{}, m_requires{},
@@ -87,6 +89,7 @@ public:
 
     // Misc.
     virtual void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceUris);
+    const std::unordered_set<std::string>& GetKnownProperties() const;
 
 protected:
     void SetTypeString(std::string&& type)
@@ -103,7 +106,10 @@ protected:
     }
 
     std::string m_typeString;
-    std::unordered_set<std::string> m_knownProperties;
+
+    // Points at an immutable table shared by every instance of the same type. Each constructor in the hierarchy
+    // replaces it with its own type's table, which is built once from the table its base constructor left here.
+    const std::unordered_set<std::string>* m_knownProperties;
     Json::Value m_additionalProperties;
 
 private:
@@ -135,7 +141,7 @@ void BaseElement::DeserializeBase(ParseContext& context, const Json::Value& json
 template <typename T>
 void BaseElement::ParseFallback(ParseContext& context, const Json::Value& json)
 {
-    const auto fallbackValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Fallback, false);
+    const auto& fallbackValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Fallback, false);
     if (!fallbackValue.empty())
     {
         // Two possible valid json values for fallback -- either the string "drop", or a valid Adaptive Card
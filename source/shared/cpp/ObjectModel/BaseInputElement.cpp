@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "BaseInputElement.h"
 #include "ParseUtil.h"
+#include "Util.h"
 
 using namespace AdaptiveCards;
 
@@ -58,17 +59,17 @@ Json::Value BaseInputElement::SerializeToJsonValue() const
 
     if (m_isRequired)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsRequired)] = m_isRequired;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::IsRequired)] = m_isRequired;
     }
 
     if (!m_errorMessage.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ErrorMessage)] = m_errorMessage;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::ErrorMessage)] = m_errorMessage;
     }
 
     if (!m_label.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Label)] = m_label;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Label)] = m_label;
     }
 
     return root;
@@ -76,10 +77,12 @@ Json::Value BaseInputElement::SerializeToJsonValue() const
 
 void BaseInputElement::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsRequired),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ErrorMessage),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Label)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::IsRequired,
+         AdaptiveCardSchemaKey::ErrorMessage,
+         AdaptiveCardSchemaKey::Label});
+    m_knownProperties = &knownProperties;
 }
 
 std::shared_ptr<BaseInputElement> BaseInputElement::DeserializeBasePropertiesFromString(ParseContext& context, const std::string& jsonString)
@@ -0,0 +1,93 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "BatchDeserializer.h"
+#include "AdaptiveCardParseException.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+// Parses one card with a fresh ParseContext set up like context. Anything the card throws is returned as its error so
+// that it can't escape the worker thread or affect the rest of the batch.
+template <typename Fn>
+BatchParseResult DeserializeCard(const ParseContext& context, const Fn& deserialize)
+{
+    ParseContext cardContext(context.elementParserRegistration, context.actionParserRegistration);
+    cardContext.SetLanguage(context.GetLanguage());
+    cardContext.SetCanFallbackToAncestor(context.GetCanFallbackToAncestor());
+    cardContext.SetDeferShowCardParsing(context.GetDeferShowCardParsing());
+    if (const auto& arena = context.GetArena())
+    {
+        cardContext.SetArena(std::make_shared<ParseArena>(arena->GetInitialChunkSize()));
+    }
+    try
+    {
+        return deserialize(cardContext);
+    }
+    catch (const AdaptiveCardParseException& e)
+    {
+        return ParseError{e.GetStatusCode(), e.GetReason()};
+    }
+    catch (const Json::Exception& e)
+    {
+        return ParseError{ErrorStatusCode::InvalidJson, e.what()};
+    }
+    catch (const std::exception& e)
+    {
+        return ParseError{ErrorStatusCode::CustomError, e.what()};
+    }
+    catch (...)
+    {
+        return ParseError{ErrorStatusCode::CustomError, "Unknown error while parsing card"};
+    }
+}
+} // namespace
+
+BatchDeserializer::BatchDeserializer(unsigned int threadCount) :
+    m_threadPool(std::make_shared<ThreadPool>(
+        threadCount != 0 ? threadCount : std::max(std::thread::hardware_concurrency(), 1U)))
+{
+}
+
+unsigned int BatchDeserializer::GetThreadCount() const
+{
+    return m_threadPool->GetThreadCount();
+}
+
+std::vector<BatchParseResult> BatchDeserializer::DeserializeBatch(
+    const std::vector<std::string>& jsonStrings, const std::string& rendererVersion) const
+{
+    return DeserializeBatch(jsonStrings, rendererVersion, ParseContext());
+}
+
+std::vector<BatchParseResult> BatchDeserializer::DeserializeBatch(
+    const std::vector<std::string>& jsonStrings, const std::string& rendererVersion, const ParseContext& context) const
+{
+    std::vector<BatchParseResult> results(jsonStrings.size(), BatchParseResult(std::shared_ptr<ParseResult>()));
+    m_threadPool->ParallelFor(jsonStrings.size(), [&](size_t i) {
+        results[i] = DeserializeCard(context, [&](ParseContext& cardContext) {
+            return AdaptiveCard::DeserializeFromString(jsonStrings[i], rendererVersion, cardContext);
+        });
+    });
+    return results;
+}
+
+std::vector<BatchParseResult> BatchDeserializer::DeserializeBatch(
+    const std::vector<Json::Value>& jsonValues, const std::string& rendererVersion) const
+{
+    return DeserializeBatch(jsonValues, rendererVersion, ParseContext());
+}
+
+std::vector<BatchParseResult> BatchDeserializer::DeserializeBatch(
+    const std::vector<Json::Value>& jsonValues, const std::string& rendererVersion, const ParseContext& context) const
+{
+    std::vector<BatchParseResult> results(jsonValues.size(), BatchParseResult(std::shared_ptr<ParseResult>()));
+    m_threadPool->ParallelFor(jsonValues.size(), [&](size_t i) {
+        results[i] = DeserializeCard(context, [&](ParseContext& cardContext) {
+            return AdaptiveCard::Deserialize(jsonValues[i], rendererVersion, cardContext);
+        });
+    });
+    return results;
+}
@@ -0,0 +1,54 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "ParseContext.h"
+#include "ParseOutcome.h"
+#include "ParseResult.h"
+#include "ThreadPool.h"
+
+namespace AdaptiveCards
+{
+// The parsed card and its warnings, or the error that card failed with
+using BatchParseResult = ParseOutcome<std::shared_ptr<ParseResult>>;
+
+// Deserializes many cards at once, spreading them over a number of threads. Every card is parsed with its own
+// ParseContext, so one card's warnings, ids and errors never affect another's, and the results come back in the
+// same order as the input.
+//
+// Each card's ParseContext is set up as the one passed in is: its language, whether it can fall back to an ancestor
+// and whether it defers ShowCard parsing are copied. Its parser registrations are shared by all threads; the built-in
+// parsers are safe to share, but custom parsers registered on it must be safe to call from several threads at once.
+// An arena can only be used by one parse at a time, so if it has one each card gets an arena of its own, built with
+// the same initial chunk size. Its warnings and the ids it has seen aren't copied.
+//
+// The threads are started when the deserializer is built and reused by every batch it deserializes (and shared by its
+// copies), so build one and keep it rather than building one per batch. A batch started while another is being
+// deserialized on the same threads waits for it to finish.
+class BatchDeserializer
+{
+public:
+    // threadCount of 0 uses one thread per hardware thread
+    explicit BatchDeserializer(unsigned int threadCount = 0);
+
+    // The threads the deserializer has, counting the calling thread: fewer than it was built with if the system
+    // couldn't start them all
+    unsigned int GetThreadCount() const;
+
+    std::vector<BatchParseResult> DeserializeBatch(
+        const std::vector<std::string>& jsonStrings, const std::string& rendererVersion) const;
+    std::vector<BatchParseResult> DeserializeBatch(const std::vector<std::string>& jsonStrings,
+                                                   const std::string& rendererVersion,
+                                                   const ParseContext& context) const;
+
+    std::vector<BatchParseResult> DeserializeBatch(
+        const std::vector<Json::Value>& jsonValues, const std::string& rendererVersion) const;
+    std::vector<BatchParseResult> DeserializeBatch(const std::vector<Json::Value>& jsonValues,
+                                                   const std::string& rendererVersion,
+                                                   const ParseContext& context) const;
+
+private:
+    std::shared_ptr<ThreadPool> m_threadPool;
+};
+} // namespace AdaptiveCards
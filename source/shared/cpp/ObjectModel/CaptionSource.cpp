@@ -10,7 +10,7 @@ Json::Value CaptionSource::SerializeToJsonValue() const
     auto root = ContentSource::SerializeToJsonValue();
     if (!m_label.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Label)] = m_label;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Label)] = m_label;
     }
 
     return root;
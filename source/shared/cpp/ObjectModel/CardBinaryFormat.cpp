@@ -0,0 +1,1807 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "CardBinaryFormat.h"
+#include "ActionSet.h"
+#include "AuthCardButton.h"
+#include "Authentication.h"
+#include "BackgroundImage.h"
+#include "CaptionSource.h"
+#include "ChoiceInput.h"
+#include "ChoiceSetInput.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "DateInput.h"
+#include "ExecuteAction.h"
+#include "Fact.h"
+#include "FactSet.h"
+#include "Image.h"
+#include "ImageSet.h"
+#include "Media.h"
+#include "MediaSource.h"
+#include "NumberInput.h"
+#include "OpenUrlAction.h"
+#include "ParseContext.h"
+#include "Refresh.h"
+#include "RichTextBlock.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+#include "SubmitAction.h"
+#include "Table.h"
+#include "TableCell.h"
+#include "TableColumnDefinition.h"
+#include "TableRow.h"
+#include "TextBlock.h"
+#include "TextInput.h"
+#include "TextRun.h"
+#include "TimeInput.h"
+#include "ToggleInput.h"
+#include "ToggleVisibilityAction.h"
+#include "ToggleVisibilityTarget.h"
+#include "TokenExchangeResource.h"
+#include "UnknownAction.h"
+#include "UnknownElement.h"
+#include <cstring>
+
+using namespace AdaptiveCards;
+
+namespace
+{
+constexpr char c_magic[] = {'A', 'C', 'B', 'F'};
+
+// Tags in front of elements, actions and inlines; any other tag is the element's type plus c_firstTypeTag
+constexpr unsigned int c_noElement = 0;
+constexpr unsigned int c_jsonElement = 1;
+constexpr unsigned int c_firstTypeTag = 2;
+
+enum class JsonTag : unsigned int
+{
+    Null = 0,
+    False,
+    True,
+    Int,
+    UInt,
+    Real,
+    String,
+    Array,
+    Object
+};
+
+// Flags of BaseCardElement
+constexpr unsigned int c_separatorFlag = 1;
+constexpr unsigned int c_isVisibleFlag = 2;
+
+// Flags of StyledCollectionElement
+constexpr unsigned int c_paddingFlag = 1;
+constexpr unsigned int c_bleedFlag = 2;
+
+// Anything nested deeper than this is taken to be corrupt, rather than read until the stack runs out
+constexpr unsigned int c_maxNesting = 1000;
+
+bool IsWrittenAsJson(CardElementType type)
+{
+    switch (type)
+    {
+    case CardElementType::ActionSet:
+    case CardElementType::ChoiceSetInput:
+    case CardElementType::Column:
+    case CardElementType::ColumnSet:
+    case CardElementType::Container:
+    case CardElementType::DateInput:
+    case CardElementType::FactSet:
+    case CardElementType::Image:
+    case CardElementType::ImageSet:
+    case CardElementType::Media:
+    case CardElementType::NumberInput:
+    case CardElementType::RichTextBlock:
+    case CardElementType::Table:
+    case CardElementType::TableCell:
+    case CardElementType::TableRow:
+    case CardElementType::TextBlock:
+    case CardElementType::TextInput:
+    case CardElementType::TimeInput:
+    case CardElementType::ToggleInput:
+    case CardElementType::Unknown:
+        return false;
+    default:
+        return true;
+    }
+}
+
+bool IsWrittenAsJson(ActionType type)
+{
+    switch (type)
+    {
+    case ActionType::Execute:
+    case ActionType::OpenUrl:
+    case ActionType::ShowCard:
+    case ActionType::Submit:
+    case ActionType::ToggleVisibility:
+    case ActionType::UnknownAction:
+        return false;
+    default:
+        return true;
+    }
+}
+
+void AppendUInt(std::vector<char>& output, std::uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        output.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    output.push_back(static_cast<char>(value));
+}
+
+[[noreturn]] void ThrowInvalidBinaryCard(const std::string& reason)
+{
+    throw AdaptiveCardParseException(ErrorStatusCode::InvalidJson, "Invalid binary card: " + reason);
+}
+
+// Whether a number read for an enum is one of its values. Those of enums with a string mapping must be mapped, or
+// the card would be loaded only for Serialize to throw; the exception is a 0 with no string, which is the None of
+// ContainerStyle and ImageSize that elements have when the property isn't set (and so isn't written).
+template <typename T>
+bool IsEnumValue(std::uint32_t value)
+{
+    return value == 0 || EnumHelpers::getEnum(T{}).isMapped(static_cast<T>(value));
+}
+
+template <>
+bool IsEnumValue<JsonTag>(std::uint32_t value)
+{
+    return value <= static_cast<std::uint32_t>(JsonTag::Object);
+}
+
+template <>
+bool IsEnumValue<FallbackType>(std::uint32_t value)
+{
+    return value <= static_cast<std::uint32_t>(FallbackType::Content);
+}
+
+template <>
+bool IsEnumValue<IsVisible>(std::uint32_t value)
+{
+    return value <= static_cast<std::uint32_t>(IsVisibleFalse);
+}
+
+template <>
+bool IsEnumValue<ContainerBleedDirection>(std::uint32_t value)
+{
+    return (value & ~static_cast<std::uint32_t>(ContainerBleedDirection::BleedAll)) == 0;
+}
+} // namespace
+
+namespace AdaptiveCards
+{
+std::uint64_t CardBinaryStringPool::Add(const std::string& value)
+{
+    if (value.empty())
+    {
+        return 0;
+    }
+
+    const auto inserted = m_indexes.emplace(value, m_strings.size() + 1);
+    if (inserted.second)
+    {
+        m_strings.push_back(&inserted.first->first);
+    }
+    return inserted.first->second;
+}
+
+class CardBinaryWriter
+{
+public:
+    explicit CardBinaryWriter(CardBinaryStringPool& strings) : m_strings(strings) {}
+
+    std::vector<char> Write(const AdaptiveCard& card)
+    {
+        WriteCard(card);
+        return std::move(m_card);
+    }
+
+private:
+    void WriteUInt(std::uint64_t value) { AppendUInt(m_card, value); }
+
+    void WriteInt(std::int64_t value)
+    {
+        WriteUInt((static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+    }
+
+    void WriteBool(bool value) { WriteUInt(value ? 1 : 0); }
+
+    void WriteDouble(double value)
+    {
+        std::uint64_t bits;
+        static_assert(sizeof(bits) == sizeof(value), "double is expected to be 64 bits");
+        std::memcpy(&bits, &value, sizeof(bits));
+        for (int i = 0; i < 8; ++i)
+        {
+            m_card.push_back(static_cast<char>(bits >> (8 * i)));
+        }
+    }
+
+    template <typename T>
+    void WriteEnum(T value)
+    {
+        WriteUInt(static_cast<std::uint64_t>(value));
+    }
+
+    template <typename T>
+    void WriteOptionalEnum(const std::optional<T>& value)
+    {
+        WriteUInt(value.has_value() ? static_cast<std::uint64_t>(*value) + 1 : 0);
+    }
+
+    void WriteOptionalBool(const std::optional<bool>& value) { WriteUInt(value.has_value() ? (*value ? 2 : 1) : 0); }
+
+    void WriteOptionalUInt(const std::optional<unsigned int>& value)
+    {
+        WriteUInt(value.has_value() ? static_cast<std::uint64_t>(*value) + 1 : 0);
+    }
+
+    void WriteOptionalDouble(const std::optional<double>& value)
+    {
+        WriteBool(value.has_value());
+        if (value.has_value())
+        {
+            WriteDouble(*value);
+        }
+    }
+
+    void WriteString(const std::string& value) { WriteUInt(m_strings.Add(value)); }
+
+    void WriteJson(const Json::Value& value)
+    {
+        switch (value.type())
+        {
+        case Json::nullValue:
+            WriteEnum(JsonTag::Null);
+            break;
+        case Json::booleanValue:
+            WriteEnum(value.asBool() ? JsonTag::True : JsonTag::False);
+            break;
+        case Json::intValue:
+            WriteEnum(JsonTag::Int);
+            WriteInt(value.asLargestInt());
+            break;
+        case Json::uintValue:
+            WriteEnum(JsonTag::UInt);
+            WriteUInt(value.asLargestUInt());
+            break;
+        case Json::realValue:
+            WriteEnum(JsonTag::Real);
+            WriteDouble(value.asDouble());
+            break;
+        case Json::stringValue:
+            WriteEnum(JsonTag::String);
+            WriteString(value.asString());
+            break;
+        case Json::arrayValue:
+            WriteEnum(JsonTag::Array);
+            WriteUInt(value.size());
+            for (const auto& item : value)
+            {
+                WriteJson(item);
+            }
+            break;
+        case Json::objectValue:
+            WriteEnum(JsonTag::Object);
+            WriteUInt(value.size());
+            for (auto it = value.begin(); it != value.end(); ++it)
+            {
+                WriteString(it.name());
+                WriteJson(*it);
+            }
+            break;
+        }
+    }
+
+    void WriteCard(const AdaptiveCard& card)
+    {
+        WriteString(card.GetVersion());
+        WriteString(card.GetFallbackText());
+        WriteBackgroundImage(card.GetBackgroundImage());
+        WriteRefresh(card.GetRefresh());
+        WriteAuthentication(card.GetAuthentication());
+        WriteString(card.GetSpeak());
+        WriteString(card.GetLanguage());
+        WriteEnum(card.GetStyle());
+        WriteEnum(card.GetVerticalContentAlignment());
+        WriteEnum(card.GetHeight());
+        WriteUInt(card.GetMinHeight());
+        WriteOptionalBool(card.GetRtl());
+        WriteElements(card.GetBody());
+        WriteActions(card.GetActions());
+        WriteAction(card.GetSelectAction());
+        WriteJson(card.GetAdditionalProperties());
+    }
+
+    void WriteBackgroundImage(const std::shared_ptr<BackgroundImage>& backgroundImage)
+    {
+        WriteBool(backgroundImage != nullptr);
+        if (backgroundImage)
+        {
+            WriteString(backgroundImage->GetUrl());
+            WriteEnum(backgroundImage->GetFillMode());
+            WriteEnum(backgroundImage->GetHorizontalAlignment());
+            WriteEnum(backgroundImage->GetVerticalAlignment());
+        }
+    }
+
+    void WriteRefresh(const std::shared_ptr<Refresh>& refresh)
+    {
+        WriteBool(refresh != nullptr);
+        if (refresh)
+        {
+            WriteAction(refresh->GetAction());
+            WriteUInt(refresh->GetUserIds().size());
+            for (const auto& userId : refresh->GetUserIds())
+            {
+                WriteString(userId);
+            }
+        }
+    }
+
+    void WriteAuthentication(const std::shared_ptr<Authentication>& authentication)
+    {
+        WriteBool(authentication != nullptr);
+        if (!authentication)
+        {
+            return;
+        }
+
+        const Authentication& constAuthentication = *authentication;
+        WriteString(constAuthentication.GetText());
+        WriteString(constAuthentication.GetConnectionName());
+
+        const auto tokenExchangeResource = constAuthentication.GetTokenExchangeResource();
+        WriteBool(tokenExchangeResource != nullptr);
+        if (tokenExchangeResource)
+        {
+            const TokenExchangeResource& resource = *tokenExchangeResource;
+            WriteString(resource.GetId());
+            WriteString(resource.GetUri());
+            WriteString(resource.GetProviderId());
+        }
+
+        WriteUInt(constAuthentication.GetButtons().size());
+        for (const auto& button : constAuthentication.GetButtons())
+        {
+            WriteBool(button != nullptr);
+            if (button)
+            {
+                const AuthCardButton& constButton = *button;
+                WriteString(constButton.GetType());
+                WriteString(constButton.GetTitle());
+                WriteString(constButton.GetImage());
+                WriteString(constButton.GetValue());
+            }
+        }
+    }
+
+    template <typename T>
+    void WriteElements(const std::vector<std::shared_ptr<T>>& elements)
+    {
+        WriteUInt(elements.size());
+        for (const auto& element : elements)
+        {
+            WriteElement(element);
+        }
+    }
+
+    void WriteActions(const std::vector<std::shared_ptr<BaseActionElement>>& actions)
+    {
+        WriteUInt(actions.size());
+        for (const auto& action : actions)
+        {
+            WriteAction(action);
+        }
+    }
+
+    void WriteBaseElement(const BaseElement& element, bool isAction)
+    {
+        WriteString(element.GetElementTypeString());
+        WriteString(element.GetId());
+        WriteEnum(element.GetFallbackType());
+        if (element.GetFallbackType() == FallbackType::Content)
+        {
+            // the fallback content of an element is always another element, and that of an action another action
+            const auto& fallbackContent = element.GetFallbackContent();
+            if (isAction)
+            {
+                WriteAction(std::static_pointer_cast<BaseActionElement>(fallbackContent));
+            }
+            else
+            {
+                WriteElement(std::static_pointer_cast<BaseCardElement>(fallbackContent));
+            }
+        }
+
+        WriteUInt(element.GetRequirements().size());
+        for (const auto& requirement : element.GetRequirements())
+        {
+            WriteString(requirement.first);
+            WriteString(static_cast<std::string>(requirement.second));
+        }
+
+        WriteJson(element.GetAdditionalProperties());
+        WriteBool(element.CanFallbackToAncestor());
+    }
+
+    void WriteBaseCardElement(const BaseCardElement& element)
+    {
+        WriteBaseElement(element, false);
+        WriteEnum(element.GetHeight());
+        WriteEnum(element.GetSpacing());
+        WriteUInt((element.GetSeparator() ? c_separatorFlag : 0) | (element.GetIsVisible() ? c_isVisibleFlag : 0));
+    }
+
+    void WriteBaseInputElement(const BaseInputElement& input)
+    {
+        WriteBaseCardElement(input);
+        WriteBool(input.GetIsRequired());
+        WriteString(input.GetErrorMessage());
+        WriteString(input.GetLabel());
+    }
+
+    void WriteElement(const std::shared_ptr<BaseCardElement>& element)
+    {
+        if (!element)
+        {
+            WriteUInt(c_noElement);
+            return;
+        }
+
+        const CardElementType type = element->GetElementType();
+        if (IsWrittenAsJson(type))
+        {
+            WriteUInt(c_jsonElement);
+            WriteJson(element->SerializeToJsonValue());
+            return;
+        }
+
+        WriteUInt(static_cast<std::uint64_t>(type) + c_firstTypeTag);
+        switch (type)
+        {
+        case CardElementType::ActionSet:
+            WriteBaseCardElement(*element);
+            WriteActions(static_cast<const ActionSet&>(*element).GetActions());
+            break;
+        case CardElementType::ChoiceSetInput:
+            WriteChoiceSetInput(static_cast<const ChoiceSetInput&>(*element));
+            break;
+        case CardElementType::Column:
+            WriteColumn(static_cast<const Column&>(*element));
+            break;
+        case CardElementType::ColumnSet:
+        {
+            const auto& columnSet = static_cast<const ColumnSet&>(*element);
+            WriteStyledCollection(columnSet, [&]() { WriteElements(columnSet.GetColumns()); });
+            break;
+        }
+        case CardElementType::Container:
+        case CardElementType::TableCell:
+            WriteContainer(static_cast<const Container&>(*element));
+            break;
+        case CardElementType::DateInput:
+        {
+            const auto& dateInput = static_cast<const DateInput&>(*element);
+            WriteBaseInputElement(dateInput);
+            WriteString(dateInput.GetMax());
+            WriteString(dateInput.GetMin());
+            WriteString(dateInput.GetPlaceholder());
+            WriteString(dateInput.GetValue());
+            break;
+        }
+        case CardElementType::FactSet:
+            WriteFactSet(static_cast<const FactSet&>(*element));
+            break;
+        case CardElementType::Image:
+            WriteImage(static_cast<const Image&>(*element));
+            break;
+        case CardElementType::ImageSet:
+        {
+            const auto& imageSet = static_cast<const ImageSet&>(*element);
+            WriteBaseCardElement(imageSet);
+            WriteEnum(imageSet.GetImageSize());
+            WriteElements(imageSet.GetImages());
+            break;
+        }
+        case CardElementType::Media:
+            WriteMedia(static_cast<const Media&>(*element));
+            break;
+        case CardElementType::NumberInput:
+        {
+            const auto& numberInput = static_cast<const NumberInput&>(*element);
+            WriteBaseInputElement(numberInput);
+            WriteString(numberInput.GetPlaceholder());
+            WriteOptionalDouble(numberInput.GetValue());
+            WriteOptionalDouble(numberInput.GetMax());
+            WriteOptionalDouble(numberInput.GetMin());
+            break;
+        }
+        case CardElementType::RichTextBlock:
+            WriteRichTextBlock(static_cast<const RichTextBlock&>(*element));
+            break;
+        case CardElementType::Table:
+            WriteTable(static_cast<const Table&>(*element));
+            break;
+        case CardElementType::TableRow:
+            WriteTableRow(static_cast<const TableRow&>(*element));
+            break;
+        case CardElementType::TextBlock:
+            WriteTextBlock(static_cast<const TextBlock&>(*element));
+            break;
+        case CardElementType::TextInput:
+            WriteTextInput(static_cast<const TextInput&>(*element));
+            break;
+        case CardElementType::TimeInput:
+        {
+            const auto& timeInput = static_cast<const TimeInput&>(*element);
+            WriteBaseInputElement(timeInput);
+            WriteString(timeInput.GetMax());
+            WriteString(timeInput.GetMin());
+            WriteString(timeInput.GetPlaceholder());
+            WriteString(timeInput.GetValue());
+            break;
+        }
+        case CardElementType::ToggleInput:
+        {
+            const auto& toggleInput = static_cast<const ToggleInput&>(*element);
+            WriteBaseInputElement(toggleInput);
+            WriteString(toggleInput.GetTitle());
+            WriteString(toggleInput.GetValue());
+            WriteString(toggleInput.GetValueOff());
+            WriteString(toggleInput.GetValueOn());
+            WriteBool(toggleInput.GetWrap());
+            break;
+        }
+        default:
+            // an UnknownElement keeps all of its JSON in its additional properties
+            WriteBaseCardElement(*element);
+            break;
+        }
+    }
+
+    void WriteChoiceSetInput(const ChoiceSetInput& choiceSet)
+    {
+        WriteBaseInputElement(choiceSet);
+        WriteBool(choiceSet.GetIsMultiSelect());
+        WriteEnum(choiceSet.GetChoiceSetStyle());
+        WriteString(choiceSet.GetValue());
+        WriteBool(choiceSet.GetWrap());
+        WriteString(choiceSet.GetPlaceholder());
+        WriteUInt(choiceSet.GetChoices().size());
+        for (const auto& choice : choiceSet.GetChoices())
+        {
+            WriteBool(choice != nullptr);
+            if (choice)
+            {
+                WriteString(choice->GetTitle());
+                WriteString(choice->GetValue());
+            }
+        }
+    }
+
+    // Writes what the collection holds with writeChildren, in between its own properties and its selectAction
+    template <typename WriteChildren>
+    void WriteStyledCollection(const StyledCollectionElement& collection, WriteChildren&& writeChildren)
+    {
+        WriteBaseCardElement(collection);
+        WriteEnum(collection.GetStyle());
+        WriteOptionalEnum(collection.GetVerticalContentAlignment());
+        WriteUInt((collection.GetPadding() ? c_paddingFlag : 0) | (collection.GetBleed() ? c_bleedFlag : 0));
+        WriteEnum(collection.GetBleedDirection());
+
+        // the collection that it bleeds into is one of the collections it's in, written as how many levels up
+        unsigned int bleedParent = 0;
+        const InternalId parentalId = collection.GetParentalId();
+        if (parentalId != InternalId::Invalid)
+        {
+            const auto found = std::find(m_collections.crbegin(), m_collections.crend(), parentalId);
+            if (found != m_collections.crend())
+            {
+                bleedParent = static_cast<unsigned int>(found - m_collections.crbegin()) + 1;
+            }
+        }
+        WriteUInt(bleedParent);
+
+        WriteUInt(collection.GetMinHeight());
+        WriteBackgroundImage(collection.GetBackgroundImage());
+
+        m_collections.push_back(collection.GetInternalId());
+        writeChildren();
+        m_collections.pop_back();
+
+        WriteAction(collection.GetSelectAction());
+    }
+
+    void WriteContainer(const Container& container)
+    {
+        WriteStyledCollection(container, [&]() { WriteElements(container.GetItems()); });
+        WriteOptionalBool(container.GetRtl());
+    }
+
+    void WriteColumn(const Column& column)
+    {
+        WriteStyledCollection(column, [&]() { WriteElements(column.GetItems()); });
+        WriteString(column.GetWidth());
+        WriteOptionalBool(column.GetRtl());
+    }
+
+    void WriteFactSet(const FactSet& factSet)
+    {
+        WriteBaseCardElement(factSet);
+        WriteUInt(factSet.GetFacts().size());
+        for (const auto& fact : factSet.GetFacts())
+        {
+            WriteBool(fact != nullptr);
+            if (fact)
+            {
+                WriteString(fact->GetTitle());
+                WriteString(fact->GetValue());
+                WriteString(fact->GetLanguage());
+            }
+        }
+    }
+
+    void WriteImage(const Image& image)
+    {
+        WriteBaseCardElement(image);
+        WriteString(image.GetUrl());
+        WriteString(image.GetBackgroundColor());
+        WriteEnum(image.GetImageStyle());
+        WriteEnum(image.GetImageSize());
+        WriteUInt(image.GetPixelWidth());
+        WriteUInt(image.GetPixelHeight());
+        WriteString(image.GetAltText());
+        WriteOptionalEnum(image.GetHorizontalAlignment());
+        WriteAction(image.GetSelectAction());
+    }
+
+    void WriteMedia(const Media& media)
+    {
+        WriteBaseCardElement(media);
+        WriteString(media.GetPoster());
+        WriteString(media.GetAltText());
+
+        WriteUInt(media.GetSources().size());
+        for (const auto& source : media.GetSources())
+        {
+            WriteBool(source != nullptr);
+            if (source)
+            {
+                WriteString(source->GetMimeType());
+                WriteString(source->GetUrl());
+            }
+        }
+
+        WriteUInt(media.GetCaptionSources().size());
+        for (const auto& captionSource : media.GetCaptionSources())
+        {
+            WriteBool(captionSource != nullptr);
+            if (captionSource)
+            {
+                WriteString(captionSource->GetMimeType());
+                WriteString(captionSource->GetUrl());
+                WriteString(captionSource->GetLabel());
+            }
+        }
+    }
+
+    template <typename T>
+    void WriteTextElementProperties(const T& text)
+    {
+        WriteString(text.GetText());
+        WriteOptionalEnum(text.GetTextSize());
+        WriteOptionalEnum(text.GetTextWeight());
+        WriteOptionalEnum(text.GetFontType());
+        WriteOptionalEnum(text.GetTextColor());
+        WriteOptionalBool(text.GetIsSubtle());
+        WriteString(text.GetLanguage());
+    }
+
+    void WriteTextBlock(const TextBlock& textBlock)
+    {
+        WriteBaseCardElement(textBlock);
+        WriteTextElementProperties(textBlock);
+        WriteBool(textBlock.GetWrap());
+        WriteUInt(textBlock.GetMaxLines());
+        WriteOptionalEnum(textBlock.GetHorizontalAlignment());
+        WriteOptionalEnum(textBlock.GetStyle());
+    }
+
+    void WriteRichTextBlock(const RichTextBlock& richTextBlock)
+    {
+        WriteBaseCardElement(richTextBlock);
+        WriteOptionalEnum(richTextBlock.GetHorizontalAlignment());
+        WriteUInt(richTextBlock.GetInlines().size());
+        for (const auto& inlineElement : richTextBlock.GetInlines())
+        {
+            if (!inlineElement)
+            {
+                WriteUInt(c_noElement);
+            }
+            else if (inlineElement->GetInlineType() != InlineElementType::TextRun)
+            {
+                WriteUInt(c_jsonElement);
+                WriteJson(inlineElement->SerializeToJsonValue());
+            }
+            else
+            {
+                const auto& textRun = static_cast<const TextRun&>(*inlineElement);
+                WriteUInt(static_cast<std::uint64_t>(InlineElementType::TextRun) + c_firstTypeTag);
+                WriteTextElementProperties(textRun);
+                WriteBool(textRun.GetItalic());
+                WriteBool(textRun.GetStrikethrough());
+                WriteBool(textRun.GetUnderline());
+                WriteBool(textRun.GetHighlight());
+                WriteAction(textRun.GetSelectAction());
+                WriteJson(textRun.GetAdditionalProperties());
+            }
+        }
+    }
+
+    void WriteTable(const Table& table)
+    {
+        WriteBaseCardElement(table);
+        WriteUInt(table.GetColumns().size());
+        for (const auto& column : table.GetColumns())
+        {
+            WriteBool(column != nullptr);
+            if (column)
+            {
+                WriteOptionalEnum(column->GetHorizontalCellContentAlignment());
+                WriteOptionalEnum(column->GetVerticalCellContentAlignment());
+                WriteOptionalUInt(column->GetWidth());
+                WriteOptionalUInt(column->GetPixelWidth());
+            }
+        }
+        WriteElements(table.GetRows());
+        WriteBool(table.GetShowGridLines());
+        WriteBool(table.GetFirstRowAsHeaders());
+        WriteOptionalEnum(table.GetHorizontalCellContentAlignment());
+        WriteOptionalEnum(table.GetVerticalCellContentAlignment());
+        WriteEnum(table.GetGridStyle());
+    }
+
+    void WriteTableRow(const TableRow& row)
+    {
+        WriteBaseCardElement(row);
+        WriteOptionalEnum(row.GetHorizontalCellContentAlignment());
+        WriteOptionalEnum(row.GetVerticalCellContentAlignment());
+        WriteEnum(row.GetStyle());
+        WriteElements(row.GetCells());
+    }
+
+    void WriteTextInput(const TextInput& textInput)
+    {
+        WriteBaseInputElement(textInput);
+        WriteString(textInput.GetPlaceholder());
+        WriteString(textInput.GetValue());
+        WriteString(textInput.GetRegex());
+        WriteBool(textInput.GetIsMultiline());
+        WriteUInt(textInput.GetMaxLength());
+        WriteEnum(textInput.GetTextInputStyle());
+        WriteAction(textInput.GetInlineAction());
+    }
+
+    void WriteAction(const std::shared_ptr<BaseActionElement>& action)
+    {
+        if (!action)
+        {
+            WriteUInt(c_noElement);
+            return;
+        }
+
+        const ActionType type = action->GetElementType();
+        if (IsWrittenAsJson(type))
+        {
+            WriteUInt(c_jsonElement);
+            WriteJson(action->SerializeToJsonValue());
+            return;
+        }
+
+        WriteUInt(static_cast<std::uint64_t>(type) + c_firstTypeTag);
+        WriteBaseElement(*action, true);
+        WriteString(action->GetTitle());
+        WriteString(action->GetIconUrl());
+        WriteString(action->GetStyle());
+        WriteString(action->GetTooltip());
+        WriteEnum(action->GetMode());
+        WriteBool(action->GetIsEnabled());
+
+        switch (type)
+        {
+        case ActionType::Execute:
+        {
+            const auto& executeAction = static_cast<const ExecuteAction&>(*action);
+            WriteJson(executeAction.GetDataJsonAsValue());
+            WriteString(executeAction.GetVerb());
+            WriteEnum(executeAction.GetAssociatedInputs());
+            break;
+        }
+        case ActionType::OpenUrl:
+            WriteString(static_cast<const OpenUrlAction&>(*action).GetUrl());
+            break;
+        case ActionType::ShowCard:
+        {
+            const auto card = static_cast<const ShowCardAction&>(*action).GetCard();
+            WriteBool(card != nullptr);
+            if (card)
+            {
+                WriteCard(*card);
+            }
+            break;
+        }
+        case ActionType::Submit:
+        {
+            const auto& submitAction = static_cast<const SubmitAction&>(*action);
+            WriteJson(submitAction.GetDataJsonAsValue());
+            WriteEnum(submitAction.GetAssociatedInputs());
+            break;
+        }
+        case ActionType::ToggleVisibility:
+        {
+            const auto& targets = static_cast<const ToggleVisibilityAction&>(*action).GetTargetElements();
+            WriteUInt(targets.size());
+            for (const auto& target : targets)
+            {
+                WriteBool(target != nullptr);
+                if (target)
+                {
+                    WriteString(target->GetElementId());
+                    WriteEnum(target->GetIsVisible());
+                }
+            }
+            break;
+        }
+        default:
+            // an UnknownAction keeps all of its JSON in its additional properties
+            break;
+        }
+    }
+
+    std::vector<char> m_card;
+    CardBinaryStringPool& m_strings;
+    // internal ids of the collections being written, innermost last
+    std::vector<InternalId> m_collections;
+};
+
+class CardBinaryReader
+{
+public:
+    CardBinaryReader(const char* data, size_t size, ParseContext& context) :
+        m_position(data), m_end(data + size), m_context(context), m_sharedStrings(nullptr), m_nesting(0)
+    {
+    }
+
+    CardBinaryReader(const char* data, size_t size, const CardBinaryStringTable& strings, ParseContext& context) :
+        m_position(data), m_end(data + size), m_context(context), m_sharedStrings(&strings), m_nesting(0)
+    {
+    }
+
+    std::shared_ptr<AdaptiveCard> Read()
+    {
+        if (static_cast<size_t>(m_end - m_position) < sizeof(c_magic) ||
+            !std::equal(std::cbegin(c_magic), std::cend(c_magic), m_position))
+        {
+            ThrowInvalidBinaryCard("not a binary card");
+        }
+        m_position += sizeof(c_magic);
+
+        const auto version = ReadUInt();
+        if (version != c_cardBinaryFormatVersion)
+        {
+            ThrowInvalidBinaryCard("format version " + std::to_string(version) + " is not supported");
+        }
+
+        // the strings stay where they are in the data, and are only copied into the elements that use them
+        const size_t stringCount = ReadCount();
+        m_strings.reserve(stringCount);
+        for (size_t i = 0; i < stringCount; ++i)
+        {
+            const auto length = ReadUInt();
+            if (length > static_cast<std::uint64_t>(m_end - m_position))
+            {
+                ThrowInvalidBinaryCard("unexpected end of data");
+            }
+            m_strings.emplace_back(m_position, static_cast<size_t>(length));
+            m_position += length;
+        }
+
+        return ReadBody();
+    }
+
+    std::shared_ptr<AdaptiveCard> ReadBody()
+    {
+        auto card = ReadCard();
+        if (m_position != m_end)
+        {
+            ThrowInvalidBinaryCard("unexpected data after the card");
+        }
+        return card;
+    }
+
+private:
+    class NestingGuard
+    {
+    public:
+        explicit NestingGuard(unsigned int& nesting) : m_nesting(nesting)
+        {
+            if (++m_nesting > c_maxNesting)
+            {
+                ThrowInvalidBinaryCard("nested too deeply");
+            }
+        }
+        ~NestingGuard() { --m_nesting; }
+
+    private:
+        unsigned int& m_nesting;
+    };
+
+    std::uint64_t ReadUInt()
+    {
+        std::uint64_t value = 0;
+        for (unsigned int shift = 0; shift < 64; shift += 7)
+        {
+            if (m_position == m_end)
+            {
+                ThrowInvalidBinaryCard("unexpected end of data");
+            }
+
+            const auto byte = static_cast<unsigned char>(*m_position++);
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+            {
+                return value;
+            }
+        }
+        ThrowInvalidBinaryCard("invalid integer");
+    }
+
+    unsigned int ReadUInt32()
+    {
+        const auto value = ReadUInt();
+        if (value > std::numeric_limits<unsigned int>::max())
+        {
+            ThrowInvalidBinaryCard("integer out of range");
+        }
+        return static_cast<unsigned int>(value);
+    }
+
+    // Every item of a collection takes at least a byte, so a count larger than what is left can't be right
+    size_t ReadCount()
+    {
+        const auto count = ReadUInt();
+        if (count > static_cast<std::uint64_t>(m_end - m_position))
+        {
+            ThrowInvalidBinaryCard("unexpected end of data");
+        }
+        return static_cast<size_t>(count);
+    }
+
+    std::int64_t ReadInt()
+    {
+        const auto value = ReadUInt();
+        return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+    }
+
+    bool ReadBool() { return ReadUInt() != 0; }
+
+    double ReadDouble()
+    {
+        if (m_end - m_position < 8)
+        {
+            ThrowInvalidBinaryCard("unexpected end of data");
+        }
+
+        std::uint64_t bits = 0;
+        for (int i = 0; i < 8; ++i)
+        {
+            bits |= static_cast<std::uint64_t>(static_cast<unsigned char>(*m_position++)) << (8 * i);
+        }
+
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    template <typename T>
+    static T ToEnum(std::uint32_t value)
+    {
+        if (!IsEnumValue<T>(value))
+        {
+            ThrowInvalidBinaryCard("enum value " + std::to_string(value) + " out of range");
+        }
+        return static_cast<T>(value);
+    }
+
+    template <typename T>
+    T ReadEnum()
+    {
+        return ToEnum<T>(ReadUInt32());
+    }
+
+    template <typename T>
+    std::optional<T> ReadOptionalEnum()
+    {
+        const auto value = ReadUInt32();
+        return value == 0 ? std::nullopt : std::optional<T>(ToEnum<T>(value - 1));
+    }
+
+    std::optional<bool> ReadOptionalBool()
+    {
+        const auto value = ReadUInt();
+        return value == 0 ? std::nullopt : std::optional<bool>(value == 2);
+    }
+
+    std::optional<unsigned int> ReadOptionalUInt()
+    {
+        const auto value = ReadUInt();
+        if (value == 0)
+        {
+            return std::nullopt;
+        }
+        if (value - 1 > std::numeric_limits<unsigned int>::max())
+        {
+            ThrowInvalidBinaryCard("integer out of range");
+        }
+        return static_cast<unsigned int>(value - 1);
+    }
+
+    std::optional<double> ReadOptionalDouble()
+    {
+        return ReadBool() ? std::optional<double>(ReadDouble()) : std::nullopt;
+    }
+
+    std::string_view ReadStringView()
+    {
+        const auto index = ReadUInt();
+        if (index == 0)
+        {
+            return std::string_view("");
+        }
+        if (m_sharedStrings)
+        {
+            return m_sharedStrings->GetString(index);
+        }
+        if (index > m_strings.size())
+        {
+            ThrowInvalidBinaryCard("invalid string");
+        }
+        return m_strings[static_cast<size_t>(index - 1)];
+    }
+
+    std::string ReadString() { return std::string(ReadStringView()); }
+
+    Json::Value ReadJson()
+    {
+        NestingGuard guard(m_nesting);
+        switch (ReadEnum<JsonTag>())
+        {
+        case JsonTag::Null:
+            return Json::Value();
+        case JsonTag::False:
+            return Json::Value(false);
+        case JsonTag::True:
+            return Json::Value(true);
+        case JsonTag::Int:
+            return Json::Value(static_cast<Json::LargestInt>(ReadInt()));
+        case JsonTag::UInt:
+            return Json::Value(static_cast<Json::LargestUInt>(ReadUInt()));
+        case JsonTag::Real:
+            return Json::Value(ReadDouble());
+        case JsonTag::String:
+        {
+            const auto value = ReadStringView();
+            return Json::Value(value.data(), value.data() + value.size());
+        }
+        case JsonTag::Array:
+        {
+            Json::Value array(Json::arrayValue);
+            const size_t count = ReadCount();
+            for (size_t i = 0; i < count; ++i)
+            {
+                array.append(ReadJson());
+            }
+            return array;
+        }
+        case JsonTag::Object:
+        {
+            Json::Value object(Json::objectValue);
+            const size_t count = ReadCount();
+            for (size_t i = 0; i < count; ++i)
+            {
+                const std::string name(ReadStringView());
+                object[name] = ReadJson();
+            }
+            return object;
+        }
+        default:
+            ThrowInvalidBinaryCard("invalid JSON value");
+        }
+    }
+
+    std::shared_ptr<AdaptiveCard> ReadCard()
+    {
+        NestingGuard guard(m_nesting);
+        const auto version = ReadString();
+        const auto fallbackText = ReadString();
+        auto backgroundImage = ReadBackgroundImage();
+        auto refresh = ReadRefresh();
+        auto authentication = ReadAuthentication();
+        const auto speak = ReadString();
+        const auto language = ReadString();
+        const auto style = ReadEnum<ContainerStyle>();
+        const auto verticalContentAlignment = ReadEnum<VerticalContentAlignment>();
+        const auto height = ReadEnum<HeightType>();
+        const auto minHeight = ReadUInt32();
+        const auto rtl = ReadOptionalBool();
+
+        std::vector<std::shared_ptr<BaseCardElement>> body;
+        ReadElements(body);
+        std::vector<std::shared_ptr<BaseActionElement>> actions;
+        ReadActions(actions);
+
+        auto card = std::make_shared<AdaptiveCard>(
+            version, fallbackText, backgroundImage, refresh, authentication, style, speak, language,
+            verticalContentAlignment, height, minHeight, body, actions);
+        card->SetRtl(rtl);
+        card->SetSelectAction(ReadAction());
+        card->SetAdditionalProperties(ReadJson());
+        return card;
+    }
+
+    std::shared_ptr<BackgroundImage> ReadBackgroundImage()
+    {
+        if (!ReadBool())
+        {
+            return nullptr;
+        }
+
+        auto backgroundImage = std::make_shared<BackgroundImage>();
+        backgroundImage->SetUrl(ReadString());
+        backgroundImage->SetFillMode(ReadEnum<ImageFillMode>());
+        backgroundImage->SetHorizontalAlignment(ReadEnum<HorizontalAlignment>());
+        backgroundImage->SetVerticalAlignment(ReadEnum<VerticalAlignment>());
+        return backgroundImage;
+    }
+
+    std::shared_ptr<Refresh> ReadRefresh()
+    {
+        if (!ReadBool())
+        {
+            return nullptr;
+        }
+
+        auto refresh = std::make_shared<Refresh>();
+        refresh->SetAction(ReadAction());
+        std::vector<std::string> userIds(ReadCount());
+        for (auto& userId : userIds)
+        {
+            userId = ReadString();
+        }
+        refresh->SetUserIds(std::move(userIds));
+        return refresh;
+    }
+
+    std::shared_ptr<Authentication> ReadAuthentication()
+    {
+        if (!ReadBool())
+        {
+            return nullptr;
+        }
+
+        auto authentication = std::make_shared<Authentication>();
+        authentication->SetText(ReadString());
+        authentication->SetConnectionName(ReadString());
+
+        if (ReadBool())
+        {
+            auto resource = std::make_shared<TokenExchangeResource>();
+            resource->SetId(ReadString());
+            resource->SetUri(ReadString());
+            resource->SetProviderId(ReadString());
+            authentication->SetTokenExchangeResource(std::move(resource));
+        }
+
+        std::vector<std::shared_ptr<AuthCardButton>> buttons(ReadCount());
+        for (auto& button : buttons)
+        {
+            if (ReadBool())
+            {
+                button = std::make_shared<AuthCardButton>();
+                button->SetType(ReadString());
+                button->SetTitle(ReadString());
+                button->SetImage(ReadString());
+                button->SetValue(ReadString());
+            }
+        }
+        authentication->SetButtons(std::move(buttons));
+        return authentication;
+    }
+
+    void ReadElements(std::vector<std::shared_ptr<BaseCardElement>>& elements)
+    {
+        const size_t count = ReadCount();
+        elements.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            elements.push_back(ReadElement());
+        }
+    }
+
+    // For the collections that hold a single type of element (the columns of a ColumnSet, for instance)
+    template <typename T>
+    void ReadElementsOfType(std::vector<std::shared_ptr<T>>& elements, CardElementType type)
+    {
+        const size_t count = ReadCount();
+        elements.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto element = ReadElement();
+            if (element && element->GetElementType() != type)
+            {
+                ThrowInvalidBinaryCard("unexpected element type");
+            }
+            elements.push_back(std::static_pointer_cast<T>(element));
+        }
+    }
+
+    void ReadActions(std::vector<std::shared_ptr<BaseActionElement>>& actions)
+    {
+        const size_t count = ReadCount();
+        actions.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            actions.push_back(ReadAction());
+        }
+    }
+
+    void ReadBaseElement(BaseElement& element, bool isAction)
+    {
+        element.SetElementTypeString(ReadString());
+        element.SetId(ReadString());
+
+        const auto fallbackType = ReadEnum<FallbackType>();
+        element.SetFallbackType(fallbackType);
+        if (fallbackType == FallbackType::Content)
+        {
+            if (isAction)
+            {
+                element.SetFallbackContent(ReadAction());
+            }
+            else
+            {
+                element.SetFallbackContent(ReadElement());
+            }
+        }
+
+        const size_t requirementCount = ReadCount();
+        auto& requirements = element.GetRequirements();
+        for (size_t i = 0; i < requirementCount; ++i)
+        {
+            auto name = ReadString();
+            requirements.emplace(std::move(name), SemanticVersion(ReadString()));
+        }
+
+        element.SetAdditionalProperties(ReadJson());
+        element.SetCanFallbackToAncestor(ReadBool());
+    }
+
+    // Constructs an element of the type and reads the properties all elements have
+    template <typename T>
+    std::shared_ptr<T> MakeElement()
+    {
+        auto element = MakeSharedInArena<T>(m_context.GetArena());
+        ReadBaseElement(*element, false);
+        element->SetHeight(ReadEnum<HeightType>());
+        element->SetSpacing(ReadEnum<Spacing>());
+        const auto flags = ReadUInt();
+        element->SetSeparator((flags & c_separatorFlag) != 0);
+        element->SetIsVisible((flags & c_isVisibleFlag) != 0);
+        return element;
+    }
+
+    template <typename T>
+    std::shared_ptr<T> MakeInput()
+    {
+        auto input = MakeElement<T>();
+        input->SetIsRequired(ReadBool());
+        input->SetErrorMessage(ReadString());
+        input->SetLabel(ReadString());
+        return input;
+    }
+
+    std::shared_ptr<BaseCardElement> ReadElement()
+    {
+        NestingGuard guard(m_nesting);
+        const auto tag = ReadUInt();
+        if (tag == c_noElement)
+        {
+            return nullptr;
+        }
+        if (tag == c_jsonElement)
+        {
+            std::shared_ptr<BaseElement> element;
+            BaseCardElement::ParseJsonObject(m_context, ReadJson(), element);
+            return std::static_pointer_cast<BaseCardElement>(element);
+        }
+
+        // the element picks its internal id up from InternalId::Current when it's constructed, as when it's parsed
+        InternalId::Next();
+
+        switch (static_cast<CardElementType>(tag - c_firstTypeTag))
+        {
+        case CardElementType::ActionSet:
+        {
+            auto actionSet = MakeElement<ActionSet>();
+            ReadActions(actionSet->GetActions());
+            return actionSet;
+        }
+        case CardElementType::ChoiceSetInput:
+            return ReadChoiceSetInput();
+        case CardElementType::Column:
+            return ReadColumn();
+        case CardElementType::ColumnSet:
+            return ReadStyledCollection<ColumnSet>(
+                [this](ColumnSet& columnSet) { ReadElementsOfType(columnSet.GetColumns(), CardElementType::Column); });
+        case CardElementType::Container:
+            return ReadContainer<Container>();
+        case CardElementType::DateInput:
+        {
+            auto dateInput = MakeInput<DateInput>();
+            dateInput->SetMax(ReadString());
+            dateInput->SetMin(ReadString());
+            dateInput->SetPlaceholder(ReadString());
+            dateInput->SetValue(ReadString());
+            return dateInput;
+        }
+        case CardElementType::FactSet:
+            return ReadFactSet();
+        case CardElementType::Image:
+            return ReadImage();
+        case CardElementType::ImageSet:
+        {
+            auto imageSet = MakeElement<ImageSet>();
+            imageSet->SetImageSize(ReadEnum<ImageSize>());
+            ReadElementsOfType(imageSet->GetImages(), CardElementType::Image);
+            return imageSet;
+        }
+        case CardElementType::Media:
+            return ReadMedia();
+        case CardElementType::NumberInput:
+        {
+            auto numberInput = MakeInput<NumberInput>();
+            numberInput->SetPlaceholder(ReadString());
+            numberInput->SetValue(ReadOptionalDouble());
+            numberInput->SetMax(ReadOptionalDouble());
+            numberInput->SetMin(ReadOptionalDouble());
+            return numberInput;
+        }
+        case CardElementType::RichTextBlock:
+            return ReadRichTextBlock();
+        case CardElementType::Table:
+            return ReadTable();
+        case CardElementType::TableCell:
+            return ReadContainer<TableCell>();
+        case CardElementType::TableRow:
+        {
+            auto row = MakeElement<TableRow>();
+            row->SetHorizontalCellContentAlignment(ReadOptionalEnum<HorizontalAlignment>());
+            row->SetVerticalCellContentAlignment(ReadOptionalEnum<VerticalContentAlignment>());
+            row->SetStyle(ReadEnum<ContainerStyle>());
+            ReadElementsOfType(row->GetCells(), CardElementType::TableCell);
+            return row;
+        }
+        case CardElementType::TextBlock:
+            return ReadTextBlock();
+        case CardElementType::TextInput:
+            return ReadTextInput();
+        case CardElementType::TimeInput:
+        {
+            auto timeInput = MakeInput<TimeInput>();
+            timeInput->SetMax(ReadString());
+            timeInput->SetMin(ReadString());
+            timeInput->SetPlaceholder(ReadString());
+            timeInput->SetValue(ReadString());
+            return timeInput;
+        }
+        case CardElementType::ToggleInput:
+        {
+            auto toggleInput = MakeInput<ToggleInput>();
+            toggleInput->SetTitle(ReadString());
+            toggleInput->SetValue(ReadString());
+            toggleInput->SetValueOff(ReadString());
+            toggleInput->SetValueOn(ReadString());
+            toggleInput->SetWrap(ReadBool());
+            return toggleInput;
+        }
+        case CardElementType::Unknown:
+            return MakeElement<UnknownElement>();
+        default:
+            ThrowInvalidBinaryCard("invalid element type");
+        }
+    }
+
+    std::shared_ptr<ChoiceSetInput> ReadChoiceSetInput()
+    {
+        auto choiceSet = MakeInput<ChoiceSetInput>();
+        choiceSet->SetIsMultiSelect(ReadBool());
+        choiceSet->SetChoiceSetStyle(ReadEnum<ChoiceSetStyle>());
+        choiceSet->SetValue(ReadString());
+        choiceSet->SetWrap(ReadBool());
+        choiceSet->SetPlaceholder(ReadString());
+
+        auto& choices = choiceSet->GetChoices();
+        choices.resize(ReadCount());
+        for (auto& choice : choices)
+        {
+            if (ReadBool())
+            {
+                choice = MakeSharedInArena<ChoiceInput>(m_context.GetArena());
+                choice->SetTitle(ReadString());
+                choice->SetValue(ReadString());
+            }
+        }
+        return choiceSet;
+    }
+
+    // Reads what the collection holds with readChildren, in between its own properties and its selectAction
+    template <typename T, typename ReadChildren>
+    std::shared_ptr<T> ReadStyledCollection(ReadChildren&& readChildren)
+    {
+        auto collection = MakeElement<T>();
+        collection->SetStyle(ReadEnum<ContainerStyle>());
+        collection->SetVerticalContentAlignment(ReadOptionalEnum<VerticalContentAlignment>());
+        const auto flags = ReadUInt();
+        collection->SetPadding((flags & c_paddingFlag) != 0);
+        collection->SetBleed((flags & c_bleedFlag) != 0);
+        collection->SetBleedDirection(ReadEnum<ContainerBleedDirection>());
+
+        const auto bleedParent = ReadUInt();
+        if (bleedParent > m_collections.size())
+        {
+            ThrowInvalidBinaryCard("invalid bleed target");
+        }
+        if (bleedParent != 0)
+        {
+            collection->SetParentalId(m_collections[m_collections.size() - static_cast<size_t>(bleedParent)]);
+        }
+
+        collection->SetMinHeight(ReadUInt32());
+        collection->SetBackgroundImage(ReadBackgroundImage());
+
+        m_collections.push_back(collection->GetInternalId());
+        readChildren(*collection);
+        m_collections.pop_back();
+
+        collection->SetSelectAction(ReadAction());
+        return collection;
+    }
+
+    template <typename T>
+    std::shared_ptr<T> ReadContainer()
+    {
+        auto container = ReadStyledCollection<T>([this](T& collection) { ReadElements(collection.GetItems()); });
+        container->SetRtl(ReadOptionalBool());
+        return container;
+    }
+
+    std::shared_ptr<Column> ReadColumn()
+    {
+        auto column = ReadStyledCollection<Column>([this](Column& collection) { ReadElements(collection.GetItems()); });
+        column->SetWidth(ReadString());
+        column->SetRtl(ReadOptionalBool());
+        return column;
+    }
+
+    std::shared_ptr<FactSet> ReadFactSet()
+    {
+        auto factSet = MakeElement<FactSet>();
+        auto& facts = factSet->GetFacts();
+        facts.resize(ReadCount());
+        for (auto& fact : facts)
+        {
+            if (ReadBool())
+            {
+                fact = MakeSharedInArena<Fact>(m_context.GetArena());
+                fact->SetTitle(ReadString());
+                fact->SetValue(ReadString());
+                fact->SetLanguage(ReadString());
+            }
+        }
+        return factSet;
+    }
+
+    std::shared_ptr<Image> ReadImage()
+    {
+        auto image = MakeElement<Image>();
+        image->SetUrl(ReadString());
+        image->SetBackgroundColor(ReadString());
+        image->SetImageStyle(ReadEnum<ImageStyle>());
+        image->SetImageSize(ReadEnum<ImageSize>());
+        image->SetPixelWidth(ReadUInt32());
+        image->SetPixelHeight(ReadUInt32());
+        image->SetAltText(ReadString());
+        image->SetHorizontalAlignment(ReadOptionalEnum<HorizontalAlignment>());
+        image->SetSelectAction(ReadAction());
+        return image;
+    }
+
+    std::shared_ptr<Media> ReadMedia()
+    {
+        auto media = MakeElement<Media>();
+        media->SetPoster(ReadString());
+        media->SetAltText(ReadString());
+
+        auto& sources = media->GetSources();
+        sources.resize(ReadCount());
+        for (auto& source : sources)
+        {
+            if (ReadBool())
+            {
+                source = std::make_shared<MediaSource>();
+                source->SetMimeType(ReadString());
+                source->SetUrl(ReadString());
+            }
+        }
+
+        auto& captionSources = media->GetCaptionSources();
+        captionSources.resize(ReadCount());
+        for (auto& captionSource : captionSources)
+        {
+            if (ReadBool())
+            {
+                captionSource = std::make_shared<CaptionSource>();
+                captionSource->SetMimeType(ReadString());
+                captionSource->SetUrl(ReadString());
+                captionSource->SetLabel(ReadString());
+            }
+        }
+        return media;
+    }
+
+    template <typename T>
+    void ReadTextElementProperties(T& text)
+    {
+        text.SetText(ReadString());
+        text.SetTextSize(ReadOptionalEnum<TextSize>());
+        text.SetTextWeight(ReadOptionalEnum<TextWeight>());
+        text.SetFontType(ReadOptionalEnum<FontType>());
+        text.SetTextColor(ReadOptionalEnum<ForegroundColor>());
+        text.SetIsSubtle(ReadOptionalBool());
+        text.SetLanguage(ReadString());
+    }
+
+    std::shared_ptr<TextBlock> ReadTextBlock()
+    {
+        auto textBlock = MakeElement<TextBlock>();
+        ReadTextElementProperties(*textBlock);
+        textBlock->SetWrap(ReadBool());
+        textBlock->SetMaxLines(ReadUInt32());
+        textBlock->SetHorizontalAlignment(ReadOptionalEnum<HorizontalAlignment>());
+        textBlock->SetStyle(ReadOptionalEnum<TextStyle>());
+        return textBlock;
+    }
+
+    std::shared_ptr<RichTextBlock> ReadRichTextBlock()
+    {
+        auto richTextBlock = MakeElement<RichTextBlock>();
+        richTextBlock->SetHorizontalAlignment(ReadOptionalEnum<HorizontalAlignment>());
+
+        auto& inlines = richTextBlock->GetInlines();
+        inlines.resize(ReadCount());
+        for (auto& inlineElement : inlines)
+        {
+            const auto tag = ReadUInt();
+            if (tag == c_noElement)
+            {
+                continue;
+            }
+            if (tag == c_jsonElement)
+            {
+                inlineElement = Inline::Deserialize(m_context, ReadJson());
+                continue;
+            }
+            if (tag != static_cast<std::uint64_t>(InlineElementType::TextRun) + c_firstTypeTag)
+            {
+                ThrowInvalidBinaryCard("invalid inline type");
+            }
+
+            auto textRun = MakeSharedInArena<TextRun>(m_context.GetArena());
+            ReadTextElementProperties(*textRun);
+            textRun->SetItalic(ReadBool());
+            textRun->SetStrikethrough(ReadBool());
+            textRun->SetUnderline(ReadBool());
+            textRun->SetHighlight(ReadBool());
+            textRun->SetSelectAction(ReadAction());
+            textRun->SetAdditionalProperties(ReadJson());
+            inlineElement = std::move(textRun);
+        }
+        return richTextBlock;
+    }
+
+    std::shared_ptr<Table> ReadTable()
+    {
+        auto table = MakeElement<Table>();
+
+        auto& columns = table->GetColumns();
+        columns.resize(ReadCount());
+        for (auto& column : columns)
+        {
+            if (ReadBool())
+            {
+                column = MakeSharedInArena<TableColumnDefinition>(m_context.GetArena());
+                column->SetHorizontalCellContentAlignment(ReadOptionalEnum<HorizontalAlignment>());
+                column->SetVerticalCellContentAlignment(ReadOptionalEnum<VerticalContentAlignment>());
+
+                // setting either width clears the other
+                const auto width = ReadOptionalUInt();
+                const auto pixelWidth = ReadOptionalUInt();
+                if (width.has_value())
+                {
+                    column->SetWidth(width);
+                }
+                if (pixelWidth.has_value())
+                {
+                    column->SetPixelWidth(pixelWidth);
+                }
+            }
+        }
+
+        ReadElementsOfType(table->GetRows(), CardElementType::TableRow);
+        table->SetShowGridLines(ReadBool());
+        table->SetFirstRowAsHeaders(ReadBool());
+        table->SetHorizontalCellContentAlignment(ReadOptionalEnum<HorizontalAlignment>());
+        table->SetVerticalCellContentAlignment(ReadOptionalEnum<VerticalContentAlignment>());
+        table->SetGridStyle(ReadEnum<ContainerStyle>());
+        return table;
+    }
+
+    std::shared_ptr<TextInput> ReadTextInput()
+    {
+        auto textInput = MakeInput<TextInput>();
+        textInput->SetPlaceholder(ReadString());
+        textInput->SetValue(ReadString());
+        textInput->SetRegex(ReadString());
+        textInput->SetIsMultiline(ReadBool());
+        textInput->SetMaxLength(ReadUInt32());
+        textInput->SetTextInputStyle(ReadEnum<TextInputStyle>());
+        textInput->SetInlineAction(ReadAction());
+        return textInput;
+    }
+
+    // Constructs an action of the type and reads the properties all actions have
+    template <typename T>
+    std::shared_ptr<T> MakeAction()
+    {
+        auto action = MakeSharedInArena<T>(m_context.GetArena());
+        ReadBaseElement(*action, true);
+        action->SetTitle(ReadString());
+        action->SetIconUrl(ReadString());
+        action->SetStyle(ReadString());
+        action->SetTooltip(ReadString());
+        action->SetMode(ReadEnum<Mode>());
+        action->SetIsEnabled(ReadBool());
+        return action;
+    }
+
+    std::shared_ptr<BaseActionElement> ReadAction()
+    {
+        NestingGuard guard(m_nesting);
+        const auto tag = ReadUInt();
+        if (tag == c_noElement)
+        {
+            return nullptr;
+        }
+        if (tag == c_jsonElement)
+        {
+            return ParseUtil::GetActionFromJsonValue(m_context, ReadJson());
+        }
+
+        InternalId::Next();
+
+        switch (static_cast<ActionType>(tag - c_firstTypeTag))
+        {
+        case ActionType::Execute:
+        {
+            auto executeAction = MakeAction<ExecuteAction>();
+            executeAction->SetDataJson(ReadJson());
+            executeAction->SetVerb(ReadString());
+            executeAction->SetAssociatedInputs(ReadEnum<AssociatedInputs>());
+            return executeAction;
+        }
+        case ActionType::OpenUrl:
+        {
+            auto openUrlAction = MakeAction<OpenUrlAction>();
+            openUrlAction->SetUrl(ReadString());
+            return openUrlAction;
+        }
+        case ActionType::ShowCard:
+        {
+            auto showCardAction = MakeAction<ShowCardAction>();
+            if (ReadBool())
+            {
+                showCardAction->SetCard(ReadCard());
+            }
+            return showCardAction;
+        }
+        case ActionType::Submit:
+        {
+            auto submitAction = MakeAction<SubmitAction>();
+            submitAction->SetDataJson(ReadJson());
+            submitAction->SetAssociatedInputs(ReadEnum<AssociatedInputs>());
+            return submitAction;
+        }
+        case ActionType::ToggleVisibility:
+        {
+            auto toggleVisibilityAction = MakeAction<ToggleVisibilityAction>();
+            auto& targets = toggleVisibilityAction->GetTargetElements();
+            targets.resize(ReadCount());
+            for (auto& target : targets)
+            {
+                if (ReadBool())
+                {
+                    target = std::make_shared<ToggleVisibilityTarget>();
+                    target->SetElementId(ReadString());
+                    target->SetIsVisible(ReadEnum<IsVisible>());
+                }
+            }
+            return toggleVisibilityAction;
+        }
+        case ActionType::UnknownAction:
+            return MakeAction<UnknownAction>();
+        default:
+            ThrowInvalidBinaryCard("invalid action type");
+        }
+    }
+
+    const char* m_position;
+    const char* const m_end;
+    ParseContext& m_context;
+    std::vector<std::string_view> m_strings;
+    const CardBinaryStringTable* m_sharedStrings;
+    // internal ids of the collections being read, innermost last
+    std::vector<InternalId> m_collections;
+    unsigned int m_nesting;
+};
+
+std::vector<char> SerializeCardToBinary(const AdaptiveCard& card)
+{
+    CardBinaryStringPool strings;
+    const auto body = CardBinaryWriter(strings).Write(card);
+
+    // the string table goes in front of the card, so the card is written first and copied in after it
+    std::vector<char> output(std::cbegin(c_magic), std::cend(c_magic));
+    AppendUInt(output, c_cardBinaryFormatVersion);
+    AppendUInt(output, strings.GetStrings().size());
+    for (const auto* value : strings.GetStrings())
+    {
+        AppendUInt(output, value->size());
+        output.insert(output.end(), value->cbegin(), value->cend());
+    }
+    output.insert(output.end(), body.cbegin(), body.cend());
+    return output;
+}
+
+std::shared_ptr<AdaptiveCard> DeserializeCardFromBinary(const char* data, size_t size, ParseContext& context)
+{
+    return CardBinaryReader(data, size, context).Read();
+}
+
+std::vector<char> SerializeCardBodyToBinary(const AdaptiveCard& card, CardBinaryStringPool& strings)
+{
+    return CardBinaryWriter(strings).Write(card);
+}
+
+std::shared_ptr<AdaptiveCard> DeserializeCardBodyFromBinary(
+    const char* data, size_t size, const CardBinaryStringTable& strings, ParseContext& context)
+{
+    return CardBinaryReader(data, size, strings, context).ReadBody();
+}
+} // namespace AdaptiveCards
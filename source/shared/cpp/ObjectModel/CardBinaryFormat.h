@@ -0,0 +1,66 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveCards
+{
+class AdaptiveCard;
+class ParseContext;
+
+// A compact binary encoding of a parsed card, for caches that would otherwise keep the JSON of the card and parse it
+// again on every load. Reading it builds the same object model that parsing the JSON built, without going through
+// JSON: there are no properties to look up by name and no enums to convert from strings.
+//
+// Layout, where every integer is a LEB128 varint (zigzag encoded when signed):
+//   "ACBF", c_cardBinaryFormatVersion
+//   the string table: the number of strings, then the length and UTF-8 bytes of each. Strings are written as their
+//     index in the table plus one, 0 being the empty string, so each distinct string is stored once.
+//   the card
+//
+// Elements, actions and inlines start with a tag: 0 for none, 1 for one that only a registered parser knows how to
+// build (it is stored as JSON and parsed with the parsers of the reading ParseContext), otherwise its
+// CardElementType, ActionType or InlineElementType plus 2. Their properties follow in a fixed order, enums as their
+// values and optionals with 0 for none. Additional properties and other raw JSON are stored as a tagged binary JSON
+// value.
+//
+// What parsing the JSON computes is stored along with the properties (the language of text, whether an element can
+// fall back to an ancestor, and the padding and bleed of containers), so that it needn't be computed again. Parse
+// warnings aren't stored; they were reported when the card was parsed from JSON.
+//
+// Changing what an element stores, or the order of an enum, calls for a new format version. Reading data with
+// another version (or data that isn't a binary card) throws an AdaptiveCardParseException.
+constexpr unsigned int c_cardBinaryFormatVersion = 1;
+
+// See AdaptiveCard::SerializeToBinary and AdaptiveCard::DeserializeFromBinary
+std::vector<char> SerializeCardToBinary(const AdaptiveCard& card);
+std::shared_ptr<AdaptiveCard> DeserializeCardFromBinary(const char* data, size_t size, ParseContext& context);
+
+// The strings of cards written without a string table of their own, so that many cards (those of a CardBundle) can
+// share one. Add returns what a card stores for the string: its index plus one, or 0 for the empty string.
+class CardBinaryStringPool
+{
+public:
+    std::uint64_t Add(const std::string& value);
+    const std::vector<const std::string*>& GetStrings() const { return m_strings; }
+
+private:
+    std::unordered_map<std::string, std::uint64_t> m_indexes;
+    std::vector<const std::string*> m_strings;
+};
+
+// Looks up the strings of cards read without a string table of their own. GetString is given what the card stores
+// (see CardBinaryStringPool) other than 0, and throws an AdaptiveCardParseException when there's no such string.
+class CardBinaryStringTable
+{
+public:
+    virtual ~CardBinaryStringTable() = default;
+    virtual std::string_view GetString(std::uint64_t index) const = 0;
+};
+
+// A card alone, without the magic, version and string table in front of it
+std::vector<char> SerializeCardBodyToBinary(const AdaptiveCard& card, CardBinaryStringPool& strings);
+std::shared_ptr<AdaptiveCard> DeserializeCardBodyFromBinary(
+    const char* data, size_t size, const CardBinaryStringTable& strings, ParseContext& context);
+} // namespace AdaptiveCards
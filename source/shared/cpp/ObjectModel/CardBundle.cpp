@@ -0,0 +1,438 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "CardBundle.h"
+#include "AdaptiveCardParseException.h"
+#include "ParseContext.h"
+#include "ParseResult.h"
+#include "SharedAdaptiveCard.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace AdaptiveCards;
+
+namespace
+{
+constexpr char c_magic[] = {'A', 'C', 'B', 'B'};
+
+constexpr size_t c_headerSize = 32;
+constexpr size_t c_indexRecordSize = 32;
+constexpr size_t c_stringEntrySize = 8;
+
+// Where the fields are in the header and in an index record
+constexpr size_t c_bundleVersionField = 4;
+constexpr size_t c_cardVersionField = 8;
+constexpr size_t c_cardCountField = 12;
+constexpr size_t c_stringCountField = 16;
+constexpr size_t c_stringBytesSizeField = 24;
+
+constexpr size_t c_nameField = 0;
+constexpr size_t c_versionField = 4;
+constexpr size_t c_fallbackTextField = 8;
+constexpr size_t c_speakField = 12;
+constexpr size_t c_languageField = 16;
+constexpr size_t c_cardSizeField = 20;
+constexpr size_t c_cardOffsetField = 24;
+
+std::uint64_t ReadFixed(const char* data, size_t size)
+{
+    std::uint64_t value = 0;
+    for (size_t i = 0; i < size; ++i)
+    {
+        value |= static_cast<std::uint64_t>(static_cast<unsigned char>(data[i])) << (8 * i);
+    }
+    return value;
+}
+
+std::uint32_t ReadUInt32(const char* data)
+{
+    return static_cast<std::uint32_t>(ReadFixed(data, 4));
+}
+
+std::uint64_t ReadUInt64(const char* data)
+{
+    return ReadFixed(data, 8);
+}
+
+void AppendFixed(std::vector<char>& output, std::uint64_t value, size_t size)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        output.push_back(static_cast<char>(value >> (8 * i)));
+    }
+}
+
+[[noreturn]] void ThrowInvalidCardBundle(const std::string& reason)
+{
+    throw AdaptiveCardParseException(ErrorStatusCode::InvalidJson, "Invalid card bundle: " + reason);
+}
+
+[[noreturn]] void ThrowCardBundleTooLarge(const std::string& what)
+{
+    throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Card bundle has too many " + what);
+}
+} // namespace
+
+namespace AdaptiveCards
+{
+std::string_view CardBundleEntry::GetName() const
+{
+    return GetString(c_nameField);
+}
+
+std::string_view CardBundleEntry::GetVersion() const
+{
+    return GetString(c_versionField);
+}
+
+std::string_view CardBundleEntry::GetFallbackText() const
+{
+    return GetString(c_fallbackTextField);
+}
+
+std::string_view CardBundleEntry::GetSpeak() const
+{
+    return GetString(c_speakField);
+}
+
+std::string_view CardBundleEntry::GetLanguage() const
+{
+    return GetString(c_languageField);
+}
+
+size_t CardBundleEntry::GetSize() const
+{
+    return ReadUInt32(m_record + c_cardSizeField);
+}
+
+std::string_view CardBundleEntry::GetString(size_t fieldOffset) const
+{
+    const auto index = ReadUInt32(m_record + fieldOffset);
+    return index == 0 ? std::string_view("") : m_bundle->GetString(index);
+}
+
+std::shared_ptr<CardBundle> CardBundle::Open(const std::string& path)
+{
+    const auto throwCouldNotOpen = [&path]() {
+        throw AdaptiveCardParseException(ErrorStatusCode::InvalidJson, "Could not open card bundle " + path);
+    };
+
+#ifdef _WIN32
+    const HANDLE file =
+        CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throwCouldNotOpen();
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || static_cast<std::uint64_t>(fileSize.QuadPart) < c_headerSize ||
+        static_cast<std::uint64_t>(fileSize.QuadPart) > std::numeric_limits<size_t>::max())
+    {
+        CloseHandle(file);
+        ThrowInvalidCardBundle("the file is too small or too large");
+    }
+
+    // the view keeps the file and the mapping open
+    const HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+    {
+        throwCouldNotOpen();
+    }
+    const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (view == nullptr)
+    {
+        throwCouldNotOpen();
+    }
+    const auto size = static_cast<size_t>(fileSize.QuadPart);
+#else
+    const int file = open(path.c_str(), O_RDONLY);
+    if (file == -1)
+    {
+        throwCouldNotOpen();
+    }
+
+    struct stat fileStatus;
+    if (fstat(file, &fileStatus) != 0 || static_cast<std::uint64_t>(fileStatus.st_size) < c_headerSize ||
+        static_cast<std::uint64_t>(fileStatus.st_size) > std::numeric_limits<size_t>::max())
+    {
+        close(file);
+        ThrowInvalidCardBundle("the file is too small or too large");
+    }
+
+    // the mapping keeps the file open
+    const auto size = static_cast<size_t>(fileStatus.st_size);
+    const void* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+    if (view == MAP_FAILED)
+    {
+        throwCouldNotOpen();
+    }
+#endif // _WIN32
+
+    // made before the header is read, so that the mapping is released if the header turns out to be invalid
+    std::shared_ptr<CardBundle> bundle(new CardBundle(static_cast<const char*>(view), size, true, {}));
+    bundle->ReadHeader();
+    return bundle;
+}
+
+std::shared_ptr<CardBundle> CardBundle::FromData(std::vector<char> data)
+{
+    const auto size = data.size();
+    std::shared_ptr<CardBundle> bundle(new CardBundle(nullptr, size, false, std::move(data)));
+    bundle->ReadHeader();
+    return bundle;
+}
+
+CardBundle::CardBundle(const char* data, size_t size, bool isMapped, std::vector<char>&& buffer) :
+    m_data(data), m_size(size), m_isMapped(isMapped), m_buffer(std::move(buffer)), m_cardCount(0),
+    m_stringCount(0), m_index(nullptr), m_stringEntries(nullptr), m_stringBytes(nullptr), m_stringBytesSize(0),
+    m_cards(nullptr), m_cardsSize(0)
+{
+    if (!m_isMapped)
+    {
+        m_data = m_buffer.data();
+    }
+}
+
+CardBundle::~CardBundle()
+{
+    if (m_isMapped)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(m_data);
+#else
+        munmap(const_cast<char*>(m_data), m_size);
+#endif // _WIN32
+    }
+}
+
+void CardBundle::ReadHeader()
+{
+    if (m_size < c_headerSize || !std::equal(std::cbegin(c_magic), std::cend(c_magic), m_data))
+    {
+        ThrowInvalidCardBundle("not a card bundle");
+    }
+
+    const auto bundleVersion = ReadUInt32(m_data + c_bundleVersionField);
+    if (bundleVersion != c_cardBundleFormatVersion)
+    {
+        ThrowInvalidCardBundle("format version " + std::to_string(bundleVersion) + " is not supported");
+    }
+    const auto cardVersion = ReadUInt32(m_data + c_cardVersionField);
+    if (cardVersion != c_cardBinaryFormatVersion)
+    {
+        ThrowInvalidCardBundle("card format version " + std::to_string(cardVersion) + " is not supported");
+    }
+
+    // the counts are 32 bits, so none of this can overflow before it's checked against the size
+    const std::uint64_t cardCount = ReadUInt32(m_data + c_cardCountField);
+    const std::uint64_t stringCount = ReadUInt32(m_data + c_stringCountField);
+    const std::uint64_t stringEntriesOffset = c_headerSize + cardCount * c_indexRecordSize;
+    const std::uint64_t stringBytesOffset = stringEntriesOffset + stringCount * c_stringEntrySize;
+    const std::uint64_t stringBytesSize = ReadUInt64(m_data + c_stringBytesSizeField);
+    if (stringBytesOffset > m_size || stringBytesSize > m_size - stringBytesOffset)
+    {
+        ThrowInvalidCardBundle("the file is truncated");
+    }
+
+    m_cardCount = static_cast<size_t>(cardCount);
+    m_stringCount = static_cast<size_t>(stringCount);
+    m_index = m_data + c_headerSize;
+    m_stringEntries = m_data + stringEntriesOffset;
+    m_stringBytes = m_data + stringBytesOffset;
+    m_stringBytesSize = stringBytesSize;
+    m_cards = m_stringBytes + stringBytesSize;
+    m_cardsSize = m_size - stringBytesOffset - stringBytesSize;
+}
+
+CardBundleEntry CardBundle::GetCard(size_t index) const
+{
+    if (index >= m_cardCount)
+    {
+        throw std::out_of_range("Card bundle has no card " + std::to_string(index));
+    }
+    return CardBundleEntry(*this, index, m_index + index * c_indexRecordSize);
+}
+
+std::optional<CardBundleEntry> CardBundle::FindCard(std::string_view name) const
+{
+    // the index is sorted by name
+    size_t first = 0;
+    size_t last = m_cardCount;
+    while (first < last)
+    {
+        const size_t middle = first + (last - first) / 2;
+        const auto card = GetCard(middle);
+        const int comparison = card.GetName().compare(name);
+        if (comparison == 0)
+        {
+            return card;
+        }
+
+        if (comparison < 0)
+        {
+            first = middle + 1;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+    return std::nullopt;
+}
+
+std::shared_ptr<ParseResult> CardBundle::DeserializeCard(const CardBundleEntry& card, ParseContext& context) const
+{
+    const std::uint64_t offset = ReadUInt64(card.m_record + c_cardOffsetField);
+    const std::uint64_t size = card.GetSize();
+    if (offset > m_cardsSize || size > m_cardsSize - offset)
+    {
+        ThrowInvalidCardBundle("card " + std::string(card.GetName()) + " is out of bounds");
+    }
+
+    auto adaptiveCard = DeserializeCardBodyFromBinary(m_cards + offset, static_cast<size_t>(size), *this, context);
+    return std::make_shared<ParseResult>(adaptiveCard, context.warnings);
+}
+
+std::shared_ptr<ParseResult> CardBundle::DeserializeCard(const CardBundleEntry& card) const
+{
+    ParseContext context;
+    return DeserializeCard(card, context);
+}
+
+std::string_view CardBundle::GetString(std::uint64_t index) const
+{
+    if (index == 0 || index > m_stringCount)
+    {
+        ThrowInvalidCardBundle("invalid string");
+    }
+
+    const char* entry = m_stringEntries + (index - 1) * c_stringEntrySize;
+    const std::uint64_t offset = ReadUInt32(entry);
+    const std::uint64_t length = ReadUInt32(entry + 4);
+    if (offset + length > m_stringBytesSize)
+    {
+        ThrowInvalidCardBundle("string out of bounds");
+    }
+    return std::string_view(m_stringBytes + offset, static_cast<size_t>(length));
+}
+
+void CardBundleWriter::AddCard(const std::string& name, const AdaptiveCard& card)
+{
+    if (!m_names.insert(name).second)
+    {
+        throw AdaptiveCardParseException(ErrorStatusCode::IdCollision, "Card bundle already has a card named " + name);
+    }
+
+    m_cards.push_back({m_strings.Add(name),
+                       m_strings.Add(card.GetVersion()),
+                       m_strings.Add(card.GetFallbackText()),
+                       m_strings.Add(card.GetSpeak()),
+                       m_strings.Add(card.GetLanguage()),
+                       SerializeCardBodyToBinary(card, m_strings)});
+}
+
+std::vector<char> CardBundleWriter::Write() const
+{
+    const auto& strings = m_strings.GetStrings();
+    constexpr std::uint64_t maxUInt32 = std::numeric_limits<std::uint32_t>::max();
+    if (m_cards.size() > maxUInt32)
+    {
+        ThrowCardBundleTooLarge("cards");
+    }
+    if (strings.size() > maxUInt32)
+    {
+        ThrowCardBundleTooLarge("strings");
+    }
+
+    std::vector<const Card*> cards;
+    cards.reserve(m_cards.size());
+    for (const auto& card : m_cards)
+    {
+        cards.push_back(&card);
+    }
+    const auto nameOf = [&strings](const Card* card) {
+        return card->name == 0 ? std::string_view("") : std::string_view(*strings[card->name - 1]);
+    };
+    std::sort(cards.begin(), cards.end(), [&nameOf](const Card* first, const Card* second) {
+        return nameOf(first) < nameOf(second);
+    });
+
+    std::uint64_t stringBytesSize = 0;
+    for (const auto* value : strings)
+    {
+        stringBytesSize += value->size();
+    }
+    // a string's offset has to fit in 32 bits, and so does its length
+    if (stringBytesSize > maxUInt32)
+    {
+        ThrowCardBundleTooLarge("string bytes");
+    }
+
+    std::vector<char> output(std::cbegin(c_magic), std::cend(c_magic));
+    AppendFixed(output, c_cardBundleFormatVersion, 4);
+    AppendFixed(output, c_cardBinaryFormatVersion, 4);
+    AppendFixed(output, m_cards.size(), 4);
+    AppendFixed(output, strings.size(), 4);
+    AppendFixed(output, 0, 4);
+    AppendFixed(output, stringBytesSize, 8);
+
+    std::uint64_t cardOffset = 0;
+    for (const auto* card : cards)
+    {
+        if (card->data.size() > maxUInt32)
+        {
+            ThrowCardBundleTooLarge("bytes in card " + std::string(nameOf(card)));
+        }
+
+        AppendFixed(output, card->name, 4);
+        AppendFixed(output, card->version, 4);
+        AppendFixed(output, card->fallbackText, 4);
+        AppendFixed(output, card->speak, 4);
+        AppendFixed(output, card->language, 4);
+        AppendFixed(output, card->data.size(), 4);
+        AppendFixed(output, cardOffset, 8);
+        cardOffset += card->data.size();
+    }
+
+    std::uint64_t stringOffset = 0;
+    for (const auto* value : strings)
+    {
+        AppendFixed(output, stringOffset, 4);
+        AppendFixed(output, value->size(), 4);
+        stringOffset += value->size();
+    }
+    for (const auto* value : strings)
+    {
+        output.insert(output.end(), value->cbegin(), value->cend());
+    }
+
+    for (const auto* card : cards)
+    {
+        output.insert(output.end(), card->data.cbegin(), card->data.cend());
+    }
+    return output;
+}
+
+void CardBundleWriter::Write(std::ostream& stream) const
+{
+    const auto data = Write();
+    stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+} // namespace AdaptiveCards
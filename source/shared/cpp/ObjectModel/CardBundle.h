@@ -0,0 +1,133 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "CardBinaryFormat.h"
+
+namespace AdaptiveCards
+{
+class AdaptiveCard;
+class CardBundle;
+class ParseContext;
+class ParseResult;
+
+// A file of many precompiled cards, for hosts that keep thousands of cards around and would otherwise parse them all
+// at startup. A bundle is mapped into memory rather than read: opening it only checks the header, the cards are
+// listed and looked up by name through views into the mapping, and a card is only built into an AdaptiveCard when
+// it's asked for.
+//
+// Layout, where every number is a little-endian unsigned integer of fixed width so that it can be read in place, and
+// every offset is relative to the start of its section:
+//   header (32 bytes): "ACBB", u32 c_cardBundleFormatVersion, u32 c_cardBinaryFormatVersion, u32 card count,
+//     u32 string count, u32 reserved (0), u64 size of the string bytes
+//   index: for each card, sorted by name (32 bytes): u32 name, u32 version, u32 fallbackText, u32 speak,
+//     u32 lang, u32 size of the card, u64 offset of the card
+//   string entries: for each string (8 bytes): u32 offset of its bytes, u32 length
+//   string bytes
+//   cards: each as written by SerializeCardBodyToBinary, with strings shared across the bundle
+//
+// Strings are stored once for the whole bundle, and referred to the way the cards of CardBinaryFormat.h refer to
+// them: by index plus one, with 0 for the empty string.
+constexpr unsigned int c_cardBundleFormatVersion = 1;
+
+// A card in a bundle, as listed in its index. The strings point into the bundle, which must outlive the entry.
+class CardBundleEntry
+{
+public:
+    size_t GetIndex() const { return m_index; }
+
+    std::string_view GetName() const;
+    std::string_view GetVersion() const;
+    std::string_view GetFallbackText() const;
+    std::string_view GetSpeak() const;
+    std::string_view GetLanguage() const;
+
+    // The number of bytes the card takes up in the bundle
+    size_t GetSize() const;
+
+private:
+    friend class CardBundle;
+
+    CardBundleEntry(const CardBundle& bundle, size_t index, const char* record) :
+        m_bundle(&bundle), m_index(index), m_record(record)
+    {
+    }
+
+    std::string_view GetString(size_t fieldOffset) const;
+
+    const CardBundle* m_bundle;
+    size_t m_index;
+    const char* m_record;
+};
+
+class CardBundle : public CardBinaryStringTable
+{
+public:
+    // Maps the bundle file into memory; the mapping is released with the bundle
+    static std::shared_ptr<CardBundle> Open(const std::string& path);
+    // A bundle held in memory, such as what CardBundleWriter::Write returns
+    static std::shared_ptr<CardBundle> FromData(std::vector<char> data);
+
+    CardBundle(const CardBundle&) = delete;
+    CardBundle& operator=(const CardBundle&) = delete;
+    ~CardBundle() override;
+
+    size_t GetCardCount() const { return m_cardCount; }
+    // Throws std::out_of_range for an index past the last card
+    CardBundleEntry GetCard(size_t index) const;
+    std::optional<CardBundleEntry> FindCard(std::string_view name) const;
+
+    // Builds the card. Elements that were stored as JSON are parsed with the parsers registered on the context.
+    std::shared_ptr<ParseResult> DeserializeCard(const CardBundleEntry& card, ParseContext& context) const;
+    std::shared_ptr<ParseResult> DeserializeCard(const CardBundleEntry& card) const;
+
+    std::string_view GetString(std::uint64_t index) const override;
+
+private:
+    friend class CardBundleEntry;
+
+    CardBundle(const char* data, size_t size, bool isMapped, std::vector<char>&& buffer);
+    void ReadHeader();
+
+    const char* m_data;
+    size_t m_size;
+    bool m_isMapped;
+    std::vector<char> m_buffer;
+
+    size_t m_cardCount;
+    size_t m_stringCount;
+    const char* m_index;
+    const char* m_stringEntries;
+    const char* m_stringBytes;
+    std::uint64_t m_stringBytesSize;
+    const char* m_cards;
+    std::uint64_t m_cardsSize;
+};
+
+// Puts cards together into a bundle
+class CardBundleWriter
+{
+public:
+    // Throws an AdaptiveCardParseException when the bundle already has a card of that name
+    void AddCard(const std::string& name, const AdaptiveCard& card);
+
+    std::vector<char> Write() const;
+    void Write(std::ostream& stream) const;
+
+private:
+    struct Card
+    {
+        std::uint64_t name;
+        std::uint64_t version;
+        std::uint64_t fallbackText;
+        std::uint64_t speak;
+        std::uint64_t language;
+        std::vector<char> data;
+    };
+
+    CardBinaryStringPool m_strings;
+    std::unordered_set<std::string> m_names;
+    std::vector<Card> m_cards;
+};
+} // namespace AdaptiveCards
@@ -0,0 +1,417 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "CardDiff.h"
+#include "ActionSet.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "ImageSet.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+#include "Table.h"
+#include "TableCell.h"
+#include "TableRow.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+using ElementList = std::vector<std::shared_ptr<BaseElement>>;
+
+// A collection the diff matches elements in
+struct Collection
+{
+    AdaptiveCardSchemaKey key;
+    bool holdsActions;
+    ElementList elements;
+    // The collection as serialized with its parent, so each card only has to be serialized once
+    Json::Value json;
+};
+
+template <typename T>
+Collection MakeCollection(AdaptiveCardSchemaKey key, const std::vector<std::shared_ptr<T>>& elements)
+{
+    return {key, std::is_base_of<BaseActionElement, T>::value, ElementList(elements.cbegin(), elements.cend()), {}};
+}
+
+std::vector<Collection> CollectionsOf(const AdaptiveCard& card)
+{
+    std::vector<Collection> collections;
+    collections.push_back(MakeCollection(AdaptiveCardSchemaKey::Body, card.GetBody()));
+    collections.push_back(MakeCollection(AdaptiveCardSchemaKey::Actions, card.GetActions()));
+    return collections;
+}
+
+std::vector<Collection> CollectionsOf(const BaseCardElement& element)
+{
+    std::vector<Collection> collections;
+    switch (element.GetElementType())
+    {
+    case CardElementType::Container:
+    case CardElementType::TableCell:
+        collections.push_back(
+            MakeCollection(AdaptiveCardSchemaKey::Items, static_cast<const Container&>(element).GetItems()));
+        break;
+    case CardElementType::Column:
+        collections.push_back(
+            MakeCollection(AdaptiveCardSchemaKey::Items, static_cast<const Column&>(element).GetItems()));
+        break;
+    case CardElementType::ColumnSet:
+        collections.push_back(
+            MakeCollection(AdaptiveCardSchemaKey::Columns, static_cast<const ColumnSet&>(element).GetColumns()));
+        break;
+    case CardElementType::ImageSet:
+        collections.push_back(
+            MakeCollection(AdaptiveCardSchemaKey::Images, static_cast<const ImageSet&>(element).GetImages()));
+        break;
+    case CardElementType::Table:
+        collections.push_back(
+            MakeCollection(AdaptiveCardSchemaKey::Rows, static_cast<const Table&>(element).GetRows()));
+        break;
+    case CardElementType::TableRow:
+        collections.push_back(
+            MakeCollection(AdaptiveCardSchemaKey::Cells, static_cast<const TableRow&>(element).GetCells()));
+        break;
+    case CardElementType::ActionSet:
+        collections.push_back(
+            MakeCollection(AdaptiveCardSchemaKey::Actions, static_cast<const ActionSet&>(element).GetActions()));
+        break;
+    default:
+        break;
+    }
+    return collections;
+}
+
+// Moves the serialized collections out of the serialized parent, leaving its properties
+void SplitOffCollections(Json::Value& json, std::vector<Collection>& collections)
+{
+    for (auto& collection : collections)
+    {
+        // swap rather than have removeMember copy the collection out
+        const Json::StaticString& propertyName = AdaptiveCardSchemaKeyToJsonKey(collection.key);
+        collection.json.swap(json[propertyName]);
+        json.removeMember(propertyName.c_str());
+    }
+}
+
+// The serialized element at index, taken from the serialized collection when it lines up with the elements
+Json::Value TakeSerializedElement(Collection& collection, size_t index)
+{
+    Json::Value json;
+    if (collection.json.isArray() && collection.json.size() == collection.elements.size())
+    {
+        json.swap(collection.json[static_cast<Json::ArrayIndex>(index)]);
+    }
+    else
+    {
+        json = collection.elements[index]->SerializeToJsonValue();
+    }
+    return json;
+}
+
+std::vector<std::string> ChangedProperties(const Json::Value& oldProperties, const Json::Value& newProperties)
+{
+    std::vector<std::string> changed;
+    for (const auto& name : oldProperties.getMemberNames())
+    {
+        if (!newProperties.isMember(name) || oldProperties[name] != newProperties[name])
+        {
+            changed.push_back(name);
+        }
+    }
+    for (const auto& name : newProperties.getMemberNames())
+    {
+        if (!oldProperties.isMember(name))
+        {
+            changed.push_back(name);
+        }
+    }
+    return changed;
+}
+
+// Marks the entries of sequence that are in one of its longest increasing subsequences (O(n log n))
+std::vector<bool> InLongestIncreasingSubsequence(const std::vector<size_t>& sequence)
+{
+    // tails[k] is the position in sequence of the smallest value ending an increasing subsequence of length k + 1
+    std::vector<size_t> tails;
+    std::vector<size_t> previous(sequence.size());
+    for (size_t i = 0; i < sequence.size(); ++i)
+    {
+        const auto tail = std::lower_bound(
+            tails.cbegin(), tails.cend(), sequence[i], [&sequence](size_t position, size_t value) {
+                return sequence[position] < value;
+            });
+        const size_t length = tail - tails.cbegin();
+        previous[i] = (length > 0) ? tails[length - 1] : i;
+        if (length == tails.size())
+        {
+            tails.push_back(i);
+        }
+        else
+        {
+            tails[length] = i;
+        }
+    }
+
+    std::vector<bool> inSubsequence(sequence.size(), false);
+    if (!tails.empty())
+    {
+        size_t i = tails.back();
+        for (size_t remaining = tails.size(); remaining > 0; --remaining)
+        {
+            inSubsequence[i] = true;
+            i = previous[i];
+        }
+    }
+    return inSubsequence;
+}
+
+class Differ
+{
+public:
+    explicit Differ(std::vector<CardEdit>& edits) : m_edits(edits) {}
+
+    void DiffCards(const AdaptiveCard& oldCard, const AdaptiveCard& newCard)
+    {
+        auto oldCollections = CollectionsOf(oldCard);
+        auto newCollections = CollectionsOf(newCard);
+
+        Json::Value oldProperties = oldCard.SerializeToJsonValue();
+        Json::Value newProperties = newCard.SerializeToJsonValue();
+        SplitOffCollections(oldProperties, oldCollections);
+        SplitOffCollections(newProperties, newCollections);
+
+        auto changed = ChangedProperties(oldProperties, newProperties);
+        if (!changed.empty())
+        {
+            CardEdit edit = MakeEdit(CardEditType::PropertyChange, nullptr, nullptr, AdaptiveCardSchemaKey::Body);
+            edit.changedProperties = std::move(changed);
+            m_edits.push_back(std::move(edit));
+        }
+
+        DiffCollections(nullptr, nullptr, oldCollections, newCollections);
+    }
+
+private:
+    void DiffCollections(
+        const std::shared_ptr<BaseElement>& oldParent,
+        const std::shared_ptr<BaseElement>& newParent,
+        std::vector<Collection>& oldCollections,
+        std::vector<Collection>& newCollections)
+    {
+        // both parents are of the same type, so they have the same collections
+        for (size_t i = 0; i < oldCollections.size() && i < newCollections.size(); ++i)
+        {
+            DiffCollection(oldParent, newParent, oldCollections[i], newCollections[i]);
+        }
+    }
+
+    void DiffCollection(
+        const std::shared_ptr<BaseElement>& oldParent,
+        const std::shared_ptr<BaseElement>& newParent,
+        Collection& oldCollection,
+        Collection& newCollection)
+    {
+        const ElementList& oldElements = oldCollection.elements;
+        const ElementList& newElements = newCollection.elements;
+
+        // index the old elements by id, and those without one by type
+        std::unordered_map<std::string, size_t> oldById;
+        std::unordered_map<std::string, std::vector<size_t>> oldByType;
+        for (size_t i = 0; i < oldElements.size(); ++i)
+        {
+            if (const auto& element = oldElements[i])
+            {
+                if (element->GetId().empty())
+                {
+                    oldByType[element->GetElementTypeString()].push_back(i);
+                }
+                else
+                {
+                    oldById.emplace(element->GetId(), i);
+                }
+            }
+        }
+
+        // match each new element with an old one
+        constexpr size_t unmatched = std::numeric_limits<size_t>::max();
+        std::vector<size_t> oldMatch(oldElements.size(), unmatched);
+        std::vector<size_t> newMatch(newElements.size(), unmatched);
+        std::unordered_map<std::string, size_t> typeOrdinals;
+        for (size_t j = 0; j < newElements.size(); ++j)
+        {
+            const auto& element = newElements[j];
+            if (!element)
+            {
+                continue;
+            }
+
+            size_t i = unmatched;
+            const auto& type = element->GetElementTypeString();
+            if (element->GetId().empty())
+            {
+                const size_t ordinal = typeOrdinals[type]++;
+                const auto candidates = oldByType.find(type);
+                if (candidates != oldByType.end() && ordinal < candidates->second.size())
+                {
+                    i = candidates->second[ordinal];
+                }
+            }
+            else
+            {
+                const auto candidate = oldById.find(element->GetId());
+                if (candidate != oldById.end() && oldElements[candidate->second]->GetElementTypeString() == type)
+                {
+                    i = candidate->second;
+                }
+            }
+
+            if (i != unmatched && oldMatch[i] == unmatched)
+            {
+                oldMatch[i] = j;
+                newMatch[j] = i;
+            }
+        }
+
+        const AdaptiveCardSchemaKey key = newCollection.key;
+        for (size_t i = 0; i < oldElements.size(); ++i)
+        {
+            if (oldElements[i] && oldMatch[i] == unmatched)
+            {
+                CardEdit edit = MakeEdit(CardEditType::Remove, oldParent, newParent, key);
+                edit.oldElement = oldElements[i];
+                edit.oldIndex = i;
+                m_edits.push_back(std::move(edit));
+            }
+        }
+
+        // the matched elements that are still in order stay put; the rest move
+        std::vector<size_t> matchedNew;
+        std::vector<size_t> matchedOld;
+        for (size_t j = 0; j < newElements.size(); ++j)
+        {
+            if (newMatch[j] != unmatched)
+            {
+                matchedNew.push_back(j);
+                matchedOld.push_back(newMatch[j]);
+            }
+        }
+
+        const auto staysPut = InLongestIncreasingSubsequence(matchedOld);
+        for (size_t k = 0; k < matchedNew.size(); ++k)
+        {
+            if (!staysPut[k])
+            {
+                m_edits.push_back(MakeMatchedEdit(
+                    CardEditType::Move, oldParent, newParent, key, oldElements, newElements, matchedOld[k], matchedNew[k]));
+            }
+        }
+
+        for (size_t j = 0; j < newElements.size(); ++j)
+        {
+            if (newElements[j] && newMatch[j] == unmatched)
+            {
+                CardEdit edit = MakeEdit(CardEditType::Insert, oldParent, newParent, key);
+                edit.newElement = newElements[j];
+                edit.newIndex = j;
+                m_edits.push_back(std::move(edit));
+            }
+        }
+
+        for (size_t k = 0; k < matchedNew.size(); ++k)
+        {
+            DiffElements(
+                key,
+                oldCollection.holdsActions,
+                oldParent,
+                newParent,
+                oldElements,
+                newElements,
+                matchedOld[k],
+                matchedNew[k],
+                TakeSerializedElement(oldCollection, matchedOld[k]),
+                TakeSerializedElement(newCollection, matchedNew[k]));
+        }
+    }
+
+    void DiffElements(
+        AdaptiveCardSchemaKey key,
+        bool holdsActions,
+        const std::shared_ptr<BaseElement>& oldParent,
+        const std::shared_ptr<BaseElement>& newParent,
+        const ElementList& oldElements,
+        const ElementList& newElements,
+        size_t oldIndex,
+        size_t newIndex,
+        Json::Value oldJson,
+        Json::Value newJson)
+    {
+        const auto& oldElement = oldElements[oldIndex];
+        const auto& newElement = newElements[newIndex];
+
+        // the serialized element includes everything it holds, so when they match there's nothing to go into
+        if (oldJson == newJson)
+        {
+            return;
+        }
+
+        std::vector<Collection> oldCollections;
+        std::vector<Collection> newCollections;
+        if (!holdsActions)
+        {
+            oldCollections = CollectionsOf(static_cast<const BaseCardElement&>(*oldElement));
+            newCollections = CollectionsOf(static_cast<const BaseCardElement&>(*newElement));
+        }
+
+        SplitOffCollections(oldJson, oldCollections);
+        SplitOffCollections(newJson, newCollections);
+
+        auto changed = ChangedProperties(oldJson, newJson);
+        if (!changed.empty())
+        {
+            CardEdit edit = MakeMatchedEdit(
+                CardEditType::PropertyChange, oldParent, newParent, key, oldElements, newElements, oldIndex, newIndex);
+            edit.changedProperties = std::move(changed);
+            m_edits.push_back(std::move(edit));
+        }
+
+        DiffCollections(oldElement, newElement, oldCollections, newCollections);
+    }
+
+    static CardEdit MakeEdit(
+        CardEditType type,
+        const std::shared_ptr<BaseElement>& oldParent,
+        const std::shared_ptr<BaseElement>& newParent,
+        AdaptiveCardSchemaKey key)
+    {
+        return {type, oldParent, newParent, key, nullptr, nullptr, 0, 0, {}};
+    }
+
+    static CardEdit MakeMatchedEdit(
+        CardEditType type,
+        const std::shared_ptr<BaseElement>& oldParent,
+        const std::shared_ptr<BaseElement>& newParent,
+        AdaptiveCardSchemaKey key,
+        const ElementList& oldElements,
+        const ElementList& newElements,
+        size_t oldIndex,
+        size_t newIndex)
+    {
+        return {type, oldParent, newParent, key, oldElements[oldIndex], newElements[newIndex], oldIndex, newIndex, {}};
+    }
+
+    std::vector<CardEdit>& m_edits;
+};
+} // namespace
+
+namespace AdaptiveCards
+{
+std::vector<CardEdit> Diff(const AdaptiveCard& oldCard, const AdaptiveCard& newCard)
+{
+    std::vector<CardEdit> edits;
+    Differ differ(edits);
+    differ.DiffCards(oldCard, newCard);
+    return edits;
+}
+} // namespace AdaptiveCards
@@ -0,0 +1,65 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "Enums.h"
+
+namespace AdaptiveCards
+{
+class AdaptiveCard;
+class BaseElement;
+
+enum class CardEditType
+{
+    Insert,
+    Remove,
+    Move,
+    PropertyChange
+};
+
+// One step of the edit script produced by Diff.
+//
+// Insert, Remove and Move apply to one collection (the body or actions of the card, or the items, columns, images,
+// rows, cells or actions of an element) of a parent that is in both cards. To get from the old collection to the
+// new one, take out the removed and moved elements, then put the moved and inserted elements back at their new
+// indexes in ascending order.
+//
+// PropertyChange lists the JSON properties of an element that differ, not counting the collections above. With no
+// elements set, it's about the properties of the card itself.
+struct CardEdit
+{
+    CardEditType type;
+
+    // The element holding the collection in the old and the new card; nullptr when it's the card
+    std::shared_ptr<BaseElement> oldParent;
+    std::shared_ptr<BaseElement> newParent;
+    AdaptiveCardSchemaKey collection;
+
+    // The element in the old card (Remove, Move, PropertyChange) and in the new one (Insert, Move, PropertyChange)
+    std::shared_ptr<BaseElement> oldElement;
+    std::shared_ptr<BaseElement> newElement;
+    size_t oldIndex;
+    size_t newIndex;
+
+    std::vector<std::string> changedProperties;
+};
+
+// Computes the edits that turn oldCard into newCard, so a renderer can patch what it rendered for oldCard instead of
+// rendering newCard from scratch.
+//
+// Elements are matched within the same collection of matched parents: by id when they have one, otherwise by type
+// and position among the siblings of that type without an id. An element that changes type, or moves to another
+// collection, is removed and inserted. Moves are kept to a minimum (the longest run of matched elements still in
+// order stays put).
+//
+// Anything not in the collections above, such as inlines, selectActions, fallback content and the card of an
+// Action.ShowCard, is compared as a property of the element holding it. Each card is serialized once to compare the
+// matched elements, and the diff doesn't go into those that serialize the same.
+//
+// The time taken grows with the size of the cards, plus the depth of each changed element: every matched element
+// above it is compared up to the first difference, so what comes before the change is compared once per level. It
+// isn't linear between about 5000 and 20000 elements, where the serialized cards (one node allocation per JSON value)
+// stop fitting in the cache; beyond that it is again (see CardDiffTest DiffBenchmark).
+std::vector<CardEdit> Diff(const AdaptiveCard& oldCard, const AdaptiveCard& newCard);
+} // namespace AdaptiveCards
@@ -11,9 +11,9 @@ ChoiceInput::ChoiceInput()
 {
 }
 
-std::shared_ptr<ChoiceInput> ChoiceInput::Deserialize(ParseContext& /*context*/, const Json::Value& json)
+std::shared_ptr<ChoiceInput> ChoiceInput::Deserialize(ParseContext& context, const Json::Value& json)
 {
-    auto choice = std::make_shared<ChoiceInput>();
+    auto choice = MakeSharedInArena<ChoiceInput>(context.GetArena());
 
     choice->SetTitle(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Title, true));
     choice->SetValue(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Value, true));
@@ -35,8 +35,8 @@ Json::Value ChoiceInput::SerializeToJsonValue()
 {
     Json::Value root;
 
-    root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title)] = GetTitle();
-    root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value)] = GetValue();
+    root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Title)] = GetTitle();
+    root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Value)] = GetValue();
 
     return root;
 }
@@ -29,26 +29,26 @@ Json::Value ChoiceSetInput::SerializeToJsonValue() const
 {
     Json::Value root = BaseInputElement::SerializeToJsonValue();
 
-    root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style)] = ChoiceSetStyleToString(m_choiceSetStyle);
+    root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Style)] = ChoiceSetStyleToString(m_choiceSetStyle);
 
     if (m_isMultiSelect)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsMultiSelect)] = m_isMultiSelect;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::IsMultiSelect)] = m_isMultiSelect;
     }
 
     if (!m_value.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value)] = m_value;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Value)] = m_value;
     }
 
     if (m_wrap)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap)] = m_wrap;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Wrap)] = m_wrap;
     }
 
     if (m_choices.size())
     {
-        const std::string& propertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Choices);
+        const Json::StaticString& propertyName = AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Choices);
         root[propertyName] = Json::Value(Json::arrayValue);
         for (const auto& choice : m_choices)
         {
@@ -116,7 +116,7 @@ std::shared_ptr<BaseCardElement> ChoiceSetInputParser::Deserialize(ParseContext&
     auto choiceSet = BaseInputElement::Deserialize<ChoiceSetInput>(context, json);
 
     choiceSet->SetChoiceSetStyle(ParseUtil::GetEnumValue<ChoiceSetStyle>(
-        json, AdaptiveCardSchemaKey::Style, ChoiceSetStyle::Compact, ChoiceSetStyleFromString));
+        json, AdaptiveCardSchemaKey::Style, ChoiceSetStyle::Compact, ChoiceSetStyleTryFromString));
     choiceSet->SetIsMultiSelect(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::IsMultiSelect, false));
     choiceSet->SetValue(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Value, false));
     choiceSet->SetWrap(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Wrap, false, false));
@@ -143,11 +143,13 @@ std::shared_ptr<BaseCardElement> ChoiceSetInputParser::DeserializeFromString(Par
 
 void ChoiceSetInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Choices),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsMultiSelect),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Choices,
+         AdaptiveCardSchemaKey::IsMultiSelect,
+         AdaptiveCardSchemaKey::Placeholder,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::Value,
+         AdaptiveCardSchemaKey::Wrap});
+    m_knownProperties = &knownProperties;
 }
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "Column.h"
+#include "ElementVisitor.h"
 #include "ParseContext.h"
 #include "ParseUtil.h"
 #include "Util.h"
@@ -75,10 +76,10 @@ Json::Value Column::SerializeToJsonValue() const
 
     if (!m_width.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Width)] = m_width;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Width)] = m_width;
     }
 
-    const std::string& propertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items);
+    const Json::StaticString& propertyName = AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Items);
     root[propertyName] = Json::Value(Json::arrayValue);
     for (const auto& cardElement : m_items)
     {
@@ -87,7 +88,7 @@ Json::Value Column::SerializeToJsonValue() const
 
     if (m_rtl.has_value())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl)] = m_rtl.value_or("");
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Rtl)] = m_rtl.value_or("");
     }
 
     return root;
@@ -95,20 +96,20 @@ Json::Value Column::SerializeToJsonValue() const
 
 void Column::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Width),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Items,
+         AdaptiveCardSchemaKey::Rtl,
+         AdaptiveCardSchemaKey::SelectAction,
+         AdaptiveCardSchemaKey::Width,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::VerticalContentAlignment});
+    m_knownProperties = &knownProperties;
 }
 
 void Column::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
 {
-    auto columnItems = GetItems();
-    StyledCollectionElement::GetResourceInformation<BaseCardElement>(resourceInfo, columnItems);
-    return;
+    CollectResourceInformation(*this, resourceInfo);
 }
 
 void Column::DeserializeChildren(ParseContext& context, const Json::Value& value)
@@ -130,15 +131,8 @@ std::shared_ptr<BaseCardElement> ColumnParser::Deserialize(ParseContext& context
     const auto& fallbackElement = column->GetFallbackContent();
     if (fallbackElement)
     {
-        bool isFallbackColumn;
-        try
-        {
-            isFallbackColumn = CardElementTypeFromString(fallbackElement->GetElementTypeString()) == CardElementType::Column;
-        }
-        catch (const std::out_of_range&)
-        {
-            isFallbackColumn = false;
-        }
+        const bool isFallbackColumn =
+            CardElementTypeTryFromString(fallbackElement->GetElementTypeString()) == CardElementType::Column;
 
         if (!isFallbackColumn)
         {
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "ColumnSet.h"
+#include "ElementVisitor.h"
 #include "Column.h"
 #include "ParseUtil.h"
 #include "Image.h"
@@ -29,7 +30,7 @@ Json::Value ColumnSet::SerializeToJsonValue() const
 {
     Json::Value root = StyledCollectionElement::SerializeToJsonValue();
 
-    std::string const& propertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Columns);
+    const Json::StaticString& propertyName = AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Columns);
     root[propertyName] = Json::Value(Json::arrayValue);
     for (const auto& column : m_columns)
     {
@@ -52,18 +53,18 @@ void ColumnSet::DeserializeChildren(ParseContext& context, const Json::Value& va
 
 void ColumnSet::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Bleed),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Columns),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Bleed,
+         AdaptiveCardSchemaKey::Columns,
+         AdaptiveCardSchemaKey::SelectAction,
+         AdaptiveCardSchemaKey::Style});
+    m_knownProperties = &knownProperties;
 }
 
 void ColumnSet::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
 {
-    auto columns = GetColumns();
-    StyledCollectionElement::GetResourceInformation<Column>(resourceInfo, columns);
-    return;
+    CollectResourceInformation(*this, resourceInfo);
 }
 
 std::shared_ptr<BaseCardElement> ColumnSetParser::Deserialize(ParseContext& context, const Json::Value& value)
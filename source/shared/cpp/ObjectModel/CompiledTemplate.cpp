@@ -0,0 +1,846 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "CompiledTemplate.h"
+#include "ParseUtil.h"
+#include "ThreadPool.h"
+
+using namespace AdaptiveCards;
+
+namespace AdaptiveCards
+{
+enum class CompiledTemplateNodeKind
+{
+    // A value that doesn't bind to data, expanded when the template was compiled
+    Static,
+    String,
+    Array,
+    Object
+};
+
+struct CompiledTemplate::Node
+{
+    CompiledTemplateNodeKind kind = CompiledTemplateNodeKind::Static;
+
+    // Static: the value, and the value as compact JSON when it's emitted as text
+    Json::Value value;
+    std::string json;
+
+    std::optional<TemplateString> string;
+
+    // Array: the items, with items that are static already dropped (null) or spliced in (arrays), as expanding an
+    // array does. Object: the values of its properties other than keywords.
+    std::vector<Node> children;
+
+    // Object: the names of the properties, and each written as JSON followed by a colon
+    std::vector<std::string> keys;
+    std::vector<std::string> keysJson;
+
+    // Object: $data, either as a template string or as a value (when it's not a template string)
+    bool hasData = false;
+    std::optional<TemplateString> dataString;
+    Json::Value data;
+
+    bool hasWhen = false;
+    std::optional<TemplateString> whenString;
+    Json::Value when;
+};
+} // namespace AdaptiveCards
+
+namespace
+{
+using Node = CompiledTemplate::Node;
+
+constexpr size_t c_streamBufferSize = 64 * 1024;
+
+const Json::Value& NoData()
+{
+    static const Json::Value noData;
+    return noData;
+}
+
+Node MakeStaticNode(Json::Value value)
+{
+    Node node;
+    node.kind = CompiledTemplateNodeKind::Static;
+    node.value = std::move(value);
+    return node;
+}
+
+// Static nodes that are emitted on their own (rather than as part of a larger static node) are written as JSON
+void WriteStaticJson(Node& node)
+{
+    if (node.kind == CompiledTemplateNodeKind::Static && node.json.empty())
+    {
+        ParseUtil::WriteJson(node.value, node.json);
+    }
+}
+
+class TemplateCompiler
+{
+public:
+    TemplateCompiler() : m_bindingCount(0) {}
+
+    size_t GetBindingCount() const { return m_bindingCount; }
+
+    Node Compile(const Json::Value& value)
+    {
+        if (value.isString())
+        {
+            return CompileString(value);
+        }
+        if (value.isArray())
+        {
+            return CompileArray(value);
+        }
+        if (value.isObject())
+        {
+            return CompileObject(value);
+        }
+        return MakeStaticNode(value);
+    }
+
+private:
+    Node CompileString(const Json::Value& value)
+    {
+        auto templateString = TemplateString::Parse(value.asString());
+        if (!templateString.has_value())
+        {
+            return MakeStaticNode(value);
+        }
+
+        if (templateString->IsConstant())
+        {
+            const TemplateScope scope{&NoData(), nullptr, nullptr, std::nullopt};
+            return MakeStaticNode(templateString->Evaluate(scope).Release());
+        }
+
+        ++m_bindingCount;
+        Node node;
+        node.kind = CompiledTemplateNodeKind::String;
+        node.string = std::move(templateString);
+        return node;
+    }
+
+    Node CompileArray(const Json::Value& value)
+    {
+        Node node;
+        node.kind = CompiledTemplateNodeKind::Array;
+        bool isStatic = true;
+        for (const auto& item : value)
+        {
+            auto child = Compile(item);
+            if (child.kind != CompiledTemplateNodeKind::Static)
+            {
+                isStatic = false;
+                node.children.push_back(std::move(child));
+            }
+            else if (child.value.isArray())
+            {
+                for (const auto& childItem : child.value)
+                {
+                    node.children.push_back(MakeStaticNode(childItem));
+                }
+            }
+            else if (!child.value.isNull())
+            {
+                node.children.push_back(std::move(child));
+            }
+        }
+
+        if (isStatic)
+        {
+            Json::Value result(Json::arrayValue);
+            for (auto& child : node.children)
+            {
+                result.append(std::move(child.value));
+            }
+            return MakeStaticNode(std::move(result));
+        }
+
+        std::for_each(node.children.begin(), node.children.end(), WriteStaticJson);
+        return node;
+    }
+
+    Node CompileObject(const Json::Value& value)
+    {
+        Node node;
+        node.kind = CompiledTemplateNodeKind::Object;
+        bool isStatic = true;
+        for (auto it = value.begin(); it != value.end(); ++it)
+        {
+            auto name = it.name();
+            if (name == "$data")
+            {
+                node.hasData = true;
+                node.dataString = it->isString() ? TemplateString::Parse(it->asString()) : std::nullopt;
+                node.data = *it;
+                m_bindingCount += node.dataString.has_value();
+            }
+            else if (name == "$when")
+            {
+                node.hasWhen = true;
+                node.whenString = it->isString() ? TemplateString::Parse(it->asString()) : std::nullopt;
+                node.when = *it;
+                ++m_bindingCount;
+            }
+
+            if (IsTemplateKeyword(name))
+            {
+                continue;
+            }
+
+            node.children.push_back(Compile(*it));
+            isStatic = isStatic && node.children.back().kind == CompiledTemplateNodeKind::Static;
+
+            std::string keyJson;
+            ParseUtil::WriteJson(Json::Value(name), keyJson);
+            node.keysJson.push_back(keyJson + ':');
+            node.keys.push_back(std::move(name));
+        }
+
+        if (isStatic && !node.hasData && !node.hasWhen)
+        {
+            Json::Value result(Json::objectValue);
+            for (size_t i = 0; i < node.children.size(); ++i)
+            {
+                result[node.keys[i]] = std::move(node.children[i].value);
+            }
+            return MakeStaticNode(std::move(result));
+        }
+
+        std::for_each(node.children.begin(), node.children.end(), WriteStaticJson);
+        return node;
+    }
+
+    size_t m_bindingCount;
+};
+
+class CompiledTemplateExpander
+{
+public:
+    // With a stream, what Write writes is moved to it every c_streamBufferSize bytes or so
+    CompiledTemplateExpander(
+        std::vector<std::string>* warnings, ThreadPool* threadPool, size_t parallelThreshold, std::ostream* stream) :
+        m_warnings(warnings), m_threadPool(threadPool), m_parallelThreshold(parallelThreshold), m_stream(stream)
+    {
+    }
+
+    // nullopt for a value that's left out: a property the data doesn't have
+    std::optional<Json::Value> Expand(const Node& node, const TemplateScope& scope)
+    {
+        switch (node.kind)
+        {
+        case CompiledTemplateNodeKind::Static:
+            return node.value;
+        case CompiledTemplateNodeKind::String:
+        {
+            auto value = node.string->Evaluate(scope);
+            if (value.IsUndefined())
+            {
+                return std::nullopt;
+            }
+            return value.Release();
+        }
+        case CompiledTemplateNodeKind::Array:
+        {
+            Json::Value result(Json::arrayValue);
+            for (const auto& child : node.children)
+            {
+                if (child.kind == CompiledTemplateNodeKind::Static)
+                {
+                    result.append(child.value);
+                    continue;
+                }
+
+                auto expanded = Expand(child, scope);
+                if (!expanded.has_value() || expanded->isNull())
+                {
+                    continue;
+                }
+                if (expanded->isArray())
+                {
+                    for (auto& item : *expanded)
+                    {
+                        result.append(std::move(item));
+                    }
+                }
+                else
+                {
+                    result.append(std::move(*expanded));
+                }
+            }
+            return result;
+        }
+        case CompiledTemplateNodeKind::Object:
+        default:
+        {
+            std::vector<Json::Value> results;
+            const auto data = EvaluateData(node, scope);
+            if (IsExpandedInParallel(data))
+            {
+                const auto& items = data.Get();
+                auto chunks = ExpandInParallel<std::vector<Json::Value>>(
+                    items.size(),
+                    [&](CompiledTemplateExpander& expander,
+                        Json::ArrayIndex begin,
+                        Json::ArrayIndex end,
+                        std::vector<Json::Value>& chunk) {
+                        expander.ForEachItem(node, scope, items, begin, end, [&](const TemplateScope& itemScope) {
+                            chunk.push_back(expander.ExpandRepetition(node, itemScope));
+                        });
+                    });
+                for (auto& chunk : chunks)
+                {
+                    std::move(chunk.begin(), chunk.end(), std::back_inserter(results));
+                }
+            }
+            else
+            {
+                ForEachRepetition(node, scope, data, [&](const TemplateScope& itemScope) {
+                    results.push_back(ExpandRepetition(node, itemScope));
+                });
+            }
+
+            if (results.empty())
+            {
+                return Json::Value();
+            }
+            if (results.size() == 1)
+            {
+                return std::move(results[0]);
+            }
+
+            Json::Value result(Json::arrayValue);
+            for (auto& item : results)
+            {
+                result.append(std::move(item));
+            }
+            return result;
+        }
+        }
+    }
+
+    // Writes what Expand returns as compact JSON, with null for a value that's left out. Nothing is taken back once
+    // it's written, so that with a stream to write to, what's written so far is flushed to it as output fills.
+    void Write(const Node& node, const TemplateScope& scope, std::string& output)
+    {
+        switch (node.kind)
+        {
+        case CompiledTemplateNodeKind::Static:
+            output += node.json;
+            break;
+        case CompiledTemplateNodeKind::String:
+        {
+            const auto value = node.string->Evaluate(scope);
+            if (value.IsUndefined())
+            {
+                output += "null";
+            }
+            else
+            {
+                ParseUtil::WriteJson(value.Get(), output);
+            }
+            break;
+        }
+        case CompiledTemplateNodeKind::Array:
+        {
+            output += '[';
+            bool isFirst = true;
+            for (const auto& child : node.children)
+            {
+                WriteArrayItem(child, scope, output, isFirst);
+            }
+            output += ']';
+            break;
+        }
+        case CompiledTemplateNodeKind::Object:
+        default:
+            WriteRepetitionsAsValue(node, scope, output);
+            break;
+        }
+    }
+
+private:
+    // The value of $data: undefined when the object has none
+    TemplateValue EvaluateData(const Node& node, const TemplateScope& scope) const
+    {
+        if (node.dataString.has_value())
+        {
+            return node.dataString->Evaluate(scope);
+        }
+        if (node.hasData)
+        {
+            return TemplateValue::Reference(node.data);
+        }
+        return TemplateValue();
+    }
+
+    bool IsExpandedInParallel(const TemplateValue& data) const
+    {
+        return m_threadPool && m_threadPool->GetThreadCount() > 1 && data.Get().isArray() &&
+               data.Get().size() >= std::max<size_t>(m_parallelThreshold, 2);
+    }
+
+    // Calls visit with the scope of each repetition of an object whose $data is data, skipping those its $when drops
+    template <typename Visit>
+    void ForEachRepetition(const Node& node, const TemplateScope& scope, const TemplateValue& data, Visit visit)
+    {
+        if (data.Get().isArray())
+        {
+            ForEachItem(node, scope, data.Get(), 0, data.Get().size(), visit);
+            return;
+        }
+
+        TemplateScope itemScope = scope;
+        if (!data.IsUndefined())
+        {
+            itemScope.data = &data.Get();
+        }
+        VisitIfTrue(node, itemScope, visit);
+    }
+
+    // As ForEachRepetition, for items [begin, end) of a $data array
+    template <typename Visit>
+    void ForEachItem(
+        const Node& node,
+        const TemplateScope& scope,
+        const Json::Value& items,
+        Json::ArrayIndex begin,
+        Json::ArrayIndex end,
+        Visit visit)
+    {
+        TemplateScope itemScope = scope;
+        for (Json::ArrayIndex i = begin; i < end; ++i)
+        {
+            itemScope.data = &items[i];
+            itemScope.index = i;
+            VisitIfTrue(node, itemScope, visit);
+        }
+    }
+
+    template <typename Visit>
+    void VisitIfTrue(const Node& node, const TemplateScope& itemScope, Visit& visit)
+    {
+        if (IsKept(node, itemScope, m_warnings))
+        {
+            visit(itemScope);
+        }
+    }
+
+    // Whether the $when of an object (if it has one) keeps the repetition of it in itemScope
+    bool IsKept(const Node& node, const TemplateScope& itemScope, std::vector<std::string>* warnings) const
+    {
+        return !node.hasWhen ||
+               EvaluateTemplateCondition(node.when, node.whenString ? &*node.whenString : nullptr, itemScope, warnings);
+    }
+
+    // Splits itemCount repetitions into contiguous chunks and calls expandChunk(expander, begin, end, chunk) for each
+    // on m_threadPool's threads, returning the chunks in order. Each chunk has an expander of its own that expands
+    // serially into the chunk's own buffer and collects its own warnings, which are added to m_warnings in order once
+    // every chunk is done, so that both the result and the warnings are what expanding serially gives. The data is
+    // only read.
+    template <typename Chunk, typename ExpandChunk>
+    std::vector<Chunk> ExpandInParallel(size_t itemCount, const ExpandChunk& expandChunk)
+    {
+        // more chunks than threads, so that a thread that draws expensive items doesn't hold up the others
+        const size_t chunkCount = std::min(itemCount, static_cast<size_t>(m_threadPool->GetThreadCount()) * 4);
+        std::vector<Chunk> chunks(chunkCount);
+        std::vector<std::vector<std::string>> warnings(chunkCount);
+        std::vector<std::exception_ptr> errors(chunkCount);
+        m_threadPool->ParallelFor(chunkCount, [&](size_t i) {
+            try
+            {
+                CompiledTemplateExpander expander(m_warnings ? &warnings[i] : nullptr, nullptr, 0, nullptr);
+                const auto begin = static_cast<Json::ArrayIndex>(itemCount * i / chunkCount);
+                const auto end = static_cast<Json::ArrayIndex>(itemCount * (i + 1) / chunkCount);
+                expandChunk(expander, begin, end, chunks[i]);
+            }
+            catch (...)
+            {
+                errors[i] = std::current_exception();
+            }
+        });
+
+        for (size_t i = 0; i < chunkCount; ++i)
+        {
+            if (m_warnings)
+            {
+                std::move(warnings[i].begin(), warnings[i].end(), std::back_inserter(*m_warnings));
+            }
+            if (errors[i])
+            {
+                std::rethrow_exception(errors[i]);
+            }
+        }
+        return chunks;
+    }
+
+    Json::Value ExpandRepetition(const Node& node, const TemplateScope& itemScope)
+    {
+        Json::Value result(Json::objectValue);
+        for (size_t i = 0; i < node.children.size(); ++i)
+        {
+            auto value = Expand(node.children[i], itemScope);
+            if (value.has_value())
+            {
+                result[node.keys[i]] = std::move(*value);
+            }
+        }
+        return result;
+    }
+
+    // Writes the repetitions of an object, separated by commas, and returns how many there were
+    size_t WriteRepetitions(const Node& node, const TemplateScope& scope, std::string& output, bool& isFirst)
+    {
+        const auto data = EvaluateData(node, scope);
+        if (IsExpandedInParallel(data))
+        {
+            return WriteChunks(WriteInParallel(node, scope, data.Get()), output, isFirst);
+        }
+
+        size_t count = 0;
+        ForEachRepetition(node, scope, data, [&](const TemplateScope& itemScope) {
+            WriteRepetition(node, itemScope, output, isFirst);
+            ++count;
+        });
+        return count;
+    }
+
+    // Writes the repetitions of an object that's a value rather than an item of an array: null for none, the object
+    // for one, and an array of them for more. Which of those it is has to be known before any of them is written, so
+    // the $when of the items of a $data array is evaluated ahead of writing them until two are kept (or the items run
+    // out), with the warnings held back until each item is written so that they're in the order expanding adds them.
+    void WriteRepetitionsAsValue(const Node& node, const TemplateScope& scope, std::string& output)
+    {
+        const auto data = EvaluateData(node, scope);
+        bool isFirst = true;
+        if (IsExpandedInParallel(data))
+        {
+            const auto chunks = WriteInParallel(node, scope, data.Get());
+            size_t count = 0;
+            for (const auto& chunk : chunks)
+            {
+                count += chunk.count;
+            }
+
+            output += count == 0 ? "null" : count > 1 ? "[" : "";
+            WriteChunks(chunks, output, isFirst);
+            output += count > 1 ? "]" : "";
+            return;
+        }
+
+        if (!data.Get().isArray())
+        {
+            TemplateScope itemScope = scope;
+            if (!data.IsUndefined())
+            {
+                itemScope.data = &data.Get();
+            }
+
+            if (IsKept(node, itemScope, m_warnings))
+            {
+                WriteRepetition(node, itemScope, output, isFirst);
+            }
+            else
+            {
+                output += "null";
+            }
+            return;
+        }
+
+        const auto& items = data.Get();
+        TemplateScope itemScope = scope;
+        std::vector<Json::ArrayIndex> kept;
+        std::vector<std::pair<Json::ArrayIndex, std::string>> heldWarnings;
+        Json::ArrayIndex scanned = 0;
+        for (; scanned < items.size() && kept.size() < 2; ++scanned)
+        {
+            itemScope.data = &items[scanned];
+            itemScope.index = scanned;
+            std::vector<std::string> warnings;
+            if (IsKept(node, itemScope, m_warnings ? &warnings : nullptr))
+            {
+                kept.push_back(scanned);
+            }
+            for (auto& warning : warnings)
+            {
+                heldWarnings.emplace_back(scanned, std::move(warning));
+            }
+        }
+
+        output += kept.empty() ? "null" : kept.size() > 1 ? "[" : "";
+        auto nextWarning = heldWarnings.begin();
+        for (Json::ArrayIndex i = 0; i < items.size(); ++i)
+        {
+            itemScope.data = &items[i];
+            itemScope.index = i;
+
+            bool isKept;
+            if (i < scanned)
+            {
+                for (; nextWarning != heldWarnings.end() && nextWarning->first == i; ++nextWarning)
+                {
+                    m_warnings->push_back(std::move(nextWarning->second));
+                }
+                isKept = std::find(kept.begin(), kept.end(), i) != kept.end();
+            }
+            else
+            {
+                isKept = IsKept(node, itemScope, m_warnings);
+            }
+
+            if (isKept)
+            {
+                WriteRepetition(node, itemScope, output, isFirst);
+            }
+        }
+        output += kept.size() > 1 ? "]" : "";
+    }
+
+    struct WrittenChunk
+    {
+        std::string json;
+        size_t count = 0;
+    };
+
+    std::vector<WrittenChunk> WriteInParallel(const Node& node, const TemplateScope& scope, const Json::Value& items)
+    {
+        return ExpandInParallel<WrittenChunk>(
+            items.size(),
+            [&](CompiledTemplateExpander& expander, Json::ArrayIndex begin, Json::ArrayIndex end, WrittenChunk& chunk) {
+                bool isFirstInChunk = true;
+                expander.ForEachItem(node, scope, items, begin, end, [&](const TemplateScope& itemScope) {
+                    expander.WriteRepetition(node, itemScope, chunk.json, isFirstInChunk);
+                    ++chunk.count;
+                });
+            });
+    }
+
+    // Joins the repetitions written by each chunk with commas, and returns how many there were
+    size_t WriteChunks(const std::vector<WrittenChunk>& chunks, std::string& output, bool& isFirst)
+    {
+        size_t count = 0;
+        for (const auto& chunk : chunks)
+        {
+            if (chunk.count != 0)
+            {
+                if (!isFirst)
+                {
+                    output += ',';
+                }
+                isFirst = false;
+                output += chunk.json;
+                count += chunk.count;
+                FlushIfFull(output);
+            }
+        }
+        return count;
+    }
+
+    void WriteRepetition(const Node& node, const TemplateScope& itemScope, std::string& output, bool& isFirst)
+    {
+        if (!isFirst)
+        {
+            output += ',';
+        }
+        isFirst = false;
+
+        output += '{';
+        bool isFirstProperty = true;
+        for (size_t i = 0; i < node.children.size(); ++i)
+        {
+            // a property whose value isn't in the data is left out
+            const auto& child = node.children[i];
+            TemplateValue value;
+            if (child.kind == CompiledTemplateNodeKind::String)
+            {
+                value = child.string->Evaluate(itemScope);
+                if (value.IsUndefined())
+                {
+                    continue;
+                }
+            }
+
+            if (!isFirstProperty)
+            {
+                output += ',';
+            }
+            isFirstProperty = false;
+            output += node.keysJson[i];
+            if (child.kind == CompiledTemplateNodeKind::String)
+            {
+                ParseUtil::WriteJson(value.Get(), output);
+            }
+            else
+            {
+                Write(child, itemScope, output);
+            }
+            FlushIfFull(output);
+        }
+        output += '}';
+    }
+
+    // Moves what's been written to the stream, if there is one, once there's enough of it
+    void FlushIfFull(std::string& output)
+    {
+        if (m_stream && output.size() >= c_streamBufferSize)
+        {
+            m_stream->write(output.data(), static_cast<std::streamsize>(output.size()));
+            output.clear();
+        }
+    }
+
+    // Writes what expanding an item of an array adds to the array: nothing for null, and each of the items of an array
+    void WriteArrayItem(const Node& node, const TemplateScope& scope, std::string& output, bool& isFirst)
+    {
+        switch (node.kind)
+        {
+        case CompiledTemplateNodeKind::Static:
+            if (!isFirst)
+            {
+                output += ',';
+            }
+            isFirst = false;
+            output += node.json;
+            break;
+        case CompiledTemplateNodeKind::String:
+        {
+            const auto value = node.string->Evaluate(scope);
+            const auto& json = value.Get();
+            if (value.IsUndefined() || json.isNull())
+            {
+                break;
+            }
+
+            if (json.isArray())
+            {
+                for (const auto& item : json)
+                {
+                    if (!isFirst)
+                    {
+                        output += ',';
+                    }
+                    isFirst = false;
+                    ParseUtil::WriteJson(item, output);
+                    FlushIfFull(output);
+                }
+            }
+            else
+            {
+                if (!isFirst)
+                {
+                    output += ',';
+                }
+                isFirst = false;
+                ParseUtil::WriteJson(json, output);
+            }
+            break;
+        }
+        case CompiledTemplateNodeKind::Array:
+            // an array in an array expands to its items
+            for (const auto& child : node.children)
+            {
+                WriteArrayItem(child, scope, output, isFirst);
+            }
+            break;
+        case CompiledTemplateNodeKind::Object:
+        default:
+            WriteRepetitions(node, scope, output, isFirst);
+            break;
+        }
+        FlushIfFull(output);
+    }
+
+    std::vector<std::string>* m_warnings;
+    ThreadPool* m_threadPool;
+    size_t m_parallelThreshold;
+    std::ostream* m_stream;
+};
+} // namespace
+
+CompiledTemplate::CompiledTemplate(const Json::Value& templateJson) :
+    m_parallelThreshold(c_defaultTemplateParallelThreshold)
+{
+    TemplateCompiler compiler;
+    m_root = std::make_unique<Node>(compiler.Compile(templateJson));
+    WriteStaticJson(*m_root);
+    m_bindingCount = compiler.GetBindingCount();
+}
+
+CompiledTemplate::CompiledTemplate(const std::string& templateString) :
+    CompiledTemplate(ParseUtil::GetJsonValueFromString(templateString))
+{
+}
+
+void CompiledTemplate::SetThreadPool(std::shared_ptr<ThreadPool> threadPool)
+{
+    m_threadPool = std::move(threadPool);
+}
+
+std::shared_ptr<ThreadPool> CompiledTemplate::GetThreadPool() const
+{
+    return m_threadPool;
+}
+
+void CompiledTemplate::SetParallelThreshold(size_t itemCount)
+{
+    m_parallelThreshold = itemCount;
+}
+
+size_t CompiledTemplate::GetParallelThreshold() const
+{
+    return m_parallelThreshold;
+}
+
+CompiledTemplate::CompiledTemplate(CompiledTemplate&&) noexcept = default;
+CompiledTemplate& CompiledTemplate::operator=(CompiledTemplate&&) noexcept = default;
+CompiledTemplate::~CompiledTemplate() = default;
+
+Json::Value CompiledTemplate::Expand(const Json::Value& data) const
+{
+    const TemplateScope scope{&data, nullptr, nullptr, std::nullopt};
+    auto result =
+        CompiledTemplateExpander(nullptr, m_threadPool.get(), m_parallelThreshold, nullptr).Expand(*m_root, scope);
+    return result.has_value() ? std::move(*result) : Json::Value();
+}
+
+Json::Value CompiledTemplate::Expand(const Json::Value& data, std::vector<std::string>& warnings) const
+{
+    const TemplateScope scope{&data, nullptr, nullptr, std::nullopt};
+    auto result =
+        CompiledTemplateExpander(&warnings, m_threadPool.get(), m_parallelThreshold, nullptr).Expand(*m_root, scope);
+    return result.has_value() ? std::move(*result) : Json::Value();
+}
+
+std::string CompiledTemplate::ExpandToString(const Json::Value& data) const
+{
+    const TemplateScope scope{&data, nullptr, nullptr, std::nullopt};
+    std::string output;
+    CompiledTemplateExpander(nullptr, m_threadPool.get(), m_parallelThreshold, nullptr).Write(*m_root, scope, output);
+    return output;
+}
+
+std::string CompiledTemplate::ExpandToString(const Json::Value& data, std::vector<std::string>& warnings) const
+{
+    const TemplateScope scope{&data, nullptr, nullptr, std::nullopt};
+    std::string output;
+    CompiledTemplateExpander(&warnings, m_threadPool.get(), m_parallelThreshold, nullptr).Write(*m_root, scope, output);
+    return output;
+}
+
+void CompiledTemplate::ExpandTo(const Json::Value& data, std::ostream& output) const
+{
+    const TemplateScope scope{&data, nullptr, nullptr, std::nullopt};
+    std::string buffer;
+    CompiledTemplateExpander(nullptr, nullptr, 0, &output).Write(*m_root, scope, buffer);
+    output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+}
+
+void CompiledTemplate::ExpandTo(const Json::Value& data, std::ostream& output, std::vector<std::string>& warnings) const
+{
+    const TemplateScope scope{&data, nullptr, nullptr, std::nullopt};
+    std::string buffer;
+    CompiledTemplateExpander(&warnings, nullptr, 0, &output).Write(*m_root, scope, buffer);
+    output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+}
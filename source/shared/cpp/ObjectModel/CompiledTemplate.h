@@ -0,0 +1,72 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "TemplateExpression.h"
+#include "ThreadPool.h"
+
+namespace AdaptiveCards
+{
+// The fewest items of a $data array a CompiledTemplate expands in parallel, unless it's told otherwise
+constexpr size_t c_defaultTemplateParallelThreshold = 512;
+
+// A card template compiled for expanding with many payloads of data. Expanding an AdaptiveCardTemplate walks the
+// whole template and parses every template string it meets; a CompiledTemplate does that once, when it's built:
+//   - each template string is parsed into its expressions, with operations and calls of constants folded into
+//     their values
+//   - each subtree that doesn't bind to data (no "${", no $data or $when) is expanded ahead of time, and emitted
+//     whole: copied into the Json::Value that Expand returns, and appended as JSON text that's written ahead of time
+//     by ExpandToString
+// so that what an expansion costs is mostly what its bindings cost. Expands to exactly what AdaptiveCardTemplate
+// expands the same template to.
+class CompiledTemplate
+{
+public:
+    explicit CompiledTemplate(const Json::Value& templateJson);
+    // Throws an AdaptiveCardParseException when templateString isn't valid JSON
+    explicit CompiledTemplate(const std::string& templateString);
+
+    CompiledTemplate(CompiledTemplate&&) noexcept;
+    CompiledTemplate& operator=(CompiledTemplate&&) noexcept;
+    ~CompiledTemplate();
+
+    Json::Value Expand(const Json::Value& data) const;
+    // Adds a warning for each $when that couldn't be evaluated (and so dropped its object)
+    Json::Value Expand(const Json::Value& data, std::vector<std::string>& warnings) const;
+
+    // The expanded template as compact JSON, byte for byte what ParseUtil::WriteJson writes for what Expand returns
+    std::string ExpandToString(const Json::Value& data) const;
+    std::string ExpandToString(const Json::Value& data, std::vector<std::string>& warnings) const;
+
+    // With a thread pool, an object repeated for at least GetParallelThreshold() items of a $data array is expanded on
+    // the pool's threads, each taking contiguous runs of the items into buffers of their own that are merged in order.
+    // Expands to exactly what expanding on one thread does ($index and $root included), with the warnings in the same
+    // order. Without one (the default) everything is expanded on the calling thread, as suits expanding many payloads
+    // at once. ExpandTo always expands on the calling thread. A pool that's busy with another expansion or batch when
+    // it's called on is waited for, as ThreadPool::ParallelFor does.
+    void SetThreadPool(std::shared_ptr<ThreadPool> threadPool);
+    std::shared_ptr<ThreadPool> GetThreadPool() const;
+
+    void SetParallelThreshold(size_t itemCount);
+    size_t GetParallelThreshold() const;
+
+    // Writes what ExpandToString returns to output as the template is expanded rather than once it's expanded, so that
+    // what's held in memory doesn't grow with the size of the expanded card but with how deeply its template nests (and
+    // the largest single value bound from the data, which is written whole).
+    void ExpandTo(const Json::Value& data, std::ostream& output) const;
+    void ExpandTo(const Json::Value& data, std::ostream& output, std::vector<std::string>& warnings) const;
+
+    // The number of bindings (template strings, $data and $when) an expansion evaluates, not counting repetitions
+    size_t GetBindingCount() const { return m_bindingCount; }
+
+    // A node of the compiled template, defined in CompiledTemplate.cpp
+    struct Node;
+
+private:
+    std::unique_ptr<Node> m_root;
+    size_t m_bindingCount;
+    std::shared_ptr<ThreadPool> m_threadPool;
+    size_t m_parallelThreshold;
+};
+} // namespace AdaptiveCards
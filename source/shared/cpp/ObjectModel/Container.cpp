@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "Container.h"
+#include "ElementVisitor.h"
 #include "TextBlock.h"
 #include "ColumnSet.h"
 #include "ParseUtil.h"
@@ -44,7 +45,7 @@ void Container::SetRtl(const std::optional<bool>& value)
 Json::Value Container::SerializeToJsonValue() const
 {
     Json::Value root = StyledCollectionElement::SerializeToJsonValue();
-    std::string const& itemsPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items);
+    const Json::StaticString& itemsPropertyName = AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Items);
     root[itemsPropertyName] = Json::Value(Json::arrayValue);
     for (const auto& cardElement : m_items)
     {
@@ -53,7 +54,7 @@ Json::Value Container::SerializeToJsonValue() const
 
     if (m_rtl.has_value())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl)] = m_rtl.value_or("");
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Rtl)] = m_rtl.value_or("");
     }
 
     return root;
@@ -89,18 +90,18 @@ std::shared_ptr<BaseCardElement> ContainerParser::DeserializeFromString(ParseCon
 
 void Container::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Bleed),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Bleed,
+         AdaptiveCardSchemaKey::Rtl,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::VerticalContentAlignment,
+         AdaptiveCardSchemaKey::SelectAction,
+         AdaptiveCardSchemaKey::Items});
+    m_knownProperties = &knownProperties;
 }
 
 void Container::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
 {
-    auto items = GetItems();
-    StyledCollectionElement::GetResourceInformation<BaseCardElement>(resourceInfo, items);
-    return;
+    CollectResourceInformation(*this, resourceInfo);
 }
@@ -11,12 +11,12 @@ Json::Value ContentSource::SerializeToJsonValue() const
 
     if (!m_mimeType.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MimeType)] = m_mimeType;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::MimeType)] = m_mimeType;
     }
 
     if (!m_url.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url)] = m_url;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Url)] = m_url;
     }
 
     return root;
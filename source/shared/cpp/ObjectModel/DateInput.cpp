@@ -18,22 +18,22 @@ Json::Value DateInput::SerializeToJsonValue() const
 
     if (!m_max.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max)] = m_max;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Max)] = m_max;
     }
 
     if (!m_min.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min)] = m_min;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Min)] = m_min;
     }
 
     if (!m_placeholder.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder)] = m_placeholder;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Placeholder)] = m_placeholder;
     }
 
     if (!m_value.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value)] = m_value;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Value)] = m_value;
     }
 
     return root;
@@ -100,9 +100,11 @@ std::shared_ptr<BaseCardElement> DateInputParser::DeserializeFromString(ParseCon
 
 void DateInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Max,
+         AdaptiveCardSchemaKey::Min,
+         AdaptiveCardSchemaKey::Value,
+         AdaptiveCardSchemaKey::Placeholder});
+    m_knownProperties = &knownProperties;
 }
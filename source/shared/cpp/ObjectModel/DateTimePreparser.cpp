@@ -26,6 +26,18 @@ DateTimePreparser::DateTimePreparser(std::string const& in) : m_hasDateTokens(fa
     ParseDateTime(in);
 }
 
+DateTimePreparser::DateTimePreparser(std::string const& in, bool mayHaveDateTokens) : m_hasDateTokens(false)
+{
+    if (mayHaveDateTokens)
+    {
+        ParseDateTime(in);
+    }
+    else
+    {
+        AddTextToken(in, DateTimePreparsedTokenFormat::RegularString);
+    }
+}
+
 std::vector<std::shared_ptr<DateTimePreparsedToken>> DateTimePreparser::GetTextTokens() const
 {
     return m_textTokenCollection;
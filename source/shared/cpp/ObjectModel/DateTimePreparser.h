@@ -12,6 +12,8 @@ class DateTimePreparser
 public:
     DateTimePreparser();
     DateTimePreparser(const std::string& in);
+    // in is taken as it is, without looking for tokens, unless it may have them (see TextFeatures)
+    DateTimePreparser(const std::string& in, bool mayHaveDateTokens);
     std::vector<std::shared_ptr<DateTimePreparsedToken>> GetTextTokens() const;
     bool HasDateTokens() const;
     static bool TryParseSimpleTime(const std::string& string, unsigned int& hours, unsigned int& minutes);
@@ -0,0 +1,316 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ElementIdIndex.h"
+#include "ActionSet.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "Image.h"
+#include "ImageSet.h"
+#include "RichTextBlock.h"
+#include "SharedAdaptiveCard.h"
+#include "Table.h"
+#include "TableCell.h"
+#include "TableRow.h"
+#include "TextRun.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+template <typename T>
+const BaseElement* GetAt(const std::vector<std::shared_ptr<T>>& elements, std::uint32_t slot)
+{
+    return slot < elements.size() ? elements[slot].get() : nullptr;
+}
+} // namespace
+
+namespace AdaptiveCards
+{
+void ElementIdIndex::Build(const AdaptiveCard& card)
+{
+    Clear();
+
+    const auto& body = card.GetBody();
+    for (std::uint32_t i = 0; i < body.size(); ++i)
+    {
+        if (body[i])
+        {
+            AddTree(body[i], c_cardNode, ChildKind::Body, i, false);
+        }
+    }
+
+    const auto& actions = card.GetActions();
+    for (std::uint32_t i = 0; i < actions.size(); ++i)
+    {
+        if (actions[i])
+        {
+            AddTree(actions[i], c_cardNode, ChildKind::Actions, i, false);
+        }
+    }
+
+    if (const auto selectAction = card.GetSelectAction())
+    {
+        AddTree(selectAction, c_cardNode, ChildKind::SelectAction, 0, false);
+    }
+}
+
+std::uint32_t ElementIdIndex::AddNode(const std::shared_ptr<BaseElement>& element, const Node& node, bool isFallback)
+{
+    const auto nodeIndex = static_cast<std::uint32_t>(m_nodes.size());
+    m_nodes.push_back(node);
+
+    const auto& id = element->GetId();
+    if (!id.empty())
+    {
+        m_entries.emplace(id, IndexedEntry{Entry{element, isFallback}, nodeIndex});
+    }
+    return nodeIndex;
+}
+
+// Goes into the same children as the walk in ElementVisitor.cpp, which can't be used here as it only hands out
+// references and the index needs the owning pointers. GetChild must find each child where this puts it.
+void ElementIdIndex::AddTree(
+    const std::shared_ptr<BaseCardElement>& element,
+    std::uint32_t parent,
+    ChildKind kind,
+    std::uint32_t slot,
+    bool isFallback)
+{
+    const auto node = AddNode(element, Node{element.get(), parent, slot, kind, false}, isFallback);
+
+    switch (element->GetElementType())
+    {
+    case CardElementType::Container:
+    case CardElementType::TableCell:
+    {
+        const auto& container = static_cast<const Container&>(*element);
+        AddElements(container.GetItems(), node, isFallback);
+        AddSelectAction(container.GetSelectAction(), node, isFallback);
+        break;
+    }
+    case CardElementType::Column:
+    {
+        const auto& column = static_cast<const Column&>(*element);
+        AddElements(column.GetItems(), node, isFallback);
+        AddSelectAction(column.GetSelectAction(), node, isFallback);
+        break;
+    }
+    case CardElementType::ColumnSet:
+    {
+        const auto& columnSet = static_cast<const ColumnSet&>(*element);
+        AddElements(columnSet.GetColumns(), node, isFallback);
+        AddSelectAction(columnSet.GetSelectAction(), node, isFallback);
+        break;
+    }
+    case CardElementType::ImageSet:
+        AddElements(static_cast<const ImageSet&>(*element).GetImages(), node, isFallback);
+        break;
+    case CardElementType::Image:
+        AddSelectAction(static_cast<const Image&>(*element).GetSelectAction(), node, isFallback);
+        break;
+    case CardElementType::Table:
+        AddElements(static_cast<const Table&>(*element).GetRows(), node, isFallback);
+        break;
+    case CardElementType::TableRow:
+        AddElements(static_cast<const TableRow&>(*element).GetCells(), node, isFallback);
+        break;
+    case CardElementType::ActionSet:
+        AddElements(static_cast<const ActionSet&>(*element).GetActions(), node, isFallback);
+        break;
+    case CardElementType::RichTextBlock:
+    {
+        const auto& inlines = static_cast<const RichTextBlock&>(*element).GetInlines();
+        for (std::uint32_t i = 0; i < inlines.size(); ++i)
+        {
+            if (inlines[i] && inlines[i]->GetInlineType() == InlineElementType::TextRun)
+            {
+                if (const auto selectAction = std::static_pointer_cast<TextRun>(inlines[i])->GetSelectAction())
+                {
+                    AddTree(selectAction, node, ChildKind::InlineSelectAction, i, isFallback);
+                }
+            }
+        }
+        break;
+    }
+    default:
+        break;
+    }
+
+    // the fallback content of an element is always another element
+    if (const auto& fallbackContent = element->GetFallbackContent())
+    {
+        AddTree(std::static_pointer_cast<BaseCardElement>(fallbackContent), node, ChildKind::Fallback, 0, true);
+    }
+}
+
+void ElementIdIndex::AddTree(
+    const std::shared_ptr<BaseActionElement>& action,
+    std::uint32_t parent,
+    ChildKind kind,
+    std::uint32_t slot,
+    bool isFallback)
+{
+    const auto node = AddNode(action, Node{action.get(), parent, slot, kind, true}, isFallback);
+
+    // the fallback content of an action is always another action
+    if (const auto& fallbackContent = action->GetFallbackContent())
+    {
+        AddTree(std::static_pointer_cast<BaseActionElement>(fallbackContent), node, ChildKind::Fallback, 0, true);
+    }
+}
+
+template <typename T>
+void ElementIdIndex::AddElements(const std::vector<std::shared_ptr<T>>& elements, std::uint32_t parent, bool isFallback)
+{
+    for (std::uint32_t i = 0; i < elements.size(); ++i)
+    {
+        if (elements[i])
+        {
+            AddTree(elements[i], parent, ChildKind::Items, i, isFallback);
+        }
+    }
+}
+
+void ElementIdIndex::AddSelectAction(
+    const std::shared_ptr<BaseActionElement>& selectAction, std::uint32_t parent, bool isFallback)
+{
+    if (selectAction)
+    {
+        AddTree(selectAction, parent, ChildKind::SelectAction, 0, isFallback);
+    }
+}
+
+const BaseElement* ElementIdIndex::GetChild(const BaseElement& parent, bool isAction, ChildKind kind, std::uint32_t slot)
+{
+    if (kind == ChildKind::Fallback)
+    {
+        return parent.GetFallbackContent().get();
+    }
+    if (isAction)
+    {
+        return nullptr;
+    }
+
+    const auto& element = static_cast<const BaseCardElement&>(parent);
+    switch (element.GetElementType())
+    {
+    case CardElementType::Container:
+    case CardElementType::TableCell:
+    {
+        const auto& container = static_cast<const Container&>(element);
+        return kind == ChildKind::Items        ? GetAt(container.GetItems(), slot) :
+               kind == ChildKind::SelectAction ? container.GetSelectAction().get() :
+                                                 nullptr;
+    }
+    case CardElementType::Column:
+    {
+        const auto& column = static_cast<const Column&>(element);
+        return kind == ChildKind::Items        ? GetAt(column.GetItems(), slot) :
+               kind == ChildKind::SelectAction ? column.GetSelectAction().get() :
+                                                 nullptr;
+    }
+    case CardElementType::ColumnSet:
+    {
+        const auto& columnSet = static_cast<const ColumnSet&>(element);
+        return kind == ChildKind::Items        ? GetAt(columnSet.GetColumns(), slot) :
+               kind == ChildKind::SelectAction ? columnSet.GetSelectAction().get() :
+                                                 nullptr;
+    }
+    case CardElementType::ImageSet:
+        return kind == ChildKind::Items ? GetAt(static_cast<const ImageSet&>(element).GetImages(), slot) : nullptr;
+    case CardElementType::Image:
+        return kind == ChildKind::SelectAction ? static_cast<const Image&>(element).GetSelectAction().get() : nullptr;
+    case CardElementType::Table:
+        return kind == ChildKind::Items ? GetAt(static_cast<const Table&>(element).GetRows(), slot) : nullptr;
+    case CardElementType::TableRow:
+        return kind == ChildKind::Items ? GetAt(static_cast<const TableRow&>(element).GetCells(), slot) : nullptr;
+    case CardElementType::ActionSet:
+        return kind == ChildKind::Items ? GetAt(static_cast<const ActionSet&>(element).GetActions(), slot) : nullptr;
+    case CardElementType::RichTextBlock:
+    {
+        const auto& inlines = static_cast<const RichTextBlock&>(element).GetInlines();
+        if (kind != ChildKind::InlineSelectAction || slot >= inlines.size() || !inlines[slot] ||
+            inlines[slot]->GetInlineType() != InlineElementType::TextRun)
+        {
+            return nullptr;
+        }
+        return static_cast<const TextRun&>(*inlines[slot]).GetSelectAction().get();
+    }
+    default:
+        return nullptr;
+    }
+}
+
+const BaseElement* ElementIdIndex::Resolve(const AdaptiveCard& card, std::uint32_t node) const
+{
+    const auto& found = m_nodes[node];
+
+    const BaseElement* child = nullptr;
+    if (found.parent == c_cardNode)
+    {
+        switch (found.kind)
+        {
+        case ChildKind::Body:
+            child = GetAt(card.GetBody(), found.slot);
+            break;
+        case ChildKind::Actions:
+            child = GetAt(card.GetActions(), found.slot);
+            break;
+        case ChildKind::SelectAction:
+            child = card.GetSelectAction().get();
+            break;
+        default:
+            break;
+        }
+    }
+    else if (const auto parent = Resolve(card, found.parent))
+    {
+        child = GetChild(*parent, m_nodes[found.parent].isAction, found.kind, found.slot);
+    }
+
+    return child == found.element ? child : nullptr;
+}
+
+void ElementIdIndex::Clear()
+{
+    m_entries.clear();
+    m_nodes.clear();
+}
+
+std::shared_ptr<BaseElement> ElementIdIndex::Find(const AdaptiveCard& card, const std::string& id) const
+{
+    const auto range = m_entries.equal_range(id);
+    for (auto entry = range.first; entry != range.second; ++entry)
+    {
+        if (!entry->second.entry.isFallback && Resolve(card, entry->second.node))
+        {
+            // the lock fails if what's there now is another element that happens to have the same address, and the id
+            // may have been changed since
+            auto element = entry->second.entry.element.lock();
+            if (element && element->GetId() == id)
+            {
+                return element;
+            }
+        }
+    }
+    return nullptr;
+}
+
+std::vector<ElementIdIndex::Entry> ElementIdIndex::FindAll(const std::string& id) const
+{
+    std::vector<Entry> entries;
+    const auto range = m_entries.equal_range(id);
+    for (auto entry = range.first; entry != range.second; ++entry)
+    {
+        entries.push_back(entry->second.entry);
+    }
+    return entries;
+}
+
+size_t ElementIdIndex::GetSize() const
+{
+    return m_entries.size();
+}
+} // namespace AdaptiveCards
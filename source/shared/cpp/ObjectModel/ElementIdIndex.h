@@ -0,0 +1,105 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveCards
+{
+class AdaptiveCard;
+class BaseActionElement;
+class BaseCardElement;
+class BaseElement;
+
+// Weak references to the elements and actions of a card that have an id, so they can be found without walking the
+// card; see AdaptiveCard::GetElementById.
+//
+// Each entry also records where in the card its element was found: which child of which indexed parent it was, up to
+// the card. Nothing tells the index when the card changes, so Find checks that path instead, in time proportional to
+// how deeply the element is nested: an element that has been removed, moved, replaced or given another id since the
+// index was built isn't returned. An element that has been added since isn't in the index at all; the card rebuilds
+// the index when a lookup finds nothing.
+class ElementIdIndex
+{
+public:
+    struct Entry
+    {
+        std::weak_ptr<BaseElement> element;
+        // true if the element is (or is inside) the fallback content of another element or action
+        bool isFallback;
+    };
+
+    // Indexes the body, actions and select action of the card, down to (but not into) the cards of Action.ShowCard
+    void Build(const AdaptiveCard& card);
+
+    void Clear();
+
+    // The element with the id that isn't fallback content, or nullptr if there is none. card is the card the index
+    // was built from; nullptr is also returned if the element that had the id isn't where it was in card any more.
+    std::shared_ptr<BaseElement> Find(const AdaptiveCard& card, const std::string& id) const;
+
+    // Every entry with the id, fallback content included, as of when the index was built
+    std::vector<Entry> FindAll(const std::string& id) const;
+
+    size_t GetSize() const;
+
+private:
+    // Which child of its parent an element or action was found as. Children of the card are Body, Actions or
+    // SelectAction; those of an element are Items (whatever its collection of children is: the items of a container,
+    // the columns of a column set, the actions of an action set, and so on), SelectAction, InlineSelectAction (the
+    // select action of the text run at the slot) or Fallback.
+    enum class ChildKind : std::uint8_t
+    {
+        Body,
+        Actions,
+        Items,
+        SelectAction,
+        InlineSelectAction,
+        Fallback
+    };
+
+    // An element or action the index went through, with or without an id
+    struct Node
+    {
+        // compared, never dereferenced: it's only known to still be alive once it's been found where it was
+        const BaseElement* element;
+        // the node of the parent, or c_cardNode for a child of the card
+        std::uint32_t parent;
+        std::uint32_t slot;
+        ChildKind kind;
+        bool isAction;
+    };
+
+    static constexpr std::uint32_t c_cardNode = std::numeric_limits<std::uint32_t>::max();
+
+    struct IndexedEntry
+    {
+        Entry entry;
+        std::uint32_t node;
+    };
+
+    std::uint32_t AddNode(const std::shared_ptr<BaseElement>& element, const Node& node, bool isFallback);
+    void AddTree(
+        const std::shared_ptr<BaseCardElement>& element,
+        std::uint32_t parent,
+        ChildKind kind,
+        std::uint32_t slot,
+        bool isFallback);
+    void AddTree(
+        const std::shared_ptr<BaseActionElement>& action,
+        std::uint32_t parent,
+        ChildKind kind,
+        std::uint32_t slot,
+        bool isFallback);
+    template <typename T>
+    void AddElements(const std::vector<std::shared_ptr<T>>& elements, std::uint32_t parent, bool isFallback);
+    void AddSelectAction(const std::shared_ptr<BaseActionElement>& selectAction, std::uint32_t parent, bool isFallback);
+
+    // The element at the node if it's still there, going down from the card
+    const BaseElement* Resolve(const AdaptiveCard& card, std::uint32_t node) const;
+    static const BaseElement* GetChild(const BaseElement& parent, bool isAction, ChildKind kind, std::uint32_t slot);
+
+    std::unordered_multimap<std::string, IndexedEntry> m_entries;
+    std::vector<Node> m_nodes;
+};
+} // namespace AdaptiveCards
@@ -29,12 +29,18 @@ BaseCardElementParserWrapper::BaseCardElementParserWrapper(std::shared_ptr<BaseC
 }
 
 std::shared_ptr<BaseCardElement> BaseCardElementParserWrapper::Deserialize(ParseContext& context, const Json::Value& value)
+{
+    return Deserialize(context, *m_parser, value);
+}
+
+std::shared_ptr<BaseCardElement> BaseCardElementParserWrapper::Deserialize(
+    ParseContext& context, BaseCardElementParser& parser, const Json::Value& value)
 {
     const auto& idProperty = ParseUtil::GetString(value, AdaptiveCardSchemaKey::Id);
     const InternalId internalId = InternalId::Next();
 
     context.PushElement(idProperty, internalId);
-    std::shared_ptr<BaseCardElement> element = m_parser->Deserialize(context, value);
+    std::shared_ptr<BaseCardElement> element = parser.Deserialize(context, value);
     context.PopElement();
 
     return element;
@@ -45,54 +51,78 @@ std::shared_ptr<BaseCardElement> BaseCardElementParserWrapper::DeserializeFromSt
     return Deserialize(context, ParseUtil::GetJsonValueFromString(value));
 }
 
-ElementParserRegistration::ElementParserRegistration()
+namespace
 {
-    m_knownElements.insert(
-        {CardElementTypeToString(CardElementType::ActionSet),
-         CardElementTypeToString(CardElementType::ChoiceSetInput),
-         CardElementTypeToString(CardElementType::Column),
-         CardElementTypeToString(CardElementType::ColumnSet),
-         CardElementTypeToString(CardElementType::Container),
-         CardElementTypeToString(CardElementType::DateInput),
-         CardElementTypeToString(CardElementType::FactSet),
-         CardElementTypeToString(CardElementType::Image),
-         CardElementTypeToString(CardElementType::ImageSet),
-         CardElementTypeToString(CardElementType::Media),
-         CardElementTypeToString(CardElementType::NumberInput),
-         CardElementTypeToString(CardElementType::RichTextBlock),
-         CardElementTypeToString(CardElementType::Table),
-         CardElementTypeToString(CardElementType::TextBlock),
-         CardElementTypeToString(CardElementType::TextInput),
-         CardElementTypeToString(CardElementType::TimeInput),
-         CardElementTypeToString(CardElementType::ToggleInput),
-         CardElementTypeToString(CardElementType::Unknown)});
+    // Element types whose parsers hosts may not override or remove
+    const std::unordered_set<std::string>& KnownElements()
+    {
+        static const std::unordered_set<std::string> knownElements{
+            CardElementTypeToString(CardElementType::ActionSet),
+            CardElementTypeToString(CardElementType::ChoiceSetInput),
+            CardElementTypeToString(CardElementType::Column),
+            CardElementTypeToString(CardElementType::ColumnSet),
+            CardElementTypeToString(CardElementType::Container),
+            CardElementTypeToString(CardElementType::DateInput),
+            CardElementTypeToString(CardElementType::FactSet),
+            CardElementTypeToString(CardElementType::Image),
+            CardElementTypeToString(CardElementType::ImageSet),
+            CardElementTypeToString(CardElementType::Media),
+            CardElementTypeToString(CardElementType::NumberInput),
+            CardElementTypeToString(CardElementType::RichTextBlock),
+            CardElementTypeToString(CardElementType::Table),
+            CardElementTypeToString(CardElementType::TextBlock),
+            CardElementTypeToString(CardElementType::TextInput),
+            CardElementTypeToString(CardElementType::TimeInput),
+            CardElementTypeToString(CardElementType::ToggleInput),
+            CardElementTypeToString(CardElementType::Unknown)};
+        return knownElements;
+    }
 
-    m_cardElementParsers.insert(
-        {{CardElementTypeToString(CardElementType::ActionSet), std::make_shared<ActionSetParser>()},
-         {CardElementTypeToString(CardElementType::ChoiceSetInput), std::make_shared<ChoiceSetInputParser>()},
-         {CardElementTypeToString(CardElementType::Column), std::make_shared<ColumnParser>()},
-         {CardElementTypeToString(CardElementType::ColumnSet), std::make_shared<ColumnSetParser>()},
-         {CardElementTypeToString(CardElementType::Container), std::make_shared<ContainerParser>()},
-         {CardElementTypeToString(CardElementType::DateInput), std::make_shared<DateInputParser>()},
-         {CardElementTypeToString(CardElementType::FactSet), std::make_shared<FactSetParser>()},
-         {CardElementTypeToString(CardElementType::Image), std::make_shared<ImageParser>()},
-         {CardElementTypeToString(CardElementType::ImageSet), std::make_shared<ImageSetParser>()},
-         {CardElementTypeToString(CardElementType::Media), std::make_shared<MediaParser>()},
-         {CardElementTypeToString(CardElementType::NumberInput), std::make_shared<NumberInputParser>()},
-         {CardElementTypeToString(CardElementType::RichTextBlock), std::make_shared<RichTextBlockParser>()},
-         {CardElementTypeToString(CardElementType::Table), std::make_shared<TableParser>()},
-         {CardElementTypeToString(CardElementType::TextBlock), std::make_shared<TextBlockParser>()},
-         {CardElementTypeToString(CardElementType::TextInput), std::make_shared<TextInputParser>()},
-         {CardElementTypeToString(CardElementType::TimeInput), std::make_shared<TimeInputParser>()},
-         {CardElementTypeToString(CardElementType::ToggleInput), std::make_shared<ToggleInputParser>()},
-         {CardElementTypeToString(CardElementType::Unknown), std::make_shared<UnknownElementParser>()}});
+    // Built once and shared by every registration until it adds or removes a parser
+    const std::shared_ptr<ElementParserRegistration::ParserMap>& DefaultParsers()
+    {
+        static const auto defaultParsers = std::make_shared<ElementParserRegistration::ParserMap>(ElementParserRegistration::ParserMap{
+            {CardElementTypeToString(CardElementType::ActionSet), std::make_shared<ActionSetParser>()},
+            {CardElementTypeToString(CardElementType::ChoiceSetInput), std::make_shared<ChoiceSetInputParser>()},
+            {CardElementTypeToString(CardElementType::Column), std::make_shared<ColumnParser>()},
+            {CardElementTypeToString(CardElementType::ColumnSet), std::make_shared<ColumnSetParser>()},
+            {CardElementTypeToString(CardElementType::Container), std::make_shared<ContainerParser>()},
+            {CardElementTypeToString(CardElementType::DateInput), std::make_shared<DateInputParser>()},
+            {CardElementTypeToString(CardElementType::FactSet), std::make_shared<FactSetParser>()},
+            {CardElementTypeToString(CardElementType::Image), std::make_shared<ImageParser>()},
+            {CardElementTypeToString(CardElementType::ImageSet), std::make_shared<ImageSetParser>()},
+            {CardElementTypeToString(CardElementType::Media), std::make_shared<MediaParser>()},
+            {CardElementTypeToString(CardElementType::NumberInput), std::make_shared<NumberInputParser>()},
+            {CardElementTypeToString(CardElementType::RichTextBlock), std::make_shared<RichTextBlockParser>()},
+            {CardElementTypeToString(CardElementType::Table), std::make_shared<TableParser>()},
+            {CardElementTypeToString(CardElementType::TextBlock), std::make_shared<TextBlockParser>()},
+            {CardElementTypeToString(CardElementType::TextInput), std::make_shared<TextInputParser>()},
+            {CardElementTypeToString(CardElementType::TimeInput), std::make_shared<TimeInputParser>()},
+            {CardElementTypeToString(CardElementType::ToggleInput), std::make_shared<ToggleInputParser>()},
+            {CardElementTypeToString(CardElementType::Unknown), std::make_shared<UnknownElementParser>()}});
+        return defaultParsers;
+    }
+} // namespace
+
+ElementParserRegistration::ElementParserRegistration() : m_cardElementParsers{DefaultParsers()}
+{
+}
+
+ElementParserRegistration::ParserMap& ElementParserRegistration::GetParsersForWrite()
+{
+    // the default table is always shared, as DefaultParsers() holds on to it
+    if (m_cardElementParsers.use_count() > 1)
+    {
+        m_cardElementParsers = std::make_shared<ParserMap>(*m_cardElementParsers);
+    }
+    return *m_cardElementParsers;
 }
 
 void ElementParserRegistration::AddParser(std::string const& elementType, std::shared_ptr<BaseCardElementParser> parser)
 {
-    if (m_knownElements.find(elementType) == m_knownElements.end())
+    if (KnownElements().find(elementType) == KnownElements().end())
     {
-        ElementParserRegistration::m_cardElementParsers[elementType] = parser;
+        GetParsersForWrite()[elementType] = parser;
     }
     else
     {
@@ -103,9 +133,9 @@ void ElementParserRegistration::AddParser(std::string const& elementType, std::s
 
 void ElementParserRegistration::RemoveParser(std::string const& elementType)
 {
-    if (m_knownElements.find(elementType) == m_knownElements.end())
+    if (KnownElements().find(elementType) == KnownElements().end())
     {
-        ElementParserRegistration::m_cardElementParsers.erase(elementType);
+        GetParsersForWrite().erase(elementType);
     }
     else
     {
@@ -116,8 +146,8 @@ void ElementParserRegistration::RemoveParser(std::string const& elementType)
 
 std::shared_ptr<BaseCardElementParser> ElementParserRegistration::GetParser(std::string const& elementType) const
 {
-    auto parser = m_cardElementParsers.find(elementType);
-    if (parser != ElementParserRegistration::m_cardElementParsers.end())
+    auto parser = m_cardElementParsers->find(elementType);
+    if (parser != m_cardElementParsers->end())
     {
         // Why do we wrap the parser? As we parse elements, we need to push and pop state from the stack for ID
         // collision detection. We *could* do this within the implementation of parsers themselves, but that would
@@ -132,4 +162,10 @@ std::shared_ptr<BaseCardElementParser> ElementParserRegistration::GetParser(std:
         return std::shared_ptr<BaseCardElementParser>(nullptr);
     }
 }
+
+BaseCardElementParser* ElementParserRegistration::FindParser(std::string const& elementType) const
+{
+    auto parser = m_cardElementParsers->find(elementType);
+    return (parser != m_cardElementParsers->end()) ? parser->second.get() : nullptr;
+}
 } // namespace AdaptiveCards
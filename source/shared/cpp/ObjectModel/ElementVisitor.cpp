@@ -0,0 +1,336 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ElementVisitor.h"
+#include "ActionSet.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "Image.h"
+#include "ImageSet.h"
+#include "RichTextBlock.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+#include "Table.h"
+#include "TableCell.h"
+#include "TableRow.h"
+#include "TextRun.h"
+
+using namespace AdaptiveCards;
+
+VisitResult ElementVisitor::PreVisitCard(AdaptiveCard& /*card*/)
+{
+    return VisitResult::Continue;
+}
+
+VisitResult ElementVisitor::PostVisitCard(AdaptiveCard& /*card*/)
+{
+    return VisitResult::Continue;
+}
+
+VisitResult ElementVisitor::PreVisitElement(BaseCardElement& /*element*/, WalkPosition /*position*/)
+{
+    return VisitResult::Continue;
+}
+
+VisitResult ElementVisitor::PostVisitElement(BaseCardElement& /*element*/, WalkPosition /*position*/)
+{
+    return VisitResult::Continue;
+}
+
+VisitResult ElementVisitor::PreVisitAction(BaseActionElement& /*action*/, WalkPosition /*position*/)
+{
+    return VisitResult::Continue;
+}
+
+VisitResult ElementVisitor::PostVisitAction(BaseActionElement& /*action*/, WalkPosition /*position*/)
+{
+    return VisitResult::Continue;
+}
+
+VisitResult ElementVisitor::VisitInline(Inline& /*inlineElement*/)
+{
+    return VisitResult::Continue;
+}
+
+namespace
+{
+bool WalkCard(AdaptiveCard& card, ElementVisitor& visitor);
+bool WalkElement(BaseCardElement& element, WalkPosition position, ElementVisitor& visitor);
+bool WalkAction(BaseActionElement& action, WalkPosition position, ElementVisitor& visitor);
+
+template <typename T>
+bool WalkElements(const std::vector<std::shared_ptr<T>>& elements, ElementVisitor& visitor)
+{
+    for (const auto& element : elements)
+    {
+        if (element && !WalkElement(*element, WalkPosition::Item, visitor))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool WalkActions(const std::vector<std::shared_ptr<BaseActionElement>>& actions, ElementVisitor& visitor)
+{
+    for (const auto& action : actions)
+    {
+        if (action && !WalkAction(*action, WalkPosition::Action, visitor))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool WalkSelectAction(const std::shared_ptr<BaseActionElement>& selectAction, ElementVisitor& visitor)
+{
+    return !selectAction || WalkAction(*selectAction, WalkPosition::SelectAction, visitor);
+}
+
+bool WalkInlines(const std::vector<std::shared_ptr<Inline>>& inlines, ElementVisitor& visitor)
+{
+    for (const auto& inlineElement : inlines)
+    {
+        if (!inlineElement)
+        {
+            continue;
+        }
+
+        const auto result = visitor.VisitInline(*inlineElement);
+        if (result == VisitResult::Stop)
+        {
+            return false;
+        }
+
+        if (result == VisitResult::Continue && inlineElement->GetInlineType() == InlineElementType::TextRun &&
+            !WalkSelectAction(static_cast<TextRun&>(*inlineElement).GetSelectAction(), visitor))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Walks what the built-in element types hold; custom and leaf elements hold nothing the walk knows about
+bool WalkElementChildren(BaseCardElement& element, ElementVisitor& visitor)
+{
+    switch (element.GetElementType())
+    {
+    case CardElementType::Container:
+    case CardElementType::TableCell:
+    {
+        auto& container = static_cast<Container&>(element);
+        return WalkElements(container.GetItems(), visitor) && WalkSelectAction(container.GetSelectAction(), visitor);
+    }
+    case CardElementType::Column:
+    {
+        auto& column = static_cast<Column&>(element);
+        return WalkElements(column.GetItems(), visitor) && WalkSelectAction(column.GetSelectAction(), visitor);
+    }
+    case CardElementType::ColumnSet:
+    {
+        auto& columnSet = static_cast<ColumnSet&>(element);
+        return WalkElements(columnSet.GetColumns(), visitor) && WalkSelectAction(columnSet.GetSelectAction(), visitor);
+    }
+    case CardElementType::ImageSet:
+        return WalkElements(static_cast<ImageSet&>(element).GetImages(), visitor);
+    case CardElementType::Image:
+        return WalkSelectAction(static_cast<Image&>(element).GetSelectAction(), visitor);
+    case CardElementType::Table:
+        return WalkElements(static_cast<Table&>(element).GetRows(), visitor);
+    case CardElementType::TableRow:
+        return WalkElements(static_cast<TableRow&>(element).GetCells(), visitor);
+    case CardElementType::ActionSet:
+        return WalkActions(static_cast<ActionSet&>(element).GetActions(), visitor);
+    case CardElementType::RichTextBlock:
+        return WalkInlines(static_cast<RichTextBlock&>(element).GetInlines(), visitor);
+    default:
+        return true;
+    }
+}
+
+bool WalkElement(BaseCardElement& element, WalkPosition position, ElementVisitor& visitor)
+{
+    const auto result = visitor.PreVisitElement(element, position);
+    if (result == VisitResult::Stop)
+    {
+        return false;
+    }
+
+    if (result == VisitResult::Continue)
+    {
+        if (!WalkElementChildren(element, visitor))
+        {
+            return false;
+        }
+
+        // the fallback content of an element is always another element
+        const auto& fallbackContent = element.GetFallbackContent();
+        if (fallbackContent && !WalkElement(static_cast<BaseCardElement&>(*fallbackContent), WalkPosition::Fallback, visitor))
+        {
+            return false;
+        }
+    }
+
+    return visitor.PostVisitElement(element, position) != VisitResult::Stop;
+}
+
+bool WalkAction(BaseActionElement& action, WalkPosition position, ElementVisitor& visitor)
+{
+    const auto result = visitor.PreVisitAction(action, position);
+    if (result == VisitResult::Stop)
+    {
+        return false;
+    }
+
+    if (result == VisitResult::Continue)
+    {
+        if (action.GetElementType() == ActionType::ShowCard)
+        {
+            const auto card = static_cast<ShowCardAction&>(action).GetCard();
+            if (card && !WalkCard(*card, visitor))
+            {
+                return false;
+            }
+        }
+
+        // the fallback content of an action is always another action
+        const auto& fallbackContent = action.GetFallbackContent();
+        if (fallbackContent && !WalkAction(static_cast<BaseActionElement&>(*fallbackContent), WalkPosition::Fallback, visitor))
+        {
+            return false;
+        }
+    }
+
+    return visitor.PostVisitAction(action, position) != VisitResult::Stop;
+}
+
+bool WalkCard(AdaptiveCard& card, ElementVisitor& visitor)
+{
+    const auto result = visitor.PreVisitCard(card);
+    if (result == VisitResult::Stop)
+    {
+        return false;
+    }
+
+    if (result == VisitResult::Continue &&
+        !(WalkElements(card.GetBody(), visitor) && WalkActions(card.GetActions(), visitor) &&
+          WalkSelectAction(card.GetSelectAction(), visitor)))
+    {
+        return false;
+    }
+
+    return visitor.PostVisitCard(card) != VisitResult::Stop;
+}
+
+// The built-in GetResourceInformation overrides of the elements the walk goes into are implemented with this visitor,
+// so for those only their own resources are collected here; everything else reports through its override.
+class ResourceInformationCollector : public ElementVisitor
+{
+public:
+    explicit ResourceInformationCollector(std::vector<RemoteResourceInformation>& resourceInfo) :
+        m_resourceInfo(resourceInfo)
+    {
+    }
+
+    VisitResult PreVisitCard(AdaptiveCard& card) override
+    {
+        AddBackgroundImage(card.GetBackgroundImage());
+        return VisitResult::Continue;
+    }
+
+    VisitResult PreVisitElement(BaseCardElement& element, WalkPosition position) override
+    {
+        if (position == WalkPosition::Fallback)
+        {
+            return VisitResult::SkipChildren;
+        }
+
+        switch (element.GetElementType())
+        {
+        case CardElementType::Container:
+        case CardElementType::TableCell:
+        case CardElementType::Column:
+        case CardElementType::ColumnSet:
+            AddBackgroundImage(static_cast<StyledCollectionElement&>(element).GetBackgroundImage());
+            break;
+        case CardElementType::ImageSet:
+            break;
+        default:
+            element.GetResourceInformation(m_resourceInfo);
+            break;
+        }
+        return VisitResult::Continue;
+    }
+
+    VisitResult PreVisitAction(BaseActionElement& action, WalkPosition position) override
+    {
+        if (position == WalkPosition::Fallback)
+        {
+            return VisitResult::SkipChildren;
+        }
+
+        if (action.GetElementType() == ActionType::ShowCard)
+        {
+            action.BaseActionElement::GetResourceInformation(m_resourceInfo);
+        }
+        else
+        {
+            action.GetResourceInformation(m_resourceInfo);
+        }
+        return VisitResult::Continue;
+    }
+
+private:
+    void AddBackgroundImage(const std::shared_ptr<BackgroundImage>& backgroundImage)
+    {
+        if (backgroundImage != nullptr)
+        {
+            RemoteResourceInformation backgroundImageInfo;
+            backgroundImageInfo.url = backgroundImage->GetUrl();
+            backgroundImageInfo.mimeType = "image";
+            m_resourceInfo.push_back(backgroundImageInfo);
+        }
+    }
+
+    std::vector<RemoteResourceInformation>& m_resourceInfo;
+};
+} // namespace
+
+namespace AdaptiveCards
+{
+bool Walk(AdaptiveCard& card, ElementVisitor& visitor)
+{
+    return WalkCard(card, visitor);
+}
+
+bool Walk(BaseCardElement& element, ElementVisitor& visitor)
+{
+    return WalkElement(element, WalkPosition::Item, visitor);
+}
+
+bool Walk(BaseActionElement& action, ElementVisitor& visitor)
+{
+    return WalkAction(action, WalkPosition::Item, visitor);
+}
+
+void CollectResourceInformation(AdaptiveCard& card, std::vector<RemoteResourceInformation>& resourceInfo)
+{
+    ResourceInformationCollector collector(resourceInfo);
+    Walk(card, collector);
+}
+
+void CollectResourceInformation(BaseCardElement& element, std::vector<RemoteResourceInformation>& resourceInfo)
+{
+    ResourceInformationCollector collector(resourceInfo);
+    Walk(element, collector);
+}
+
+void CollectResourceInformation(BaseActionElement& action, std::vector<RemoteResourceInformation>& resourceInfo)
+{
+    ResourceInformationCollector collector(resourceInfo);
+    Walk(action, collector);
+}
+} // namespace AdaptiveCards
@@ -0,0 +1,76 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "RemoteResourceInformation.h"
+
+namespace AdaptiveCards
+{
+class AdaptiveCard;
+class BaseActionElement;
+class BaseCardElement;
+class Inline;
+
+// Returned from the hooks of an ElementVisitor to steer the walk
+enum class VisitResult
+{
+    Continue,
+    // Don't walk into what the element holds (only meaningful from a pre-visit hook)
+    SkipChildren,
+    // End the whole walk
+    Stop
+};
+
+// How the walk reached an element
+enum class WalkPosition
+{
+    // Where the walk started, in a card's body, or held by another element (items, columns, images, rows, cells)
+    Item,
+    // In the actions of a card or an ActionSet
+    Action,
+    // The selectAction of a card or element
+    SelectAction,
+    // The fallback content of an element or action
+    Fallback
+};
+
+// Hooks called by Walk. Every hook defaults to continuing the walk, so a visitor only needs to override the hooks it
+// cares about.
+class ElementVisitor
+{
+public:
+    virtual ~ElementVisitor() = default;
+
+    virtual VisitResult PreVisitCard(AdaptiveCard& card);
+    virtual VisitResult PostVisitCard(AdaptiveCard& card);
+
+    virtual VisitResult PreVisitElement(BaseCardElement& element, WalkPosition position);
+    virtual VisitResult PostVisitElement(BaseCardElement& element, WalkPosition position);
+
+    virtual VisitResult PreVisitAction(BaseActionElement& action, WalkPosition position);
+    virtual VisitResult PostVisitAction(BaseActionElement& action, WalkPosition position);
+
+    // Inlines have no post-visit hook; SkipChildren skips the inline's selectAction
+    virtual VisitResult VisitInline(Inline& inlineElement);
+};
+
+// Depth-first walk over everything reachable from the card or element: a card's body, actions and selectAction;
+// the items, columns, images, table rows and cells, inlines and actions held by the built-in elements; selectActions;
+// fallback content; and the cards of Action.ShowCard. Children are walked between an element's pre- and post-visit
+// hooks, in the order they appear in the card. Custom elements are visited but not walked into.
+//
+// The walk itself doesn't allocate. Walking into a show card whose parsing was deferred parses it; return
+// SkipChildren from PreVisitAction to avoid that.
+//
+// Returns false if a hook returned VisitResult::Stop.
+bool Walk(AdaptiveCard& card, ElementVisitor& visitor);
+bool Walk(BaseCardElement& element, ElementVisitor& visitor);
+bool Walk(BaseActionElement& action, ElementVisitor& visitor);
+
+// Appends the remote resources (images, media, icons) of the card or element and everything walked from it, except
+// fallback content. Elements the walk doesn't go into contribute through their GetResourceInformation override.
+void CollectResourceInformation(AdaptiveCard& card, std::vector<RemoteResourceInformation>& resourceInfo);
+void CollectResourceInformation(BaseCardElement& element, std::vector<RemoteResourceInformation>& resourceInfo);
+void CollectResourceInformation(BaseActionElement& action, std::vector<RemoteResourceInformation>& resourceInfo);
+} // namespace AdaptiveCards
@@ -16,13 +16,42 @@ struct CaseInsensitiveEqualTo
     }
 };
 
+// Orders strings ignoring ASCII case. Only used for the enum tables below, whose strings are all ASCII, so it can
+// skip the locale lookup std::toupper does on every character.
+struct CaseInsensitiveLess
+{
+    static constexpr char ToUpper(char c) noexcept
+    {
+        return (c >= 'a' && c <= 'z') ? static_cast<char>(c - ('a' - 'A')) : c;
+    }
+
+    template <typename T>
+    bool operator()(T const& lhs, T const& rhs) const noexcept
+    {
+        const size_t length = std::min(lhs.size(), rhs.size());
+        for (size_t i = 0; i < length; ++i)
+        {
+            const char lhsUpper = ToUpper(lhs[i]);
+            const char rhsUpper = ToUpper(rhs[i]);
+            if (lhsUpper != rhsUpper)
+            {
+                return static_cast<unsigned char>(lhsUpper) < static_cast<unsigned char>(rhsUpper);
+            }
+        }
+        return lhs.size() < rhs.size();
+    }
+};
+
 struct CaseInsensitiveHash
 {
+    // Polynomial rather than a plain sum of characters, so that keys made of the same letters (e.g. "size" and
+    // "zise") don't all land in the same bucket.
     template <typename T>
     size_t operator()(T const& keyval) const noexcept
     {
-        return std::accumulate(
-            std::cbegin(keyval), std::cend(keyval), size_t{0}, [](size_t acc, auto c) { return acc + std::toupper(c); });
+        return std::accumulate(std::cbegin(keyval), std::cend(keyval), size_t{0}, [](size_t acc, auto c) {
+            return acc * 31 + std::toupper(c);
+        });
     }
 };
 
@@ -37,57 +66,151 @@ struct EnumHash
 
 namespace EnumHelpers
 {
-    // Manage mapping T<->std::string using two internal unordered_maps.
+    // Manage mapping T<->std::string using two tables that are sorted once when the mapping is built and binary
+    // searched from then on. Lookups don't allocate, and a string that doesn't map to a value is reported through
+    // tryFromString's empty optional rather than an exception.
     template <typename T>
     class EnumMapping
     {
     public:
         // Initialize with a single list -> automatically generate reverse mapping
-        EnumMapping(const std::initializer_list<std::pair<T, std::string>>& t) :
-            _enumToString{t.begin(), t.end()}, _stringToEnum(t.size())
-        {
-            _GenerateStringToEnumMap();
-        }
+        EnumMapping(const std::initializer_list<std::pair<T, std::string>>& t) : EnumMapping(t, {}) {}
 
         // Initialize with two lists -> t1 is our forward list and t2 contains additional terms to use in addition
         // to the generated reverse mapping
         EnumMapping(const std::initializer_list<std::pair<T, std::string>>& t1, const std::initializer_list<std::pair<std::string, T>>& t2) :
-            _enumToString{t1.begin(), t1.end()}, _stringToEnum(t2.begin(), t2.end())
+            _enumToString{t1.begin(), t1.end()}, _stringToEnum{t2.begin(), t2.end()}
         {
+            // when a value or string is listed more than once, the first entry wins
+            std::stable_sort(_enumToString.begin(), _enumToString.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.first < rhs.first;
+            });
+            _enumToString.erase(
+                std::unique(
+                    _enumToString.begin(),
+                    _enumToString.end(),
+                    [](const auto& lhs, const auto& rhs) { return lhs.first == rhs.first; }),
+                _enumToString.end());
+
+            // most enums are numbered 0..n-1, perhaps with a few unmapped values, in which case toString can index a
+            // table instead of searching _enumToString
+            if (!_enumToString.empty())
+            {
+                const auto maxValue = static_cast<size_t>(_enumToString.back().first);
+                if (static_cast<size_t>(_enumToString.front().first) <= maxValue && maxValue < 2 * _enumToString.size())
+                {
+                    _indexByValue.assign(maxValue + 1, _unmapped);
+                    for (size_t i = 0; i < _enumToString.size(); ++i)
+                    {
+                        _indexByValue[static_cast<size_t>(_enumToString[i].first)] = i;
+                    }
+                }
+            }
+
             _GenerateStringToEnumMap();
         }
 
         const std::string& toString(T t) const
         {
-            return _enumToString.at(t);
+            if (!_indexByValue.empty())
+            {
+                const auto value = static_cast<size_t>(t);
+                if (value >= _indexByValue.size() || _indexByValue[value] == _unmapped)
+                {
+                    throw std::out_of_range("Enum value has no string mapping");
+                }
+                return _enumToString[_indexByValue[value]].second;
+            }
+
+            const auto entry = std::lower_bound(
+                _enumToString.begin(), _enumToString.end(), t, [](const auto& lhs, T rhs) { return lhs.first < rhs; });
+            if (entry == _enumToString.end() || entry->first != t)
+            {
+                throw std::out_of_range("Enum value has no string mapping");
+            }
+            return entry->second;
+        }
+
+        // Whether toString has a string for the value
+        bool isMapped(T t) const noexcept
+        {
+            if (!_indexByValue.empty())
+            {
+                const auto value = static_cast<size_t>(t);
+                return value < _indexByValue.size() && _indexByValue[value] != _unmapped;
+            }
+            const auto entry = std::lower_bound(
+                _enumToString.begin(), _enumToString.end(), t, [](const auto& lhs, T rhs) { return lhs.first < rhs; });
+            return entry != _enumToString.end() && entry->first == t;
+        }
+
+        std::optional<T> tryFromString(const std::string& str) const noexcept
+        {
+            const auto entry = std::lower_bound(
+                _stringToEnum.begin(), _stringToEnum.end(), str, [](const auto& lhs, const std::string& rhs) {
+                    return CaseInsensitiveLess{}(lhs.first, rhs);
+                });
+            if (entry == _stringToEnum.end() || CaseInsensitiveLess{}(str, entry->first))
+            {
+                return std::nullopt;
+            }
+            return entry->second;
         }
+
         T fromString(const std::string& str) const
         {
-            return _stringToEnum.at(str);
+            const auto value = tryFromString(str);
+            if (!value.has_value())
+            {
+                throw std::out_of_range("String has no enum mapping");
+            }
+            return *value;
         }
 
+        // All mapped values and their primary strings, sorted by value
+        const std::vector<std::pair<T, std::string>>& entries() const noexcept { return _enumToString; }
+
     private:
         inline void _GenerateStringToEnumMap()
         {
             for (const auto& kv : _enumToString)
             {
-                _stringToEnum.emplace(kv.second, kv.first);
+                _stringToEnum.emplace_back(kv.second, kv.first);
             }
+
+            std::stable_sort(_stringToEnum.begin(), _stringToEnum.end(), [](const auto& lhs, const auto& rhs) {
+                return CaseInsensitiveLess{}(lhs.first, rhs.first);
+            });
+            _stringToEnum.erase(
+                std::unique(
+                    _stringToEnum.begin(),
+                    _stringToEnum.end(),
+                    [](const auto& lhs, const auto& rhs) { return !CaseInsensitiveLess{}(lhs.first, rhs.first); }),
+                _stringToEnum.end());
         }
 
-        const std::unordered_map<T, std::string, EnumHash> _enumToString;
-        std::unordered_map<std::string, T, CaseInsensitiveHash, CaseInsensitiveEqualTo> _stringToEnum;
+        std::vector<std::pair<T, std::string>> _enumToString;
+        std::vector<std::pair<std::string, T>> _stringToEnum;
+        // position in _enumToString of each value, or _unmapped; empty when the values are too sparse to index
+        std::vector<size_t> _indexByValue;
+        static constexpr size_t _unmapped = std::numeric_limits<size_t>::max();
     };
 } // namespace EnumHelpers
 
-// Provides forward declaration for EnumHelpers mapping accessor as well as global mapping functions.
+// Provides forward declaration for EnumHelpers mapping accessor as well as global mapping functions. getEnum is the
+// same accessor overloaded on the enum type, for templates.
 #define DECLARE_ADAPTIVECARD_ENUM(ENUMTYPE) \
     namespace EnumHelpers \
     { \
         const EnumMapping<ENUMTYPE>& get##ENUMTYPE##Enum(); \
+        inline const EnumMapping<ENUMTYPE>& getEnum(ENUMTYPE) \
+        { \
+            return get##ENUMTYPE##Enum(); \
+        } \
     } \
     const std::string& ENUMTYPE##ToString(const ENUMTYPE t); \
-    ENUMTYPE ENUMTYPE##FromString(const std::string& t);
+    ENUMTYPE ENUMTYPE##FromString(const std::string& t); \
+    std::optional<ENUMTYPE> ENUMTYPE##TryFromString(const std::string& t) noexcept;
 
 #define _DEFINE_ADAPTIVECARD_ENUM_INVARIANT(ENUMTYPE, ...) \
     namespace EnumHelpers \
@@ -103,18 +226,21 @@ namespace EnumHelpers
         return EnumHelpers::get##ENUMTYPE##Enum().toString(t); \
     }
 
-// Define mapping functions for ENUMTYPE. Throw an exception if caller passes in a string that doesn't map
+// Define mapping functions for ENUMTYPE. FromString throws an exception if caller passes in a string that doesn't
+// map; TryFromString returns an empty optional instead
 #define DEFINE_ADAPTIVECARD_ENUM(ENUMTYPE, ...) \
     _DEFINE_ADAPTIVECARD_ENUM_INVARIANT(ENUMTYPE, __VA_ARGS__); \
+    std::optional<ENUMTYPE> ENUMTYPE##TryFromString(const std::string& t) noexcept \
+    { \
+        return EnumHelpers::get##ENUMTYPE##Enum().tryFromString(t); \
+    } \
     ENUMTYPE ENUMTYPE##FromString(const std::string& t) \
     { \
-        try \
-        { \
-            return EnumHelpers::get##ENUMTYPE##Enum().fromString(t); \
-        } \
-        catch (const std::out_of_range&) \
+        const auto value = ENUMTYPE##TryFromString(t); \
+        if (!value.has_value()) \
         { \
             throw std::out_of_range("Invalid " #ENUMTYPE ": " + t); \
         } \
+        return *value; \
     }
 } // namespace AdaptiveCards
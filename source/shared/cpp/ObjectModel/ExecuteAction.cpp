@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "ParseUtil.h"
 #include "ExecuteAction.h"
+#include "Util.h"
 
 using namespace AdaptiveCards;
 
@@ -57,17 +58,17 @@ Json::Value ExecuteAction::SerializeToJsonValue() const
 
     if (!m_dataJson.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Data)] = m_dataJson;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Data)] = m_dataJson;
     }
 
     if (!m_verb.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Verb)] = m_verb;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Verb)] = m_verb;
     }
 
     if (m_associatedInputs != AssociatedInputs::Auto)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AssociatedInputs)] = AssociatedInputsToString(m_associatedInputs);
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::AssociatedInputs)] = AssociatedInputsToString(m_associatedInputs);
     }
 
     return root;
@@ -80,7 +81,7 @@ std::shared_ptr<BaseActionElement> ExecuteActionParser::Deserialize(ParseContext
     executeAction->SetDataJson(ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Data));
     executeAction->SetVerb(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Verb));
     executeAction->SetAssociatedInputs(ParseUtil::GetEnumValue<AssociatedInputs>(
-        json, AdaptiveCardSchemaKey::AssociatedInputs, AssociatedInputs::Auto, AssociatedInputsFromString));
+        json, AdaptiveCardSchemaKey::AssociatedInputs, AssociatedInputs::Auto, AssociatedInputsTryFromString));
 
     return executeAction;
 }
@@ -92,8 +93,10 @@ std::shared_ptr<BaseActionElement> ExecuteActionParser::DeserializeFromString(Pa
 
 void ExecuteAction::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Data),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Verb),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AssociatedInputs)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Data,
+         AdaptiveCardSchemaKey::Verb,
+         AdaptiveCardSchemaKey::AssociatedInputs});
+    m_knownProperties = &knownProperties;
 }
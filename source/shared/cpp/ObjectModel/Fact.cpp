@@ -26,7 +26,7 @@ std::shared_ptr<Fact> Fact::Deserialize(ParseContext& context, const Json::Value
             WarningStatusCode::RequiredPropertyMissing,
             "non-empty string has to be given for either title or value, none given"));
     }
-    auto fact = std::make_shared<Fact>(title, value);
+    auto fact = MakeSharedInArena<Fact>(context.GetArena(), title, value);
     fact->SetLanguage(context.GetLanguage());
 
     return fact;
@@ -45,8 +45,8 @@ std::string Fact::Serialize()
 Json::Value Fact::SerializeToJsonValue()
 {
     Json::Value root;
-    root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title)] = GetTitle();
-    root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value)] = GetValue();
+    root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Title)] = GetTitle();
+    root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Value)] = GetValue();
 
     return root;
 }
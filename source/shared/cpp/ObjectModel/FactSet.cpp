@@ -27,7 +27,7 @@ Json::Value FactSet::SerializeToJsonValue() const
 {
     Json::Value root = BaseCardElement::SerializeToJsonValue();
 
-    const std::string& factsPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Facts);
+    const Json::StaticString& factsPropertyName = AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Facts);
     root[factsPropertyName] = Json::Value(Json::arrayValue);
     for (const auto& fact : GetFacts())
     {
@@ -65,5 +65,8 @@ std::shared_ptr<BaseCardElement> FactSetParser::DeserializeFromString(ParseConte
 
 void FactSet::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Facts)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Facts});
+    m_knownProperties = &knownProperties;
 }
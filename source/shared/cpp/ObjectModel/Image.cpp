@@ -29,7 +29,7 @@ Json::Value Image::SerializeToJsonValue() const
             stringStream << m_pixelWidth;
 
             std::string widthString = stringStream.str() + pixelstring;
-            root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Width)] = widthString;
+            root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Width)] = widthString;
         }
         if (m_pixelHeight)
         {
@@ -37,43 +37,43 @@ Json::Value Image::SerializeToJsonValue() const
             stringStream << m_pixelHeight;
 
             std::string heightString = stringStream.str() + pixelstring;
-            root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height)] = heightString;
+            root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Height)] = heightString;
         }
     }
     else if (m_imageSize != ImageSize::None)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Size)] = ImageSizeToString(m_imageSize);
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Size)] = ImageSizeToString(m_imageSize);
     }
 
     if (m_imageStyle != ImageStyle::Default)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style)] = ImageStyleToString(m_imageStyle);
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Style)] = ImageStyleToString(m_imageStyle);
     }
 
     if (!m_url.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url)] = m_url;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Url)] = m_url;
     }
 
     if (!m_backgroundColor.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundColor)] = m_backgroundColor;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::BackgroundColor)] = m_backgroundColor;
     }
 
     if (m_hAlignment.has_value())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment)] =
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::HorizontalAlignment)] =
             HorizontalAlignmentToString(m_hAlignment.value_or(HorizontalAlignment::Left));
     }
 
     if (!m_altText.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AltText)] = m_altText;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::AltText)] = m_altText;
     }
 
     if (m_selectAction != nullptr)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction)] =
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::SelectAction)] =
             BaseCardElement::SerializeSelectAction(m_selectAction);
     }
 
@@ -187,10 +187,10 @@ std::shared_ptr<BaseCardElement> ImageParser::DeserializeWithoutCheckingType(Par
 
     image->SetUrl(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Url, true));
     image->SetBackgroundColor(ValidateColor(ParseUtil::GetString(json, AdaptiveCardSchemaKey::BackgroundColor), context.warnings));
-    image->SetImageStyle(ParseUtil::GetEnumValue<ImageStyle>(json, AdaptiveCardSchemaKey::Style, ImageStyle::Default, ImageStyleFromString));
+    image->SetImageStyle(ParseUtil::GetEnumValue<ImageStyle>(json, AdaptiveCardSchemaKey::Style, ImageStyle::Default, ImageStyleTryFromString));
     image->SetAltText(ParseUtil::GetString(json, AdaptiveCardSchemaKey::AltText));
     image->SetHorizontalAlignment(ParseUtil::GetOptionalEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentFromString));
+        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentTryFromString));
 
     const auto& widthDimension =
         ParseSizeForPixelSize(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Width), &context.warnings);
@@ -205,7 +205,7 @@ std::shared_ptr<BaseCardElement> ImageParser::DeserializeWithoutCheckingType(Par
     }
     else
     {
-        image->SetImageSize(ParseUtil::GetEnumValue<ImageSize>(json, AdaptiveCardSchemaKey::Size, ImageSize::None, ImageSizeFromString));
+        image->SetImageSize(ParseUtil::GetEnumValue<ImageSize>(json, AdaptiveCardSchemaKey::Size, ImageSize::None, ImageSizeTryFromString));
     }
 
     // Parse optional selectAction
@@ -215,16 +215,18 @@ std::shared_ptr<BaseCardElement> ImageParser::DeserializeWithoutCheckingType(Par
 
 void Image::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AltText),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundColor),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Size),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Width)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::AltText,
+         AdaptiveCardSchemaKey::BackgroundColor,
+         AdaptiveCardSchemaKey::Height,
+         AdaptiveCardSchemaKey::HorizontalAlignment,
+         AdaptiveCardSchemaKey::SelectAction,
+         AdaptiveCardSchemaKey::Size,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::Url,
+         AdaptiveCardSchemaKey::Width});
+    m_knownProperties = &knownProperties;
 }
 
 void Image::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "ImageSet.h"
+#include "ElementVisitor.h"
 #include "ParseUtil.h"
 #include "Image.h"
 #include "Util.h"
@@ -39,10 +40,10 @@ Json::Value ImageSet::SerializeToJsonValue() const
 
     if (m_imageSize != ImageSize::None)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ImageSize)] = ImageSizeToString(GetImageSize());
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::ImageSize)] = ImageSizeToString(GetImageSize());
     }
 
-    const std::string& itemsPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Images);
+    const Json::StaticString& itemsPropertyName = AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Images);
     root[itemsPropertyName] = Json::Value(Json::arrayValue);
     for (const auto& image : m_images)
     {
@@ -59,7 +60,7 @@ std::shared_ptr<BaseCardElement> ImageSetParser::Deserialize(ParseContext& conte
     auto imageSet = BaseCardElement::Deserialize<ImageSet>(context, value);
     // Get ImageSize
     imageSet->m_imageSize =
-        ParseUtil::GetEnumValue<ImageSize>(value, AdaptiveCardSchemaKey::ImageSize, ImageSize::None, ImageSizeFromString);
+        ParseUtil::GetEnumValue<ImageSize>(value, AdaptiveCardSchemaKey::ImageSize, ImageSize::None, ImageSizeTryFromString);
 
     // Parse Images
     auto images = ParseUtil::GetElementCollection<Image>(
@@ -80,17 +81,14 @@ std::shared_ptr<BaseCardElement> ImageSetParser::DeserializeFromString(ParseCont
 
 void ImageSet::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Images),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ImageSize)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Images,
+         AdaptiveCardSchemaKey::ImageSize});
+    m_knownProperties = &knownProperties;
 }
 
 void ImageSet::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
 {
-    auto images = GetImages();
-    for (auto image : images)
-    {
-        image->GetResourceInformation(resourceInfo);
-    }
-    return;
+    CollectResourceInformation(*this, resourceInfo);
 }
@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "Inline.h"
 #include "TextRun.h"
+#include "Util.h"
 
 using namespace AdaptiveCards;
 
@@ -11,11 +12,17 @@ Inline::Inline(InlineElementType type) : m_type(type)
     PopulateKnownPropertiesSet();
 }
 
+Inline::Inline()
+{
+    static const std::unordered_set<std::string> noKnownProperties;
+    m_knownProperties = &noKnownProperties;
+}
+
 Json::Value Inline::SerializeToJsonValue() const
 {
     Json::Value root = Json::Value();
 
-    root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = GetInlineTypeString();
+    root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Type)] = GetInlineTypeString();
 
     return root;
 }
@@ -53,5 +60,6 @@ std::shared_ptr<Inline> Inline::Deserialize(ParseContext& context, const Json::V
 
 void Inline::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties({}, {AdaptiveCardSchemaKey::Type});
+    m_knownProperties = &knownProperties;
 }
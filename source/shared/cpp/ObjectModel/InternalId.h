@@ -40,7 +40,8 @@ public:
     }
 
 private:
-    static unsigned int s_currentInternalId;
+    static std::atomic<unsigned int> s_lastInternalId;
+    static thread_local unsigned int s_currentInternalId;
     InternalId(const unsigned int id);
     unsigned int m_internalId;
 };
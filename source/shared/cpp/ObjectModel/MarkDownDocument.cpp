@@ -0,0 +1,156 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "MarkDownDocument.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+class DocumentBuilder final : public MarkDownVisitor
+{
+public:
+    DocumentBuilder(std::vector<MarkDownBlock>& blocks, std::vector<MarkDownRun>& runs) :
+        m_blocks(blocks), m_runs(runs), m_depth(0), m_isBlockOpen(false), m_boldCount(0), m_italicCount(0)
+    {
+    }
+
+    void StartParagraph() override { AddBlock(MarkDownBlockType::Paragraph); }
+    void EndParagraph() override { m_isBlockOpen = false; }
+
+    void StartList(bool isOrdered, std::string_view number) override
+    {
+        PopLists(m_depth);
+        m_lists.push_back(List{isOrdered ? std::string(number) : std::string(), 0, m_depth});
+    }
+
+    void EndList(bool) override { PopLists(m_depth); }
+
+    // an item nested in another without starting a list of its own starts an unordered one
+    void StartListItem() override
+    {
+        PopLists(m_depth + 1);
+        if (m_lists.empty() || m_lists.back().depth != m_depth)
+        {
+            m_lists.push_back(List{std::string(), 0, m_depth});
+        }
+        auto& list = m_lists.back();
+
+        AddBlock(list.start.empty() ? MarkDownBlockType::ListItem : MarkDownBlockType::OrderedListItem);
+        auto& item = m_blocks.back();
+        item.itemIndex = list.itemCount++;
+        item.listStart = list.start;
+        ++m_depth;
+    }
+
+    void EndListItem() override
+    {
+        m_depth -= (m_depth > 0) ? 1 : 0;
+        m_isBlockOpen = false;
+    }
+
+    void StartLink(std::string_view destination, std::string_view) override { m_links.emplace_back(destination); }
+
+    void EndLink() override
+    {
+        if (!m_links.empty())
+        {
+            m_links.pop_back();
+        }
+    }
+
+    // tags are matched in pairs, but needn't nest
+    void AddTag(MarkDownTag tag) override
+    {
+        switch (tag)
+        {
+        case MarkDownTag::OpenItalic:
+            ++m_italicCount;
+            break;
+        case MarkDownTag::OpenBold:
+            ++m_boldCount;
+            break;
+        case MarkDownTag::CloseItalic:
+            m_italicCount -= (m_italicCount > 0) ? 1 : 0;
+            break;
+        case MarkDownTag::CloseBold:
+            m_boldCount -= (m_boldCount > 0) ? 1 : 0;
+            break;
+        }
+    }
+
+    // text with the same formatting as the run before it in the block is added to that run
+    void AddText(std::string_view text) override
+    {
+        if (!m_isBlockOpen)
+        {
+            AddBlock(MarkDownBlockType::Paragraph);
+        }
+
+        const bool isBold = m_boldCount > 0;
+        const bool isItalic = m_italicCount > 0;
+        const bool isLink = !m_links.empty();
+        auto& block = m_blocks.back();
+        if (block.runCount != 0)
+        {
+            auto& last = m_runs.back();
+            if (last.isBold == isBold && last.isItalic == isItalic && last.isLink == isLink &&
+                (!isLink || last.linkDestination == m_links.back()))
+            {
+                last.text += text;
+                return;
+            }
+        }
+
+        m_runs.push_back(MarkDownRun{std::string(text), isBold, isItalic, isLink, isLink ? m_links.back() : std::string()});
+        ++block.runCount;
+    }
+
+private:
+    struct List
+    {
+        std::string start;
+        unsigned int itemCount;
+        unsigned int depth;
+    };
+
+    // ends the lists at depth or deeper
+    void PopLists(unsigned int depth)
+    {
+        while (!m_lists.empty() && m_lists.back().depth >= depth)
+        {
+            m_lists.pop_back();
+        }
+    }
+
+    void AddBlock(MarkDownBlockType type)
+    {
+        m_blocks.push_back(MarkDownBlock{type, m_depth, 0, std::string(), m_runs.size(), 0});
+        m_isBlockOpen = true;
+    }
+
+    std::vector<MarkDownBlock>& m_blocks;
+    std::vector<MarkDownRun>& m_runs;
+    std::vector<List> m_lists;
+    std::vector<std::string> m_links;
+    unsigned int m_depth;
+    bool m_isBlockOpen;
+    unsigned int m_boldCount;
+    unsigned int m_italicCount;
+};
+} // namespace
+
+MarkDownDocument::MarkDownDocument(const MarkDownScanner& scanner)
+{
+    DocumentBuilder builder(m_blocks, m_runs);
+    scanner.Visit(builder);
+}
+
+MarkDownDocument::MarkDownDocument(std::string_view plainText)
+{
+    if (!plainText.empty())
+    {
+        m_blocks.push_back(MarkDownBlock{MarkDownBlockType::Paragraph, 0, 0, std::string(), 0, 1});
+        m_runs.push_back(MarkDownRun{std::string(plainText), false, false, false, std::string()});
+    }
+}
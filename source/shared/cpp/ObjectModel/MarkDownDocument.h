@@ -0,0 +1,60 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "MarkDownScanner.h"
+
+namespace AdaptiveCards
+{
+enum class MarkDownBlockType
+{
+    Paragraph,
+    ListItem,
+    OrderedListItem
+};
+
+// A run of text with the same formatting throughout
+struct MarkDownRun
+{
+    std::string text;
+    bool isBold;
+    bool isItalic;
+    bool isLink;
+    // the destination of the link the run is the text of
+    std::string linkDestination;
+};
+
+struct MarkDownBlock
+{
+    MarkDownBlockType type;
+    // how many list items the block is nested in
+    unsigned int depth;
+    // list items: the index of the item in its list
+    unsigned int itemIndex;
+    // ordered list items: the number the list starts at, as written
+    std::string listStart;
+    // the runs of the block: GetRuns()[firstRun] up to GetRuns()[firstRun + runCount]
+    size_t firstRun;
+    size_t runCount;
+};
+
+// Markdown as a flat sequence of blocks (paragraphs and list items, in the order they're written, nested list items
+// following the item they're in) of runs of formatted text. It's built from the same scan, and with the same
+// structure, as the HTML MarkDownParser writes, so a renderer can build its text runs from it directly rather than by
+// parsing that HTML. Text is as written in the markdown, without escaping or entities.
+class MarkDownDocument
+{
+public:
+    explicit MarkDownDocument(const MarkDownScanner& scanner);
+    // text without markdown: a paragraph of it, if there's any
+    explicit MarkDownDocument(std::string_view plainText);
+
+    const std::vector<MarkDownBlock>& GetBlocks() const { return m_blocks; }
+    const std::vector<MarkDownRun>& GetRuns() const { return m_runs; }
+
+private:
+    std::vector<MarkDownBlock> m_blocks;
+    std::vector<MarkDownRun> m_runs;
+};
+} // namespace AdaptiveCards
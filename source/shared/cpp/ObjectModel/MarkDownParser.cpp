@@ -2,13 +2,16 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include <vector>
-#include <iomanip>
-#include <iostream>
 #include "MarkDownParser.h"
 
 using namespace AdaptiveCards;
 
-MarkDownParser::MarkDownParser(const std::string& txt) : m_text(txt), m_hasHTMLTag(false), m_isEscaped(false)
+MarkDownParser::MarkDownParser(const std::string& txt) : MarkDownParser(txt, TextFeatures::Classify(txt))
+{
+}
+
+MarkDownParser::MarkDownParser(const std::string& txt, const TextFeatures& features) :
+    m_text(txt), m_textFeatures(features), m_hasHTMLTag(false), m_isEscaped(features.hasHtmlCharacters)
 {
 }
 
@@ -19,18 +22,34 @@ std::string MarkDownParser::TransformToHtml()
     {
         return "<p></p>";
     }
-    // begin parsing html blocks
-    ParseBlock();
 
-    // process further what is parsed before outputting
-    // html string
-    m_parsedResult.Translate();
+    // text without markdown is a paragraph of it, escaped as it's written
+    std::string html;
+    if (!m_textFeatures.mayHaveMarkDown)
+    {
+        html.reserve(m_text.size() + 7);
+        html += "<p>";
+        MarkDownScanner::WriteEscapedText(m_text, html);
+        html += "</p>";
+        return html;
+    }
+
+    const MarkDownScanner scanner(m_text);
+    m_hasHTMLTag = scanner.HasHtmlTags();
+    scanner.WriteHtml(html);
+    return html;
+}
 
-    // add block tags such as <p> <ul>
-    m_parsedResult.AddBlockTags();
+MarkDownDocument MarkDownParser::TransformToDocument()
+{
+    if (!m_textFeatures.mayHaveMarkDown)
+    {
+        return MarkDownDocument(m_text);
+    }
 
-    m_hasHTMLTag = m_parsedResult.HasHtmlTags();
-    return m_parsedResult.GenerateHtmlString();
+    const MarkDownScanner scanner(m_text);
+    m_hasHTMLTag = scanner.HasHtmlTags();
+    return MarkDownDocument(scanner);
 }
 
 bool MarkDownParser::HasHtmlTags()
@@ -47,48 +66,3 @@ std::string MarkDownParser::GetRawText() const
 {
     return m_text;
 }
-
-// MarkDown is consisted of Blocks, this methods parses blocks
-void MarkDownParser::ParseBlock()
-{
-    std::stringstream stream(EscapeText());
-    EmphasisParser parser;
-    while (!stream.eof())
-    {
-        parser.ParseBlock(stream);
-    }
-    m_parsedResult.AppendParseResult(parser.GetParsedResult());
-}
-
-std::string MarkDownParser::EscapeText()
-{
-    std::string escaped;
-    unsigned int nonEscapedCounts = 0;
-
-    for (std::string::size_type i = 0; i < m_text.length(); i++)
-    {
-        switch (m_text.at(i))
-        {
-        case '<':
-            escaped += "&lt;";
-            break;
-        case '>':
-            escaped += "&gt;";
-            break;
-        case '"':
-            escaped += "&quot;";
-            break;
-        case '&':
-            escaped += "&amp;";
-            break;
-        default:
-            escaped += m_text.at(i);
-            nonEscapedCounts++;
-            break;
-        }
-    }
-
-    m_isEscaped = (nonEscapedCounts != m_text.length());
-
-    return escaped;
-}
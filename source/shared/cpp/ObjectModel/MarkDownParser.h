@@ -4,9 +4,8 @@
 
 #include "pch.h"
 #include "BaseCardElement.h"
-#include "MarkDownParsedResult.h"
-#include "MarkDownBlockParser.h"
-#include "MarkDownHtmlGenerator.h"
+#include "MarkDownDocument.h"
+#include "TextFeatures.h"
 
 namespace AdaptiveCards
 {
@@ -14,9 +13,15 @@ class MarkDownParser
 {
 public:
     MarkDownParser(const std::string& txt);
+    // features are those of txt, as classified when it was parsed
+    MarkDownParser(const std::string& txt, const TextFeatures& features);
 
     std::string TransformToHtml();
 
+    // The markdown as blocks of formatted runs of text, for a renderer to build its text runs from rather than from the
+    // HTML. Scans the text just as TransformToHtml does.
+    MarkDownDocument TransformToDocument();
+
     std::string GetRawText() const;
 
     bool HasHtmlTags();
@@ -24,10 +29,8 @@ public:
     bool IsEscaped() const;
 
 private:
-    void ParseBlock();
-    std::string EscapeText();
     std::string m_text;
-    MarkDownParsedResult m_parsedResult;
+    TextFeatures m_textFeatures;
     bool m_hasHTMLTag;
     bool m_isEscaped;
 };
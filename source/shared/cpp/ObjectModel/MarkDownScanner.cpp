@@ -0,0 +1,1170 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "MarkDownScanner.h"
+#include <array>
+
+using namespace AdaptiveCards;
+
+namespace
+{
+constexpr std::uint32_t c_none = std::numeric_limits<std::uint32_t>::max();
+
+enum class LookBehind
+{
+    Init,
+    Alphanumeric,
+    Punctuation,
+    Escape,
+    WhiteSpace
+};
+
+enum class BlockType
+{
+    Container,
+    UnorderedList,
+    OrderedList
+};
+
+bool IsSpace(const int ch)
+{
+    return (ch > 0) && isspace(ch);
+}
+
+bool IsPunct(const int ch)
+{
+    return (ch > 0) && ispunct(ch);
+}
+
+// extended (UTF-8) characters are treated as alphanumeric
+bool IsAlnum(const int ch)
+{
+    return (ch > 0x07F || isalnum(ch));
+}
+
+bool IsCntrl(const int ch)
+{
+    return (ch > 0) && iscntrl(ch);
+}
+
+bool IsDigit(const int ch)
+{
+    return (ch > 0) && isdigit(ch);
+}
+
+constexpr bool IsNewLine(const int ch)
+{
+    return (ch == '\r') || (ch == '\n');
+}
+
+constexpr bool IsListMarker(const int ch)
+{
+    return (ch == '-') || (ch == '+') || (ch == '*');
+}
+
+// the characters that end a run of text and emphasis, to be scanned as blocks of their own
+constexpr bool IsKeyword(const int ch)
+{
+    return (ch == '[' || ch == ']' || ch == ')' || ch == '\n' || ch == '\r');
+}
+
+// the characters that text is scanned one at a time around: key words, emphasis delimiters and the escape character
+constexpr std::array<bool, 256> c_isTextBoundary = []() {
+    std::array<bool, 256> isBoundary{};
+    for (const unsigned char ch : {'[', ']', ')', '\n', '\r', '*', '_', '\\'})
+    {
+        isBoundary[ch] = true;
+    }
+    return isBoundary;
+}();
+
+BlockType GetBlockType(MarkDownTokenKind kind)
+{
+    switch (kind)
+    {
+    case MarkDownTokenKind::ListItem:
+        return BlockType::UnorderedList;
+    case MarkDownTokenKind::OrderedListItem:
+        return BlockType::OrderedList;
+    default:
+        return BlockType::Container;
+    }
+}
+
+// Left emphasis is only ever used to open emphasis, and right emphasis writes closing tags even once it's used to open
+bool IsLeftEmphasis(const MarkDownToken& token)
+{
+    return token.emphasisKind == MarkDownEmphasisKind::Left || token.isLeft;
+}
+
+bool IsRightEmphasis(const MarkDownToken& token)
+{
+    return token.emphasisKind != MarkDownEmphasisKind::Left && !token.isLeft;
+}
+
+// Following the rules of CommonMark (http://spec.commonmark.org/0.27/) #9 and #10, the delimiter counts of emphasis that
+// can both open and close can't add up to a multiple of 3
+bool IsMatch(const MarkDownToken& left, const MarkDownToken& right)
+{
+    if (left.delimiter == right.delimiter)
+    {
+        return !((left.emphasisKind == MarkDownEmphasisKind::LeftAndRight || right.emphasisKind == MarkDownEmphasisKind::LeftAndRight) &&
+                 (((left.unusedDelimiters + right.unusedDelimiters) % 3) == 0));
+    }
+    return false;
+}
+
+// Writes HTML, escaping text unless it's told otherwise (to write a link's destination as it was scanned)
+class HtmlWriter final : public MarkDownVisitor
+{
+public:
+    HtmlWriter(std::string& output, bool isEscaped) : m_output(output), m_isEscaped(isEscaped) {}
+
+    void StartParagraph() override { m_output += "<p>"; }
+    void EndParagraph() override { m_output += "</p>"; }
+
+    void StartList(bool isOrdered, std::string_view number) override
+    {
+        if (isOrdered)
+        {
+            m_output += "<ol start=\"";
+            m_output += number;
+            m_output += "\">";
+        }
+        else
+        {
+            m_output += "<ul>";
+        }
+    }
+
+    void EndList(bool isOrdered) override { m_output += isOrdered ? "</ol>" : "</ul>"; }
+    void StartListItem() override { m_output += "<li>"; }
+    void EndListItem() override { m_output += "</li>"; }
+
+    void StartLink(std::string_view destination, std::string_view destinationHtml) override
+    {
+        m_output += "<a href=\"";
+        m_output += m_isEscaped ? destinationHtml : destination;
+        m_output += "\">";
+    }
+
+    void EndLink() override { m_output += "</a>"; }
+
+    void AddTag(MarkDownTag tag) override
+    {
+        switch (tag)
+        {
+        case MarkDownTag::OpenItalic:
+            m_output += "<em>";
+            break;
+        case MarkDownTag::OpenBold:
+            m_output += "<strong>";
+            break;
+        case MarkDownTag::CloseItalic:
+            m_output += "</em>";
+            break;
+        case MarkDownTag::CloseBold:
+            m_output += "</strong>";
+            break;
+        }
+    }
+
+    void AddText(std::string_view text) override
+    {
+        if (!m_isEscaped)
+        {
+            m_output += text;
+            return;
+        }
+
+        MarkDownScanner::WriteEscapedText(text, m_output);
+    }
+
+private:
+    std::string& m_output;
+    bool m_isEscaped;
+};
+} // namespace
+
+// The state of scanning a run of text and emphasis
+struct MarkDownScanner::EmphasisRun
+{
+    bool isEmphasis = false;
+    bool isCaptured = false;
+    bool checkLookAhead = false;
+    bool checkIntraWord = false;
+    LookBehind lookBehind = LookBehind::Init;
+    std::uint32_t delimiterCount = 0;
+    // '*' or '_', once a delimiter is met
+    char delimiter = '\0';
+    // where the text of the token being collected starts in m_tokenText
+    size_t tokenStart = 0;
+
+    bool IsDelimiter(const int ch) const { return (ch == '*' || ch == '_') && (lookBehind != LookBehind::Escape); }
+
+    void UpdateRunState(char emphasisDelimiter)
+    {
+        if (lookBehind != LookBehind::WhiteSpace)
+        {
+            checkLookAhead = (lookBehind == LookBehind::Punctuation);
+            checkIntraWord = (lookBehind == LookBehind::Alphanumeric && emphasisDelimiter == '_');
+        }
+        ++delimiterCount;
+        delimiter = emphasisDelimiter;
+    }
+
+    void UpdateLookBehind(const int ch)
+    {
+        if (IsAlnum(ch))
+        {
+            lookBehind = LookBehind::Alphanumeric;
+        }
+        else if (IsSpace(ch))
+        {
+            lookBehind = LookBehind::WhiteSpace;
+        }
+        else if (IsPunct(ch))
+        {
+            lookBehind = (ch == '\\') ? LookBehind::Escape : LookBehind::Punctuation;
+        }
+    }
+
+    bool IsLeftDelimiter(const int ch) const
+    {
+        if (delimiterCount && ch != EOF)
+        {
+            return !IsSpace(ch) && !(lookBehind == LookBehind::Alphanumeric && IsPunct(ch)) &&
+                   !(lookBehind == LookBehind::Alphanumeric && delimiter == '_');
+        }
+        return false;
+    }
+
+    bool IsRightDelimiter(const int ch) const
+    {
+        if ((ch == EOF || IsSpace(ch)) && (lookBehind != LookBehind::WhiteSpace) &&
+            (checkLookAhead || checkIntraWord || delimiter == '*'))
+        {
+            return true;
+        }
+
+        if (IsAlnum(ch) && lookBehind != LookBehind::WhiteSpace && lookBehind != LookBehind::Init)
+        {
+            return !checkLookAhead && !checkIntraWord;
+        }
+
+        return IsPunct(ch) && lookBehind != LookBehind::WhiteSpace;
+    }
+};
+
+MarkDownScanner::MarkDownScanner(std::string_view text) :
+    m_text(text), m_position(0), m_isAtEnd(false), m_hasFailed(false), m_scope{c_none, 0}, m_hasHtmlTags(false)
+{
+    m_tokenText.reserve(text.size());
+    m_tokens.reserve(text.size() / 8 + 4);
+
+    bool isCaptured = false;
+    while (!m_isAtEnd)
+    {
+        ParseBlock(isCaptured);
+    }
+
+    m_hasHtmlTags = MatchEmphasisTokens(0) || m_hasHtmlTags;
+    m_emphasis.clear();
+
+    if (!m_tokens.empty())
+    {
+        m_tokens.front().isHead = true;
+        m_tokens[m_scope.last].isTail = true;
+    }
+}
+
+std::string_view MarkDownScanner::GetText(const MarkDownToken& token) const
+{
+    return std::string_view(m_tokenText).substr(token.offset, token.length);
+}
+
+void MarkDownScanner::WriteEscapedText(std::string_view text, std::string& output)
+{
+    size_t written = 0;
+    for (auto escape = text.find_first_of("<>\"&"); escape != std::string_view::npos;
+         escape = text.find_first_of("<>\"&", written))
+    {
+        output.append(text.data() + written, escape - written);
+        switch (text[escape])
+        {
+        case '<':
+            output += "&lt;";
+            break;
+        case '>':
+            output += "&gt;";
+            break;
+        case '"':
+            output += "&quot;";
+            break;
+        default:
+            output += "&amp;";
+            break;
+        }
+        written = escape + 1;
+    }
+    output.append(text.data() + written, text.size() - written);
+}
+
+void MarkDownScanner::Visit(MarkDownVisitor& visitor) const
+{
+    Visit(0, static_cast<std::uint32_t>(m_tokens.size()), visitor);
+}
+
+void MarkDownScanner::WriteHtml(std::string& output) const
+{
+    output.reserve(output.size() + m_tokenText.size() + m_tokens.size() * 4 + 8);
+    HtmlWriter writer(output, true);
+    Visit(writer);
+}
+
+int MarkDownScanner::Peek()
+{
+    if (m_isAtEnd || m_hasFailed)
+    {
+        m_hasFailed = true;
+        return EOF;
+    }
+    if (m_position == m_text.size())
+    {
+        m_isAtEnd = true;
+        return EOF;
+    }
+    return static_cast<unsigned char>(m_text[m_position]);
+}
+
+int MarkDownScanner::Get()
+{
+    if (m_isAtEnd || m_hasFailed || m_position == m_text.size())
+    {
+        m_isAtEnd = m_isAtEnd || m_position == m_text.size();
+        m_hasFailed = true;
+        return EOF;
+    }
+    return static_cast<unsigned char>(m_text[m_position++]);
+}
+
+// Leaves ch as it is when there's nothing to get
+void MarkDownScanner::Get(char& ch)
+{
+    const int got = Get();
+    if (got != EOF)
+    {
+        ch = static_cast<char>(got);
+    }
+}
+
+void MarkDownScanner::Unget()
+{
+    m_isAtEnd = false;
+    if (!m_hasFailed && m_position > 0)
+    {
+        --m_position;
+    }
+}
+
+std::ptrdiff_t MarkDownScanner::Tellg()
+{
+    if (m_isAtEnd || m_hasFailed)
+    {
+        m_hasFailed = true;
+        return -1;
+    }
+    return static_cast<std::ptrdiff_t>(m_position);
+}
+
+void MarkDownScanner::Seekg(size_t position)
+{
+    m_isAtEnd = false;
+    m_hasFailed = false;
+    m_position = position;
+}
+
+// Parses according to each key word
+void MarkDownScanner::ParseBlock(bool& isCaptured)
+{
+    switch (Peek())
+    {
+    case '[':
+        isCaptured = ParseLink();
+        break;
+    // handles ] and ) that aren't part of a link
+    case ']':
+    case ')':
+        AddCharacter(MarkDownTokenKind::Text, static_cast<char>(Get()));
+        break;
+    case '\n':
+    case '\r':
+        AddCharacter(MarkDownTokenKind::NewLine, static_cast<char>(Get()));
+        break;
+    case '-':
+    case '+':
+    case '*':
+        isCaptured = ParseList();
+        break;
+    case '0':
+    case '1':
+    case '2':
+    case '3':
+    case '4':
+    case '5':
+    case '6':
+    case '7':
+    case '8':
+    case '9':
+        isCaptured = ParseOrderedList();
+        break;
+    // everything else is treated as normal text + emphasis
+    default:
+        ParseTextAndEmphasis();
+        isCaptured = false;
+    }
+}
+
+// A link is in the form of [text](destination). Its text is scanned as tokens of the block it's in until the link is
+// complete, so that if it isn't, they're simply left there. Returns whether a link was captured, in this link or the
+// last of those nested in its text.
+bool MarkDownScanner::ParseLink()
+{
+    const auto linkIndex = AddCharacter(MarkDownTokenKind::Text, static_cast<char>(Get()));
+    const size_t emphasisStart = m_emphasis.size();
+
+    // the text, parsed recursively up to the first ']', or the first link captured in it
+    bool isCaptured = false;
+    if (Peek() != ']')
+    {
+        bool isBlockCaptured = false;
+        while (Peek() != EOF && Peek() != ']')
+        {
+            ParseBlock(isBlockCaptured);
+            isCaptured = isBlockCaptured;
+            if (isCaptured)
+            {
+                break;
+            }
+        }
+
+        if (Peek() != ']')
+        {
+            return isCaptured;
+        }
+    }
+    AddCharacter(MarkDownTokenKind::Text, static_cast<char>(Get()));
+
+    if (Peek() != '(')
+    {
+        return isCaptured;
+    }
+    AddCharacter(MarkDownTokenKind::Text, static_cast<char>(Get()));
+
+    // handles [xx](
+    if (Peek() < 0)
+    {
+        return isCaptured;
+    }
+
+    // the destination ends at the ')' that balances the '(': e.g. ([ab()c])()()() ends at 7
+    const auto initialPosition = Tellg();
+    auto currentPosition = initialPosition;
+    std::ptrdiff_t destinationEnd = 0;
+    int leftParenthesisCount = 1;
+    while (Peek() != EOF && leftParenthesisCount > 0)
+    {
+        char ch{};
+        Get(ch);
+        if (ch == '(')
+        {
+            ++leftParenthesisCount;
+        }
+        else if (ch == ')')
+        {
+            --leftParenthesisCount;
+        }
+
+        if (leftParenthesisCount == 0)
+        {
+            destinationEnd = currentPosition;
+        }
+        ++currentPosition;
+    }
+    Seekg(static_cast<size_t>(initialPosition));
+
+    if (!destinationEnd || IsCntrl(Peek()) || (Peek() > 0 && (IsSpace(Peek()) || IsCntrl(Peek()))))
+    {
+        return isCaptured;
+    }
+
+    // the destination is scanned as a block of its own, and written as it is (its emphasis isn't matched)
+    const Scope textScope = m_scope;
+    const auto destinationStart = static_cast<std::uint32_t>(m_tokens.size());
+    m_scope = Scope{c_none, m_emphasis.size()};
+
+    bool isDestinationCaptured = false;
+    auto position = Tellg();
+    while (position < destinationEnd && Peek() != EOF)
+    {
+        // a '[' in the destination doesn't start a link
+        if (Peek() == '[')
+        {
+            char ch{};
+            Get(ch);
+            AddCharacter(MarkDownTokenKind::Text, ch);
+        }
+        else
+        {
+            ParseBlock(isDestinationCaptured);
+        }
+        position = Tellg();
+    }
+
+    if (Peek() == ')')
+    {
+        Get();
+    }
+
+    // kept both as scanned and as HTML
+    m_scratch.clear();
+    HtmlWriter destinationWriter(m_scratch, false);
+    Visit(destinationStart, static_cast<std::uint32_t>(m_tokens.size()), destinationWriter);
+    const size_t destinationLength = m_scratch.size();
+    HtmlWriter destinationHtmlWriter(m_scratch, true);
+    Visit(destinationStart, static_cast<std::uint32_t>(m_tokens.size()), destinationHtmlWriter);
+    m_tokens.resize(destinationStart);
+    m_emphasis.resize(m_scope.emphasisStart);
+    m_scope = textScope;
+
+    // ']' and '(' aren't written, and emphasis in the text is matched within it
+    PopToken();
+    PopToken();
+    MatchEmphasisTokens(emphasisStart);
+    m_emphasis.resize(emphasisStart);
+
+    auto& link = m_tokens[linkIndex];
+    link.kind = MarkDownTokenKind::Link;
+    link.isTail = false;
+    link.offset = static_cast<std::uint32_t>(m_tokenText.size());
+    link.length = static_cast<std::uint32_t>(destinationLength);
+    link.destinationHtmlLength = static_cast<std::uint32_t>(m_scratch.size() - destinationLength);
+    link.end = static_cast<std::uint32_t>(m_tokens.size());
+    m_tokenText += m_scratch;
+    m_scope.last = linkIndex;
+
+    m_hasHtmlTags = true;
+    return true;
+}
+
+// list marker has a form of ^-\s+ or [\r, \n]-\s+, and this method checks the syntax
+bool MarkDownScanner::ParseList()
+{
+    const int ch = Get();
+    bool isCaptured = false;
+    if (CompleteListParsing(MarkDownTokenKind::ListItem, 0, 0, isCaptured))
+    {
+        return isCaptured;
+    }
+
+    if (ch == '*')
+    {
+        // not a list, but it may be emphasis
+        Unget();
+        ParseTextAndEmphasis();
+    }
+    else
+    {
+        AddCharacter(MarkDownTokenKind::Text, static_cast<char>(ch));
+    }
+    return false;
+}
+
+// ordered list marker has form of ^\d+\.\s* or [\r,\n]\d+\.\s*, and this method checks the syntax
+bool MarkDownScanner::ParseOrderedList()
+{
+    const auto numberOffset = static_cast<std::uint32_t>(m_tokenText.size());
+    do
+    {
+        char ch{};
+        Get(ch);
+        m_tokenText += ch;
+    } while (IsDigit(Peek()));
+    auto numberLength = static_cast<std::uint32_t>(m_tokenText.size() - numberOffset);
+
+    if (Peek() == '.')
+    {
+        Get();
+        bool isCaptured = false;
+        if (CompleteListParsing(MarkDownTokenKind::OrderedListItem, numberOffset, numberLength, isCaptured))
+        {
+            return isCaptured;
+        }
+
+        m_tokenText += '.';
+        ++numberLength;
+    }
+
+    // if incorrect syntax, capture as a new token
+    AddToken(MarkDownTokenKind::Text, numberOffset, numberLength);
+    return false;
+}
+
+// Scans the item of a list once its marker is matched, if it's followed by a space: its content is the blocks that follow
+// up to the start of a new list item or block
+bool MarkDownScanner::CompleteListParsing(MarkDownTokenKind kind, std::uint32_t numberOffset, std::uint32_t numberLength, bool& isCaptured)
+{
+    if (Peek() != ' ')
+    {
+        return false;
+    }
+
+    // at this point, syntax check is complete, thus any other spaces are ignored
+    do
+    {
+        Get();
+    } while (Peek() == ' ');
+
+    const auto itemIndex = AddToken(kind, numberOffset, numberLength);
+    const Scope listScope = m_scope;
+    m_scope = Scope{c_none, m_emphasis.size()};
+
+    ParseBlock(isCaptured);
+    ParseSubBlocks(isCaptured);
+
+    MatchEmphasisTokens(m_scope.emphasisStart);
+    m_emphasis.resize(m_scope.emphasisStart);
+    m_scope = listScope;
+    m_tokens[itemIndex].end = static_cast<std::uint32_t>(m_tokens.size());
+
+    m_hasHtmlTags = true;
+    return true;
+}
+
+// parse blocks of a list item: if what's met is the start of a new list, list item, or new block, it isn't part of the
+// item, and is left to the caller
+void MarkDownScanner::ParseSubBlocks(bool& isCaptured)
+{
+    while (!m_isAtEnd)
+    {
+        if (IsNewLine(Peek()))
+        {
+            char newLine{};
+            Get(newLine);
+            if (IsDigit(Peek()))
+            {
+                const size_t numberOffset = m_tokenText.size();
+                if (MatchNewOrderedListItem())
+                {
+                    m_tokenText.resize(numberOffset);
+                    break;
+                }
+                AddToken(MarkDownTokenKind::Text, numberOffset, m_tokenText.size() - numberOffset);
+            }
+            else if (MatchNewListItem() || MatchNewBlock())
+            {
+                break;
+            }
+
+            AddCharacter(MarkDownTokenKind::Text, newLine);
+        }
+        ParseBlock(isCaptured);
+    }
+}
+
+// this method matches - of -\s
+bool MarkDownScanner::MatchNewListItem()
+{
+    if (IsListMarker(Peek()))
+    {
+        Get();
+        const bool isListItem = (Peek() == ' ');
+        Unget();
+        return isListItem;
+    }
+    return false;
+}
+
+// if lines are separated by more than two new lines, they are new block items. Called once a new line is matched.
+bool MarkDownScanner::MatchNewBlock()
+{
+    if (IsNewLine(Peek()))
+    {
+        do
+        {
+            Get();
+        } while (IsNewLine(Peek()));
+
+        return true;
+    }
+    return false;
+}
+
+// this method matches \d+\. leaving the digits in m_tokenText, and then steps back one character
+bool MarkDownScanner::MatchNewOrderedListItem()
+{
+    do
+    {
+        char ch{};
+        Get(ch);
+        m_tokenText += ch;
+    } while (IsDigit(Peek()));
+
+    if (Peek() == '.')
+    {
+        Unget();
+        return true;
+    }
+    return false;
+}
+
+// Text and emphasis are scanned until a key word is met. The scan switches between two states, text and emphasis, and
+// at each switch a token is captured.
+void MarkDownScanner::ParseTextAndEmphasis()
+{
+    EmphasisRun run;
+    run.tokenStart = m_tokenText.size();
+    while (!run.isCaptured)
+    {
+        run.isEmphasis = run.isEmphasis ? MatchEmphasis(run) : MatchText(run);
+    }
+}
+
+// captures text until an emphasis character is met, then switches to the emphasis state
+bool MarkDownScanner::MatchText(EmphasisRun& run)
+{
+    const int currentChar = Peek();
+    const bool isKeyword = IsKeyword(currentChar);
+
+    if (m_isAtEnd || (run.lookBehind != LookBehind::Escape && isKeyword))
+    {
+        Flush(run, currentChar, false);
+        return false;
+    }
+
+    if (run.IsDelimiter(currentChar))
+    {
+        // encountered first emphasis delimiter
+        CaptureText(run);
+        // the character before it decides what the delimiter can be used for
+        if (Tellg())
+        {
+            Unget();
+            run.UpdateLookBehind(Get());
+        }
+
+        run.UpdateRunState(static_cast<char>(currentChar));
+        char ch{};
+        Get(ch);
+        m_tokenText += ch;
+        return true;
+    }
+
+    if (isKeyword && run.lookBehind == LookBehind::Escape && m_tokenText.size() > run.tokenStart)
+    {
+        // remove the escape character
+        m_tokenText.pop_back();
+    }
+
+    run.UpdateLookBehind(currentChar);
+    char ch{};
+    Get(ch);
+    m_tokenText += ch;
+
+    // the text up to the next character that can change the state is taken whole, as it would be one at a time
+    auto plainEnd = m_position;
+    while (plainEnd < m_text.size() && !c_isTextBoundary[static_cast<unsigned char>(m_text[plainEnd])])
+    {
+        ++plainEnd;
+    }
+    if (plainEnd != m_position)
+    {
+        for (auto i = plainEnd; i > m_position; --i)
+        {
+            const int plainChar = static_cast<unsigned char>(m_text[i - 1]);
+            if (IsAlnum(plainChar) || IsSpace(plainChar) || IsPunct(plainChar))
+            {
+                run.UpdateLookBehind(plainChar);
+                break;
+            }
+        }
+        m_tokenText.append(m_text.data() + m_position, plainEnd - m_position);
+        m_position = plainEnd;
+    }
+    return false;
+}
+
+// captures emphasis delimiters until another character is met, then switches to the text state
+bool MarkDownScanner::MatchEmphasis(EmphasisRun& run)
+{
+    const int currentChar = Peek();
+    if (IsKeyword(currentChar) || m_isAtEnd)
+    {
+        Flush(run, currentChar, true);
+        return true;
+    }
+
+    if (run.IsDelimiter(currentChar))
+    {
+        // a delimiter of the other kind is part of the token, but not of the run
+        if (run.delimiter == currentChar)
+        {
+            run.UpdateRunState(static_cast<char>(currentChar));
+        }
+
+        char ch{};
+        Get(ch);
+        m_tokenText += ch;
+        return true;
+    }
+
+    // the delimiter run has ended
+    CaptureEmphasis(run, currentChar);
+    if (currentChar == '\\')
+    {
+        // skips escape char
+        Get();
+    }
+
+    run.delimiterCount = 0;
+    run.UpdateLookBehind(Peek());
+    char ch{};
+    Get(ch);
+    m_tokenText += ch;
+    return false;
+}
+
+// Captures what's left of the token being collected, and ends the run
+void MarkDownScanner::Flush(EmphasisRun& run, int ch, bool isEmphasis)
+{
+    if (isEmphasis)
+    {
+        CaptureEmphasis(run, ch);
+        run.delimiterCount = 0;
+    }
+    else
+    {
+        CaptureText(run);
+    }
+    run.tokenStart = m_tokenText.size();
+    run.isCaptured = true;
+}
+
+void MarkDownScanner::CaptureText(EmphasisRun& run)
+{
+    if (m_tokenText.size() > run.tokenStart)
+    {
+        AddToken(MarkDownTokenKind::Text, run.tokenStart, m_tokenText.size() - run.tokenStart);
+        run.tokenStart = m_tokenText.size();
+    }
+}
+
+// Captures the delimiter run as emphasis, decided by the character after it; when it can't be used as emphasis, it's text
+void MarkDownScanner::CaptureEmphasis(EmphasisRun& run, int ch)
+{
+    if (run.IsRightDelimiter(ch))
+    {
+        // right emphasis can be also left emphasis
+        AddEmphasis(run, run.IsLeftDelimiter(ch) ? MarkDownEmphasisKind::LeftAndRight : MarkDownEmphasisKind::Right);
+    }
+    else if (run.IsLeftDelimiter(ch))
+    {
+        AddEmphasis(run, MarkDownEmphasisKind::Left);
+    }
+    else
+    {
+        CaptureText(run);
+    }
+}
+
+void MarkDownScanner::AddEmphasis(EmphasisRun& run, MarkDownEmphasisKind kind)
+{
+    const auto index = AddToken(MarkDownTokenKind::Emphasis, run.tokenStart, m_tokenText.size() - run.tokenStart);
+    auto& token = m_tokens[index];
+    token.emphasisKind = kind;
+    token.delimiter = run.delimiter;
+    token.unusedDelimiters = run.delimiterCount;
+    m_emphasis.push_back(index);
+    run.tokenStart = m_tokenText.size();
+}
+
+// Adds a token to the block being scanned. A token that starts a block of another type (a list item after text, or
+// text after a list item) closes the block before it, along with the new line that ends that block.
+std::uint32_t MarkDownScanner::AddToken(MarkDownTokenKind kind, size_t offset, size_t length)
+{
+    MarkDownToken token{};
+    token.kind = kind;
+    token.offset = static_cast<std::uint32_t>(offset);
+    token.length = static_cast<std::uint32_t>(length);
+    token.firstTag = c_none;
+    token.lastTag = c_none;
+
+    if (m_scope.last != c_none && GetBlockType(m_tokens[m_scope.last].kind) != GetBlockType(kind))
+    {
+        if (m_tokens[m_scope.last].kind == MarkDownTokenKind::NewLine)
+        {
+            PopToken();
+        }
+
+        if (m_scope.last != c_none)
+        {
+            m_tokens[m_scope.last].isTail = true;
+        }
+        token.isHead = true;
+    }
+
+    token.previous = m_scope.last;
+    m_scope.last = static_cast<std::uint32_t>(m_tokens.size());
+    m_tokens.push_back(token);
+    return m_scope.last;
+}
+
+std::uint32_t MarkDownScanner::AddCharacter(MarkDownTokenKind kind, char ch)
+{
+    m_tokenText += ch;
+    return AddToken(kind, m_tokenText.size() - 1, 1);
+}
+
+// Removes the last token of the block being scanned, which is the last token scanned
+void MarkDownScanner::PopToken()
+{
+    m_scope.last = m_tokens.back().previous;
+    m_tokens.pop_back();
+}
+
+// Following the rules specified in CommonMark (http://spec.commonmark.org/0.27/), in a stricter form: left emphasis
+// is kept on a stack until matching right emphasis is found, and then the tags they're written with are generated from
+// their delimiter counts. Returns whether any tags were generated.
+bool MarkDownScanner::MatchEmphasisTokens(size_t emphasisStart)
+{
+    bool hasHtmlTags = false;
+    auto& leftEmphasis = m_leftEmphasis;
+    leftEmphasis.clear();
+
+    size_t current = emphasisStart;
+    while (current != m_emphasis.size())
+    {
+        auto& emphasis = m_tokens[m_emphasis[current]];
+        const bool isLeftAndRight = (emphasis.emphasisKind == MarkDownEmphasisKind::LeftAndRight);
+
+        // keep exploring left until right token is found
+        if (IsLeftEmphasis(emphasis) || (isLeftAndRight && leftEmphasis.empty()))
+        {
+            if (isLeftAndRight && IsRightEmphasis(emphasis))
+            {
+                emphasis.isLeft = true;
+            }
+
+            leftEmphasis.push_back(current);
+            ++current;
+        }
+        else if (!leftEmphasis.empty())
+        {
+            auto currentLeft = leftEmphasis.back();
+
+            // when the last left emphasis doesn't match, search the ones before it: matches on the left side are
+            // preferred (rule #14), and the left emphasis passed over are no longer considered. When none match, the
+            // right emphasis is used as left emphasis if it's of the same type as the last, or else dropped.
+            if (!IsMatch(m_tokens[m_emphasis[currentLeft]], emphasis))
+            {
+                auto& unmatched = m_unmatchedEmphasis;
+                unmatched.clear();
+                bool isFound = false;
+                while (!leftEmphasis.empty() && !isFound)
+                {
+                    const auto left = leftEmphasis.back();
+                    if (IsMatch(m_tokens[m_emphasis[left]], emphasis))
+                    {
+                        currentLeft = left;
+                        isFound = true;
+                    }
+                    else
+                    {
+                        leftEmphasis.pop_back();
+                        unmatched.push_back(left);
+                    }
+                }
+
+                if (!isFound)
+                {
+                    leftEmphasis.insert(leftEmphasis.end(), unmatched.rbegin(), unmatched.rend());
+                    if (m_tokens[m_emphasis[leftEmphasis.back()]].delimiter == emphasis.delimiter)
+                    {
+                        emphasis.isLeft = true;
+                    }
+                    else
+                    {
+                        ++current;
+                    }
+                    continue;
+                }
+            }
+
+            auto& left = m_tokens[m_emphasis[currentLeft]];
+            hasHtmlTags = GenerateTags(left, emphasis) || hasHtmlTags;
+
+            // all right delims used, move to next
+            if (emphasis.unusedDelimiters == 0)
+            {
+                ++current;
+            }
+
+            // all left delims used, pop
+            if (left.unusedDelimiters == 0)
+            {
+                leftEmphasis.pop_back();
+            }
+        }
+        else
+        {
+            ++current;
+        }
+    }
+    return hasHtmlTags;
+}
+
+// Uses as many delimiters of left and right as can be matched: a pair of them for each bold tag, and one for an italic tag
+bool MarkDownScanner::GenerateTags(MarkDownToken& left, MarkDownToken& right)
+{
+    std::uint32_t delimiterCount = 0;
+    if (left.unusedDelimiters >= right.unusedDelimiters)
+    {
+        delimiterCount = right.unusedDelimiters;
+        left.unusedDelimiters -= right.unusedDelimiters;
+        right.unusedDelimiters = 0;
+    }
+    else
+    {
+        delimiterCount = left.unusedDelimiters;
+        right.unusedDelimiters -= left.unusedDelimiters;
+        left.unusedDelimiters = 0;
+    }
+
+    if (delimiterCount % 2)
+    {
+        AddTag(left, false);
+        AddTag(right, false);
+    }
+
+    for (std::uint32_t i = 0; i < delimiterCount / 2; i++)
+    {
+        AddTag(left, true);
+        AddTag(right, true);
+    }
+    return delimiterCount > 0;
+}
+
+// Left emphasis writes its tags in the reverse of the order they're added, so that they nest
+void MarkDownScanner::AddTag(MarkDownToken& token, bool isBold)
+{
+    const bool isOpening = (token.emphasisKind == MarkDownEmphasisKind::Left) ||
+                           (token.emphasisKind == MarkDownEmphasisKind::LeftAndRight && token.isLeft);
+    const MarkDownTag tag = isOpening ? (isBold ? MarkDownTag::OpenBold : MarkDownTag::OpenItalic) :
+                                        (isBold ? MarkDownTag::CloseBold : MarkDownTag::CloseItalic);
+
+    const auto index = static_cast<std::uint32_t>(m_tags.size());
+    if (token.firstTag == c_none)
+    {
+        m_tags.push_back(TagEntry{tag, c_none});
+        token.firstTag = index;
+        token.lastTag = index;
+    }
+    else if (token.emphasisKind == MarkDownEmphasisKind::Left)
+    {
+        m_tags.push_back(TagEntry{tag, token.firstTag});
+        token.firstTag = index;
+    }
+    else
+    {
+        m_tags.push_back(TagEntry{tag, c_none});
+        m_tags[token.lastTag].next = index;
+        token.lastTag = index;
+    }
+}
+
+void MarkDownScanner::Visit(std::uint32_t begin, std::uint32_t end, MarkDownVisitor& visitor) const
+{
+    for (auto i = begin; i < end; ++i)
+    {
+        const auto& token = m_tokens[i];
+        const auto text = GetText(token);
+        switch (token.kind)
+        {
+        case MarkDownTokenKind::Text:
+        case MarkDownTokenKind::NewLine:
+            if (token.isHead)
+            {
+                visitor.StartParagraph();
+            }
+            visitor.AddText(text);
+            if (token.isTail)
+            {
+                visitor.EndParagraph();
+            }
+            break;
+
+        case MarkDownTokenKind::Emphasis:
+        {
+            if (token.isHead)
+            {
+                visitor.StartParagraph();
+            }
+
+            // delimiters that aren't used are text: before the tags of left emphasis, after the tags of right emphasis
+            const auto unused = text.substr(text.size() - token.unusedDelimiters);
+            if (token.emphasisKind == MarkDownEmphasisKind::Left && !unused.empty())
+            {
+                visitor.AddText(unused);
+            }
+            for (auto tag = token.firstTag; tag != c_none; tag = m_tags[tag].next)
+            {
+                visitor.AddTag(m_tags[tag].tag);
+            }
+            if (token.emphasisKind != MarkDownEmphasisKind::Left && !unused.empty())
+            {
+                visitor.AddText(unused);
+            }
+
+            if (token.isTail)
+            {
+                visitor.EndParagraph();
+            }
+            break;
+        }
+
+        case MarkDownTokenKind::Link:
+            if (token.isHead)
+            {
+                visitor.StartParagraph();
+            }
+            visitor.StartLink(text, std::string_view(m_tokenText).substr(token.offset + token.length, token.destinationHtmlLength));
+            Visit(i + 1, token.end, visitor);
+            visitor.EndLink();
+            if (token.isTail)
+            {
+                visitor.EndParagraph();
+            }
+            i = token.end - 1;
+            break;
+
+        case MarkDownTokenKind::ListItem:
+        case MarkDownTokenKind::OrderedListItem:
+        {
+            const bool isOrdered = (token.kind == MarkDownTokenKind::OrderedListItem);
+            if (token.isHead)
+            {
+                visitor.StartList(isOrdered, text);
+            }
+            visitor.StartListItem();
+            Visit(i + 1, token.end, visitor);
+            visitor.EndListItem();
+            if (token.isTail)
+            {
+                visitor.EndList(isOrdered);
+            }
+            i = token.end - 1;
+            break;
+        }
+        }
+    }
+}
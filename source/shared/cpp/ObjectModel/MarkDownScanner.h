@@ -0,0 +1,191 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveCards
+{
+enum class MarkDownTokenKind : std::uint8_t
+{
+    Text,
+    // A new line between blocks (a new line within a list item is Text)
+    NewLine,
+    // A run of * or _, with the emphasis tags it opens or closes
+    Emphasis,
+    // A link, whose text is the tokens that follow it up to its end
+    Link,
+    // An item of a list, whose content is the tokens that follow it up to its end
+    ListItem,
+    OrderedListItem
+};
+
+// How a run of emphasis delimiters can be used: to open emphasis, to close it, or either
+enum class MarkDownEmphasisKind : std::uint8_t
+{
+    Left,
+    Right,
+    LeftAndRight
+};
+
+enum class MarkDownTag : std::uint8_t
+{
+    OpenItalic,
+    OpenBold,
+    CloseItalic,
+    CloseBold
+};
+
+struct MarkDownToken
+{
+    MarkDownTokenKind kind;
+
+    // Whether the token begins or ends a paragraph (or a list, for a list item): <p>, <ul> or <ol> is written
+    // before it, and </p>, </ul> or </ol> after it
+    bool isHead;
+    bool isTail;
+
+    // Emphasis: how it can be used, which way it's used once emphasis is matched, and its delimiter (* or _)
+    MarkDownEmphasisKind emphasisKind;
+    bool isLeft;
+    char delimiter;
+
+    // Text, NewLine and Emphasis: the text of the token. Link: its destination, followed in the token text by the
+    // destination as HTML, destinationHtmlLength long. OrderedListItem: its number.
+    std::uint32_t offset;
+    std::uint32_t length;
+    std::uint32_t destinationHtmlLength;
+
+    // Emphasis: how many of its delimiters aren't matched (and so are written as they are), and the first of the tags
+    // it's written with, in the order they're written
+    std::uint32_t unusedDelimiters;
+    std::uint32_t firstTag;
+    std::uint32_t lastTag;
+
+    // Link and list items: the index past the last of the tokens it contains
+    std::uint32_t end;
+
+    // The index of the token before it at the same level, while it's scanned
+    std::uint32_t previous;
+};
+
+// Receives what a MarkDownScanner scanned, in order. Writing HTML is one way of consuming it; building a
+// MarkDownDocument is another.
+class MarkDownVisitor
+{
+public:
+    virtual ~MarkDownVisitor() = default;
+
+    virtual void StartParagraph() = 0;
+    virtual void EndParagraph() = 0;
+    // number is the number an ordered list starts at, as written
+    virtual void StartList(bool isOrdered, std::string_view number) = 0;
+    virtual void EndList(bool isOrdered) = 0;
+    virtual void StartListItem() = 0;
+    virtual void EndListItem() = 0;
+    // destinationHtml is the destination as it's written in HTML
+    virtual void StartLink(std::string_view destination, std::string_view destinationHtml) = 0;
+    virtual void EndLink() = 0;
+    virtual void AddTag(MarkDownTag tag) = 0;
+    // text as it was scanned, not escaped for HTML
+    virtual void AddText(std::string_view text) = 0;
+};
+
+// Scans markdown into a flat sequence of tokens. This is what MarkDownParser runs. The markdown it supports
+// (emphasis, links and lists) and the HTML it writes for it are exactly those of the stringstream based block parsers
+// it replaced, but it scans the text once through a string_view, keeps the tokens in one vector of plain structs (and
+// their text in one string), and writes all of the HTML into one string.
+class MarkDownScanner
+{
+public:
+    // text is scanned as it is, and escaped for HTML when it's written as HTML
+    explicit MarkDownScanner(std::string_view text);
+
+    void Visit(MarkDownVisitor& visitor) const;
+    void WriteHtml(std::string& output) const;
+
+    // Whether the HTML has any tags other than the paragraph it's in: emphasis, links or lists
+    bool HasHtmlTags() const { return m_hasHtmlTags; }
+
+    const std::vector<MarkDownToken>& GetTokens() const { return m_tokens; }
+    std::string_view GetText(const MarkDownToken& token) const;
+
+    // Writes text as HTML text, escaping <, >, " and &
+    static void WriteEscapedText(std::string_view text, std::string& output);
+
+private:
+    struct EmphasisRun;
+
+    // The tokens a block is scanned into: the index of its last token, and where its emphasis tokens start in
+    // m_emphasis
+    struct Scope
+    {
+        std::uint32_t last;
+        size_t emphasisStart;
+    };
+
+    struct TagEntry
+    {
+        MarkDownTag tag;
+        std::uint32_t next;
+    };
+
+    // Reading m_text exactly as a std::stringstream over it would be read, down to when it's at its end and when it
+    // fails
+    int Peek();
+    int Get();
+    void Get(char& ch);
+    void Unget();
+    std::ptrdiff_t Tellg();
+    void Seekg(size_t position);
+
+    void ParseBlock(bool& isCaptured);
+    bool ParseLink();
+    bool ParseList();
+    bool ParseOrderedList();
+    bool CompleteListParsing(MarkDownTokenKind kind, std::uint32_t numberOffset, std::uint32_t numberLength, bool& isCaptured);
+    void ParseSubBlocks(bool& isCaptured);
+    bool MatchNewListItem();
+    bool MatchNewBlock();
+    bool MatchNewOrderedListItem();
+
+    void ParseTextAndEmphasis();
+    bool MatchText(EmphasisRun& run);
+    bool MatchEmphasis(EmphasisRun& run);
+    void Flush(EmphasisRun& run, int ch, bool isEmphasis);
+    void CaptureText(EmphasisRun& run);
+    void CaptureEmphasis(EmphasisRun& run, int ch);
+    void AddEmphasis(EmphasisRun& run, MarkDownEmphasisKind kind);
+
+    std::uint32_t AddToken(MarkDownTokenKind kind, size_t offset, size_t length);
+    std::uint32_t AddCharacter(MarkDownTokenKind kind, char ch);
+    void PopToken();
+
+    bool MatchEmphasisTokens(size_t emphasisStart);
+    bool GenerateTags(MarkDownToken& left, MarkDownToken& right);
+    void AddTag(MarkDownToken& token, bool isBold);
+
+    void Visit(std::uint32_t begin, std::uint32_t end, MarkDownVisitor& visitor) const;
+
+    std::string_view m_text;
+    size_t m_position;
+    bool m_isAtEnd;
+    bool m_hasFailed;
+
+    std::vector<MarkDownToken> m_tokens;
+    std::string m_tokenText;
+    std::vector<TagEntry> m_tags;
+
+    // The indices of the emphasis tokens of the blocks being scanned, innermost last
+    std::vector<std::uint32_t> m_emphasis;
+    Scope m_scope;
+
+    // Used while emphasis is matched
+    std::vector<size_t> m_leftEmphasis;
+    std::vector<size_t> m_unmatchedEmphasis;
+    // A link's destination, while it's written
+    std::string m_scratch;
+
+    bool m_hasHtmlTags;
+};
+} // namespace AdaptiveCards
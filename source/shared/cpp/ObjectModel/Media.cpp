@@ -4,6 +4,7 @@
 #include "Media.h"
 #include "ParseUtil.h"
 #include "ParseContext.h"
+#include "Util.h"
 
 using namespace AdaptiveCards;
 
@@ -18,15 +19,15 @@ Json::Value Media::SerializeToJsonValue() const
 
     if (!m_poster.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Poster)] = m_poster;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Poster)] = m_poster;
     }
 
     if (!m_altText.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AltText)] = GetAltText();
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::AltText)] = GetAltText();
     }
 
-    const std::string& sourcesPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Sources);
+    const Json::StaticString& sourcesPropertyName = AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Sources);
     root[sourcesPropertyName] = Json::Value(Json::arrayValue);
     for (const auto& source : m_sources)
     {
@@ -66,12 +67,24 @@ std::vector<std::shared_ptr<CaptionSource>>& Media::GetCaptionSources()
     return m_captionSources;
 }
 
+const std::vector<std::shared_ptr<MediaSource>>& Media::GetSources() const
+{
+    return m_sources;
+}
+
+const std::vector<std::shared_ptr<CaptionSource>>& Media::GetCaptionSources() const
+{
+    return m_captionSources;
+}
+
 void Media::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Poster),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AltText),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Sources)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Poster,
+         AdaptiveCardSchemaKey::AltText,
+         AdaptiveCardSchemaKey::Sources});
+    m_knownProperties = &knownProperties;
 }
 
 void Media::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -32,6 +32,8 @@ public:
 
     std::vector<std::shared_ptr<MediaSource>>& GetSources();
     std::vector<std::shared_ptr<CaptionSource>>& GetCaptionSources();
+    const std::vector<std::shared_ptr<MediaSource>>& GetSources() const;
+    const std::vector<std::shared_ptr<CaptionSource>>& GetCaptionSources() const;
 
     void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo) override;
 
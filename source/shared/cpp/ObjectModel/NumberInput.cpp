@@ -18,22 +18,22 @@ Json::Value NumberInput::SerializeToJsonValue() const
 
     if (m_min)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min)] = *m_min;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Min)] = *m_min;
     }
 
     if (m_max)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max)] = *m_max;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Max)] = *m_max;
     }
 
     if (m_value)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value)] = *m_value;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Value)] = *m_value;
     }
 
     if (!m_placeholder.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder)] = m_placeholder;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Placeholder)] = m_placeholder;
     }
 
     return root;
@@ -101,9 +101,11 @@ std::shared_ptr<BaseCardElement> NumberInputParser::DeserializeFromString(ParseC
 
 void NumberInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Placeholder,
+         AdaptiveCardSchemaKey::Value,
+         AdaptiveCardSchemaKey::Max,
+         AdaptiveCardSchemaKey::Min});
+    m_knownProperties = &knownProperties;
 }
@@ -4,6 +4,7 @@
 #include "OpenUrlAction.h"
 #include "ParseContext.h"
 #include "ParseUtil.h"
+#include "Util.h"
 
 using namespace AdaptiveCards;
 
@@ -16,7 +17,7 @@ Json::Value OpenUrlAction::SerializeToJsonValue() const
 {
     Json::Value root = BaseActionElement::SerializeToJsonValue();
 
-    root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url)] = GetUrl();
+    root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Url)] = GetUrl();
 
     return root;
 }
@@ -47,5 +48,8 @@ std::shared_ptr<BaseActionElement> OpenUrlActionParser::DeserializeFromString(Pa
 
 void OpenUrlAction::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Url});
+    m_knownProperties = &knownProperties;
 }
@@ -0,0 +1,58 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ParseArena.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+// chunks grow geometrically up to this size; larger requests get a chunk of their own
+constexpr size_t c_maxChunkSize = 64 * 1024;
+} // namespace
+
+ParseArena::ParseArena(size_t initialChunkSize) :
+    m_current(nullptr), m_remaining(0), m_initialChunkSize(initialChunkSize),
+    m_nextChunkSize(std::max<size_t>(initialChunkSize, 64)), m_bytesAllocated(0)
+{
+}
+
+void* ParseArena::Allocate(size_t size, size_t alignment)
+{
+    void* current = m_current;
+    if (m_current == nullptr || std::align(alignment, size, current, m_remaining) == nullptr)
+    {
+        AddChunk(size + alignment);
+        current = m_current;
+        std::align(alignment, size, current, m_remaining);
+    }
+
+    m_current = static_cast<unsigned char*>(current) + size;
+    m_remaining -= size;
+    m_bytesAllocated += size;
+    return current;
+}
+
+size_t ParseArena::GetBytesAllocated() const
+{
+    return m_bytesAllocated;
+}
+
+size_t ParseArena::GetChunkCount() const
+{
+    return m_chunks.size();
+}
+
+size_t ParseArena::GetInitialChunkSize() const
+{
+    return m_initialChunkSize;
+}
+
+void ParseArena::AddChunk(size_t minimumSize)
+{
+    const size_t chunkSize = std::max(m_nextChunkSize, minimumSize);
+    m_chunks.emplace_back(new unsigned char[chunkSize]);
+    m_current = m_chunks.back().get();
+    m_remaining = chunkSize;
+    m_nextChunkSize = std::min(m_nextChunkSize * 2, c_maxChunkSize);
+}
@@ -0,0 +1,101 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveCards
+{
+// A monotonic arena that the elements of a parsed card can be allocated from. Set one on a ParseContext and the
+// elements, choices, facts and text runs created while parsing are placed in the arena's chunks rather than being
+// allocated one by one. Nothing is freed until the arena itself goes away: every object allocated from it holds a
+// reference to it, so the chunks are released together once the last of those objects is destroyed.
+//
+// Strings and other members owned by the elements are still allocated as usual, since their types are part of the
+// public object model, and the Json::Value tree the card is parsed from is built by jsoncpp with its own
+// allocations. Those make up most of the allocations of a parse, so an arena takes out roughly one in ten of them
+// rather than most of them, and does not by itself remove allocator contention when many cards are parsed at once.
+// An arena must only be used by one parse at a time; the objects allocated from it may be released from any thread.
+class ParseArena
+{
+public:
+    explicit ParseArena(size_t initialChunkSize = 4096);
+
+    ParseArena(const ParseArena&) = delete;
+    ParseArena& operator=(const ParseArena&) = delete;
+
+    void* Allocate(size_t size, size_t alignment);
+
+    size_t GetBytesAllocated() const;
+    size_t GetChunkCount() const;
+    // The size the arena was built with, for building another like it
+    size_t GetInitialChunkSize() const;
+
+private:
+    void AddChunk(size_t minimumSize);
+
+    std::vector<std::unique_ptr<unsigned char[]>> m_chunks;
+    unsigned char* m_current;
+    size_t m_remaining;
+    size_t m_initialChunkSize;
+    size_t m_nextChunkSize;
+    size_t m_bytesAllocated;
+};
+
+// Allocator that carves its allocations out of a ParseArena and keeps the arena alive. Deallocation is a no-op.
+template <typename T>
+class ParseArenaAllocator
+{
+public:
+    using value_type = T;
+
+    explicit ParseArenaAllocator(std::shared_ptr<ParseArena> arena) noexcept : m_arena(std::move(arena)) {}
+
+    template <typename U>
+    ParseArenaAllocator(const ParseArenaAllocator<U>& other) noexcept : m_arena(other.GetArena())
+    {
+    }
+
+    T* allocate(size_t count)
+    {
+        if (count > std::numeric_limits<size_t>::max() / sizeof(T))
+        {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(m_arena->Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t) noexcept {}
+
+    const std::shared_ptr<ParseArena>& GetArena() const noexcept
+    {
+        return m_arena;
+    }
+
+    template <typename U>
+    bool operator==(const ParseArenaAllocator<U>& other) const noexcept
+    {
+        return m_arena == other.GetArena();
+    }
+
+    template <typename U>
+    bool operator!=(const ParseArenaAllocator<U>& other) const noexcept
+    {
+        return m_arena != other.GetArena();
+    }
+
+private:
+    std::shared_ptr<ParseArena> m_arena;
+};
+
+// std::make_shared, or std::allocate_shared from arena when there is one
+template <typename T, typename... Args>
+std::shared_ptr<T> MakeSharedInArena(const std::shared_ptr<ParseArena>& arena, Args&&... args)
+{
+    if (arena)
+    {
+        return std::allocate_shared<T>(ParseArenaAllocator<T>(arena), std::forward<Args>(args)...);
+    }
+    return std::make_shared<T>(std::forward<Args>(args)...);
+}
+} // namespace AdaptiveCards
@@ -11,13 +11,14 @@ namespace AdaptiveCards
 ParseContext::ParseContext() :
     elementParserRegistration{std::make_shared<ElementParserRegistration>()},
     actionParserRegistration{std::make_shared<ActionParserRegistration>()}, warnings{}, m_elementIds{}, m_idStack{},
-    m_parentalContainerStyles{}, m_parentalPadding{}, m_parentalBleedDirection{}, m_canFallbackToAncestor(false)
+    m_parentalContainerStyles{}, m_parentalPadding{}, m_parentalBleedDirection{}, m_canFallbackToAncestor(false),
+    m_deferShowCardParsing(false)
 {
 }
 
 ParseContext::ParseContext(std::shared_ptr<ElementParserRegistration> elementRegistration, std::shared_ptr<ActionParserRegistration> actionRegistration) :
     warnings{}, m_elementIds{}, m_idStack{}, m_parentalContainerStyles{}, m_parentalPadding{}, m_parentalBleedDirection{},
-    m_canFallbackToAncestor(false)
+    m_canFallbackToAncestor(false), m_deferShowCardParsing(false)
 {
     elementParserRegistration = (elementRegistration) ? elementRegistration : std::make_shared<ElementParserRegistration>();
     actionParserRegistration = (actionRegistration) ? actionRegistration : std::make_shared<ActionParserRegistration>();
@@ -85,7 +86,8 @@ ParseContext::ParseContext(std::shared_ptr<ElementParserRegistration> elementReg
 // element off the stack. To facilitate this, we wrap parsers such that we can push/pop around the deserialize
 // calls, obviating the need for parser implementors to remember to push/pop themselves (see
 // ActionParserRegistration::GetParser(), ElementParserRegistration::GetParser, and the wrapper classes they
-// consume). Note that we will also push/pop when parsing an element's fallback content.
+// consume; our own parsing looks parsers up with FindParser() and calls the wrappers' static Deserialize() to
+// avoid allocating a wrapper per element). Note that we will also push/pop when parsing an element's fallback content.
 //
 // So how *do* we detect collisions? When we push an element we're visiting, we supply three pieces of information
 // for reference: the ID property, the element's internal ID, and whether we're parsing fallback content or not.
@@ -184,21 +186,17 @@ void ParseContext::PopElement()
 
             // The inverse of the above -- if this element's fallback parent is the entry we're looking at, there's
             // no collision.
-            try
+            // -1 is the last item on the stack (the one we're about to pop)
+            // -2 is the parent of the last item on the stack; a toplevel element has none
+            if (m_idStack.size() >= 2)
             {
-                // -1 is the last item on the stack (the one we're about to pop)
-                // -2 is the parent of the last item on the stack
-                const auto& previousInStack = m_idStack.at(m_idStack.size() - 2);
+                const auto& previousInStack = m_idStack[m_idStack.size() - 2];
                 if (std::get<TupleIndex::InternalId>(previousInStack) == entryFallbackId)
                 {
                     // we're looking at a fallback entry for our parent
                     break;
                 }
             }
-            catch (const std::out_of_range&)
-            {
-                // we're looking at a toplevel element
-            }
 
             // if the element we're inspecting is fallback content, continue on to the next entry
             if (isFallback)
@@ -334,4 +332,24 @@ const std::string& ParseContext::GetLanguage() const
 {
     return m_language;
 }
+
+void ParseContext::SetDeferShowCardParsing(bool value)
+{
+    m_deferShowCardParsing = value;
+}
+
+bool ParseContext::GetDeferShowCardParsing() const
+{
+    return m_deferShowCardParsing;
+}
+
+void ParseContext::SetArena(std::shared_ptr<ParseArena> arena)
+{
+    m_arena = std::move(arena);
+}
+
+const std::shared_ptr<ParseArena>& ParseContext::GetArena() const
+{
+    return m_arena;
+}
 } // namespace AdaptiveCards
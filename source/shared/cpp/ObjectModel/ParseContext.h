@@ -8,6 +8,7 @@
 #include "ElementParserRegistration.h"
 #include "ActionParserRegistration.h"
 #include "AdaptiveCardParseWarning.h"
+#include "ParseArena.h"
 
 namespace AdaptiveCards
 {
@@ -20,7 +21,11 @@ public:
 
     std::shared_ptr<ElementParserRegistration> elementParserRegistration;
     std::shared_ptr<ActionParserRegistration> actionParserRegistration;
+    // Every warning raised while parsing, cards nested in Action.ShowCard included, each recorded once. This stays a
+    // vector of shared_ptr, with no cap or deduplication, because parser registrations (custom, UWP) and the SWIG
+    // bindings add to and read it as one.
     std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
+
     // Push/PopElement are used during parsing to track the tree structure of a card.
     void PushElement(const std::string& idJsonProperty, const AdaptiveCards::InternalId& internalId, const bool isFallback = false);
     void PopElement();
@@ -38,6 +43,16 @@ public:
     void SetLanguage(const std::string& value);
     const std::string& GetLanguage() const;
 
+    // When set, the card of an Action.ShowCard is kept as JSON and only parsed the first time it is asked for. Id
+    // collisions between a deferred card and the rest of the card are not detected, so leave this unset (the
+    // default) when the whole card has to be validated up front.
+    void SetDeferShowCardParsing(bool value);
+    bool GetDeferShowCardParsing() const;
+
+    // Elements created while parsing are allocated from the arena when one is set; see ParseArena.h
+    void SetArena(std::shared_ptr<ParseArena> arena);
+    const std::shared_ptr<ParseArena>& GetArena() const;
+
     ContainerStyle GetParentalContainerStyle() const;
     void SetParentalContainerStyle(const ContainerStyle style);
     AdaptiveCards::InternalId PaddingParentInternalId() const;
@@ -79,6 +94,8 @@ private:
     std::vector<ContainerBleedDirection> m_parentalBleedDirection;
 
     bool m_canFallbackToAncestor;
+    bool m_deferShowCardParsing;
     std::string m_language;
+    std::shared_ptr<ParseArena> m_arena;
 };
 } // namespace AdaptiveCards
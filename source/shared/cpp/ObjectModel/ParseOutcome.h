@@ -0,0 +1,57 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "AdaptiveCardParseException.h"
+
+namespace AdaptiveCards
+{
+// A parse failure reported by value: the status code and message an AdaptiveCardParseException would carry.
+struct ParseError
+{
+    ErrorStatusCode statusCode;
+    std::string message;
+};
+
+// Either the value a parse produced or the ParseError it failed with, for callers that collect the results of many
+// parses rather than stopping at the first that throws (see BatchDeserializer)
+template <typename T>
+class ParseOutcome
+{
+public:
+    ParseOutcome(const T& value) : m_outcome(std::in_place_index<0>, value) {}
+    ParseOutcome(T&& value) : m_outcome(std::in_place_index<0>, std::move(value)) {}
+    ParseOutcome(ParseError&& error) : m_outcome(std::in_place_index<1>, std::move(error)) {}
+
+    bool HasValue() const noexcept
+    {
+        return m_outcome.index() == 0;
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return HasValue();
+    }
+
+    // Only valid when HasValue() is true
+    const T& GetValue() const&
+    {
+        return std::get<0>(m_outcome);
+    }
+
+    T&& GetValue() &&
+    {
+        return std::get<0>(std::move(m_outcome));
+    }
+
+    // Only valid when HasValue() is false
+    const ParseError& GetError() const&
+    {
+        return std::get<1>(m_outcome);
+    }
+
+private:
+    std::variant<T, ParseError> m_outcome;
+};
+} // namespace AdaptiveCards
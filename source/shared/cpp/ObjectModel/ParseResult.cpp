@@ -8,7 +8,7 @@
 using namespace AdaptiveCards;
 
 ParseResult::ParseResult(std::shared_ptr<AdaptiveCard> adaptiveCard, std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings) :
-    m_adaptiveCard(adaptiveCard), m_warnings(warnings)
+    m_adaptiveCard(adaptiveCard), m_warnings(std::move(warnings))
 {
 }
 
@@ -0,0 +1,178 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ParseResultCache.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+// The object model built from a card holds roughly three bytes for every byte of its JSON (measured over
+// samples/v1.5), and the entry keeps a copy of the JSON itself.
+constexpr size_t c_estimatedBytesPerJsonByte = 4;
+
+size_t CombineHash(size_t seed, size_t value)
+{
+    return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+} // namespace
+
+bool ParseResultCache::CacheKey::operator==(const CacheKey& other) const noexcept
+{
+    return hash == other.hash && elementParserRegistration == other.elementParserRegistration &&
+           actionParserRegistration == other.actionParserRegistration && rendererVersion == other.rendererVersion &&
+           deferShowCardParsing == other.deferShowCardParsing && language == other.language &&
+           jsonString == other.jsonString;
+}
+
+ParseResultCache::ParseResultCache(size_t capacityInBytes) :
+    m_capacityInBytes(capacityInBytes), m_defaultElementParserRegistration(std::make_shared<ElementParserRegistration>()),
+    m_defaultActionParserRegistration(std::make_shared<ActionParserRegistration>()), m_sizeInBytes(0), m_hitCount(0),
+    m_missCount(0)
+{
+}
+
+std::shared_ptr<const ParseResult> ParseResultCache::DeserializeFromString(const std::string& jsonString, const std::string& rendererVersion)
+{
+    ParseContext context(m_defaultElementParserRegistration, m_defaultActionParserRegistration);
+    return DeserializeFromString(jsonString, rendererVersion, context);
+}
+
+std::shared_ptr<const ParseResult> ParseResultCache::DeserializeFromString(
+    const std::string& jsonString, const std::string& rendererVersion, ParseContext& context)
+{
+    const CacheKey key = MakeKey(jsonString, rendererVersion, context);
+    if (auto cachedResult = Find(key))
+    {
+        ++m_hitCount;
+        const auto warnings = cachedResult->GetWarnings();
+        context.warnings.insert(context.warnings.end(), warnings.begin(), warnings.end());
+        return cachedResult;
+    }
+
+    ++m_missCount;
+
+    // Parse with a context of our own, so that the cached result doesn't pick up warnings context already held.
+    // Parse without holding the lock, so that a slow card doesn't hold up lookups of other cards; if another thread
+    // parses the same card at the same time, the first one to finish is cached.
+    ParseContext cardContext(context.elementParserRegistration, context.actionParserRegistration);
+    cardContext.SetLanguage(context.GetLanguage());
+    cardContext.SetDeferShowCardParsing(context.GetDeferShowCardParsing());
+    std::shared_ptr<const ParseResult> parseResult = AdaptiveCard::DeserializeFromString(jsonString, rendererVersion, cardContext);
+    context.warnings.insert(context.warnings.end(), cardContext.warnings.begin(), cardContext.warnings.end());
+
+    Insert({jsonString,
+            rendererVersion,
+            context.GetLanguage(),
+            context.elementParserRegistration,
+            context.actionParserRegistration,
+            context.GetDeferShowCardParsing(),
+            parseResult,
+            key.hash,
+            jsonString.size() * c_estimatedBytesPerJsonByte + sizeof(CacheEntry)});
+    return parseResult;
+}
+
+size_t ParseResultCache::GetHitCount() const
+{
+    return m_hitCount;
+}
+
+size_t ParseResultCache::GetMissCount() const
+{
+    return m_missCount;
+}
+
+size_t ParseResultCache::GetEntryCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+size_t ParseResultCache::GetSizeInBytes() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_sizeInBytes;
+}
+
+size_t ParseResultCache::GetCapacityInBytes() const
+{
+    return m_capacityInBytes;
+}
+
+void ParseResultCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entriesByKey.clear();
+    m_entries.clear();
+    m_sizeInBytes = 0;
+}
+
+ParseResultCache::CacheKey ParseResultCache::MakeKey(const std::string& jsonString, const std::string& rendererVersion, const ParseContext& context)
+{
+    size_t hash = std::hash<std::string_view>{}(jsonString);
+    hash = CombineHash(hash, std::hash<std::string_view>{}(rendererVersion));
+    hash = CombineHash(hash, std::hash<std::string_view>{}(context.GetLanguage()));
+    hash = CombineHash(hash, std::hash<const void*>{}(context.elementParserRegistration.get()));
+    hash = CombineHash(hash, std::hash<const void*>{}(context.actionParserRegistration.get()));
+    hash = CombineHash(hash, std::hash<bool>{}(context.GetDeferShowCardParsing()));
+    return {jsonString,
+            rendererVersion,
+            context.GetLanguage(),
+            context.elementParserRegistration.get(),
+            context.actionParserRegistration.get(),
+            context.GetDeferShowCardParsing(),
+            hash};
+}
+
+ParseResultCache::CacheKey ParseResultCache::MakeKey(const CacheEntry& entry)
+{
+    return {entry.jsonString,
+            entry.rendererVersion,
+            entry.language,
+            entry.elementParserRegistration.get(),
+            entry.actionParserRegistration.get(),
+            entry.deferShowCardParsing,
+            entry.hash};
+}
+
+std::shared_ptr<const ParseResult> ParseResultCache::Find(const CacheKey& key)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto found = m_entriesByKey.find(key);
+    if (found == m_entriesByKey.end())
+    {
+        return nullptr;
+    }
+
+    // move to the front of the LRU list; splice leaves iterators (and the key's views into the entry) valid
+    m_entries.splice(m_entries.begin(), m_entries, found->second);
+    return found->second->parseResult;
+}
+
+void ParseResultCache::Insert(CacheEntry&& entry)
+{
+    if (entry.sizeInBytes > m_capacityInBytes)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_entriesByKey.find(MakeKey(entry)) != m_entriesByKey.end())
+    {
+        return;
+    }
+
+    m_sizeInBytes += entry.sizeInBytes;
+    m_entries.push_front(std::move(entry));
+    m_entriesByKey.emplace(MakeKey(m_entries.front()), m_entries.begin());
+
+    while (m_sizeInBytes > m_capacityInBytes)
+    {
+        const auto& leastRecentlyUsed = m_entries.back();
+        m_sizeInBytes -= leastRecentlyUsed.sizeInBytes;
+        m_entriesByKey.erase(MakeKey(leastRecentlyUsed));
+        m_entries.pop_back();
+    }
+}
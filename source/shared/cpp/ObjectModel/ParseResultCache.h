@@ -0,0 +1,102 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "ParseContext.h"
+#include "ParseResult.h"
+
+namespace AdaptiveCards
+{
+// An opt-in LRU cache in front of AdaptiveCard::DeserializeFromString. Cards are looked up by their exact JSON text,
+// the renderer version, and the parser registrations, language and show card deferral of the ParseContext, so a card
+// that is sent again with identical JSON is returned without being parsed again.
+//
+// Results are shared between everyone who asks for the same card, so they must be treated as read-only: modifying
+// a card returned by the cache modifies it for every later hit. Cards that fail to parse are not cached. Registrations
+// are identified by address, so call Clear() after registering or removing parsers on a registration that has been
+// used with the cache.
+//
+// The cache is safe to use from several threads at once. It is bounded by an estimate of the memory its entries hold:
+// the JSON text plus the object model built from it.
+class ParseResultCache
+{
+public:
+    explicit ParseResultCache(size_t capacityInBytes);
+
+    // Parses with the built-in parsers
+    std::shared_ptr<const ParseResult> DeserializeFromString(const std::string& jsonString, const std::string& rendererVersion);
+
+    // The card's warnings are appended to context.warnings, whether it was parsed or found in the cache
+    std::shared_ptr<const ParseResult> DeserializeFromString(
+        const std::string& jsonString, const std::string& rendererVersion, ParseContext& context);
+
+    size_t GetHitCount() const;
+    size_t GetMissCount() const;
+
+    size_t GetEntryCount() const;
+    size_t GetSizeInBytes() const;
+    size_t GetCapacityInBytes() const;
+
+    void Clear();
+
+private:
+    struct CacheEntry
+    {
+        std::string jsonString;
+        std::string rendererVersion;
+        std::string language;
+        // held so that a registration's address can't be reused by another one while this entry refers to it
+        std::shared_ptr<ElementParserRegistration> elementParserRegistration;
+        std::shared_ptr<ActionParserRegistration> actionParserRegistration;
+        bool deferShowCardParsing;
+        std::shared_ptr<const ParseResult> parseResult;
+        size_t hash;
+        size_t sizeInBytes;
+    };
+
+    // Refers either to a caller's strings (for lookups) or to a CacheEntry's (for keys in m_entriesByKey)
+    struct CacheKey
+    {
+        std::string_view jsonString;
+        std::string_view rendererVersion;
+        std::string_view language;
+        const ElementParserRegistration* elementParserRegistration;
+        const ActionParserRegistration* actionParserRegistration;
+        bool deferShowCardParsing;
+        size_t hash;
+
+        bool operator==(const CacheKey& other) const noexcept;
+    };
+
+    struct CacheKeyHash
+    {
+        size_t operator()(const CacheKey& key) const noexcept
+        {
+            return key.hash;
+        }
+    };
+
+    using EntryList = std::list<CacheEntry>;
+
+    static CacheKey MakeKey(const std::string& jsonString, const std::string& rendererVersion, const ParseContext& context);
+    static CacheKey MakeKey(const CacheEntry& entry);
+
+    std::shared_ptr<const ParseResult> Find(const CacheKey& key);
+    void Insert(CacheEntry&& entry);
+
+    const size_t m_capacityInBytes;
+    // used by the overload without a ParseContext, so that its cards share a key
+    const std::shared_ptr<ElementParserRegistration> m_defaultElementParserRegistration;
+    const std::shared_ptr<ActionParserRegistration> m_defaultActionParserRegistration;
+
+    mutable std::mutex m_mutex;
+    // most recently used first
+    EntryList m_entries;
+    std::unordered_map<CacheKey, EntryList::iterator, CacheKeyHash> m_entriesByKey;
+    size_t m_sizeInBytes;
+
+    std::atomic<size_t> m_hitCount;
+    std::atomic<size_t> m_missCount;
+};
+} // namespace AdaptiveCards
@@ -11,13 +11,288 @@
 
 namespace
 {
-Json::StreamWriterBuilder CreateJsonStreamWriter()
+constexpr size_t c_jsonStreamBufferSize = 16 * 1024;
+
+// Writes compact JSON exactly as jsoncpp's StreamWriter does with no indentation and no comments (object members in
+// key order, non-ASCII and control characters escaped as \u sequences, reals with 17 significant digits), without
+// building the intermediate strings it does. With a stream, what's written to output is moved to the stream every
+// c_jsonStreamBufferSize bytes or so, and by Flush.
+class CompactJsonWriter
 {
-    Json::StreamWriterBuilder builder;
-    builder["commentStyle"] = "None";
-    builder["indentation"] = "";
+public:
+    explicit CompactJsonWriter(std::string& output, std::ostream* stream = nullptr) : m_output(output), m_stream(stream)
+    {
+    }
+
+    void Flush()
+    {
+        if (m_stream && !m_output.empty())
+        {
+            m_stream->write(m_output.data(), static_cast<std::streamsize>(m_output.size()));
+            m_output.clear();
+        }
+    }
+
+    void WriteValue(const Json::Value& value)
+    {
+        switch (value.type())
+        {
+        case Json::nullValue:
+            m_output += "null";
+            break;
+        case Json::intValue:
+            WriteInteger(value.asLargestInt());
+            break;
+        case Json::uintValue:
+            WriteUnsigned(value.asLargestUInt());
+            break;
+        case Json::realValue:
+            m_output += Json::valueToString(value.asDouble());
+            break;
+        case Json::stringValue:
+        {
+            const char* begin;
+            const char* end;
+            if (value.getString(&begin, &end))
+            {
+                WriteString(begin, end);
+            }
+            break;
+        }
+        case Json::booleanValue:
+            m_output += value.asBool() ? "true" : "false";
+            break;
+        case Json::arrayValue:
+        {
+            // arrays are maps keyed by index in jsoncpp, so iterate rather than look each index up
+            m_output += '[';
+            bool first = true;
+            for (const auto& element : value)
+            {
+                if (!first)
+                {
+                    m_output += ',';
+                }
+                first = false;
+                WriteValue(element);
+                FlushIfFull();
+            }
+            m_output += ']';
+            break;
+        }
+        case Json::objectValue:
+        {
+            m_output += '{';
+            bool first = true;
+            for (auto member = value.begin(); member != value.end(); ++member)
+            {
+                if (!first)
+                {
+                    m_output += ',';
+                }
+                first = false;
+
+                const char* nameEnd;
+                const char* name = member.memberName(&nameEnd);
+                WriteString(name, nameEnd);
+                m_output += ':';
+                WriteValue(*member);
+                FlushIfFull();
+            }
+            m_output += '}';
+            break;
+        }
+        }
+    }
+
+private:
+    void FlushIfFull()
+    {
+        if (m_output.size() >= c_jsonStreamBufferSize)
+        {
+            Flush();
+        }
+    }
+
+    void WriteUnsigned(Json::LargestUInt value)
+    {
+        char buffer[3 * sizeof(Json::LargestUInt) + 1];
+        char* current = buffer + sizeof(buffer);
+        do
+        {
+            *--current = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value != 0);
+        m_output.append(current, buffer + sizeof(buffer));
+    }
+
+    void WriteInteger(Json::LargestInt value)
+    {
+        if (value < 0)
+        {
+            m_output += '-';
+            // negate as unsigned so the smallest value doesn't overflow
+            WriteUnsigned(0 - static_cast<Json::LargestUInt>(value));
+        }
+        else
+        {
+            WriteUnsigned(static_cast<Json::LargestUInt>(value));
+        }
+    }
+
+    void WriteString(const char* begin, const char* end)
+    {
+        m_output += '"';
+        const char* unescaped = begin;
+        for (const char* c = begin; c != end; ++c)
+        {
+            const auto byte = static_cast<unsigned char>(*c);
+            if (byte >= 0x20 && byte < 0x80 && byte != '"' && byte != '\\')
+            {
+                continue;
+            }
+
+            m_output.append(unescaped, c);
+            switch (byte)
+            {
+            case '"':
+                m_output += "\\\"";
+                break;
+            case '\\':
+                m_output += "\\\\";
+                break;
+            case '\b':
+                m_output += "\\b";
+                break;
+            case '\f':
+                m_output += "\\f";
+                break;
+            case '\n':
+                m_output += "\\n";
+                break;
+            case '\r':
+                m_output += "\\r";
+                break;
+            case '\t':
+                m_output += "\\t";
+                break;
+            default:
+            {
+                const unsigned int codepoint = Utf8ToCodepoint(c, end);
+                if (codepoint < 0x80 && codepoint >= 0x20)
+                {
+                    m_output += static_cast<char>(codepoint);
+                }
+                else if (codepoint < 0x10000)
+                {
+                    WriteEscapedCodeUnit(codepoint);
+                }
+                else
+                {
+                    // outside the Basic Multilingual Plane; write it as a surrogate pair
+                    WriteEscapedCodeUnit(((codepoint - 0x10000) >> 10) + 0xD800);
+                    WriteEscapedCodeUnit(((codepoint - 0x10000) & 0x3FF) + 0xDC00);
+                }
+                break;
+            }
+            }
+            unescaped = c + 1;
+        }
+        m_output.append(unescaped, end);
+        m_output += '"';
+    }
+
+    void WriteEscapedCodeUnit(unsigned int codeUnit)
+    {
+        static const char hexDigits[] = "0123456789abcdef";
+        const char escaped[] = {'\\',
+                                'u',
+                                hexDigits[(codeUnit >> 12) & 0xF],
+                                hexDigits[(codeUnit >> 8) & 0xF],
+                                hexDigits[(codeUnit >> 4) & 0xF],
+                                hexDigits[codeUnit & 0xF]};
+        m_output.append(escaped, sizeof(escaped));
+    }
+
+    // Decodes the UTF-8 sequence starting at s and leaves s on its last byte. Matches jsoncpp's decoding, including
+    // what it replaces with U+FFFD.
+    static unsigned int Utf8ToCodepoint(const char*& s, const char* e)
+    {
+        constexpr unsigned int replacementCharacter = 0xFFFD;
+        const unsigned int firstByte = static_cast<unsigned char>(*s);
+
+        if (firstByte < 0x80)
+        {
+            return firstByte;
+        }
+
+        if (firstByte < 0xE0)
+        {
+            if (e - s < 2)
+            {
+                return replacementCharacter;
+            }
+            const unsigned int calculated = ((firstByte & 0x1F) << 6) | (static_cast<unsigned int>(s[1]) & 0x3F);
+            s += 1;
+            return calculated < 0x80 ? replacementCharacter : calculated;
+        }
+
+        if (firstByte < 0xF0)
+        {
+            if (e - s < 3)
+            {
+                return replacementCharacter;
+            }
+            const unsigned int calculated = ((firstByte & 0x0F) << 12) |
+                                            ((static_cast<unsigned int>(s[1]) & 0x3F) << 6) |
+                                            (static_cast<unsigned int>(s[2]) & 0x3F);
+            s += 2;
+            if (calculated >= 0xD800 && calculated <= 0xDFFF)
+            {
+                return replacementCharacter;
+            }
+            return calculated < 0x800 ? replacementCharacter : calculated;
+        }
+
+        if (firstByte < 0xF8)
+        {
+            if (e - s < 4)
+            {
+                return replacementCharacter;
+            }
+            const unsigned int calculated = ((firstByte & 0x07) << 24) |
+                                            ((static_cast<unsigned int>(s[1]) & 0x3F) << 12) |
+                                            ((static_cast<unsigned int>(s[2]) & 0x3F) << 6) |
+                                            (static_cast<unsigned int>(s[3]) & 0x3F);
+            s += 3;
+            return calculated < 0x10000 ? replacementCharacter : calculated;
+        }
+
+        return replacementCharacter;
+    }
+
+    std::string& m_output;
+    std::ostream* m_stream;
+};
+
+[[noreturn]] void ThrowRequiredPropertyMissing(AdaptiveCards::AdaptiveCardSchemaKey key)
+{
+    throw AdaptiveCards::AdaptiveCardParseException(
+        AdaptiveCards::ErrorStatusCode::RequiredPropertyMissing,
+        "Property is required but was found empty: " + AdaptiveCardSchemaKeyToString(key));
+}
+
+[[noreturn]] void ThrowInvalidPropertyType(AdaptiveCards::AdaptiveCardSchemaKey key, const char* expectedType)
+{
+    throw AdaptiveCards::AdaptiveCardParseException(
+        AdaptiveCards::ErrorStatusCode::InvalidPropertyValue,
+        "Value for property " + AdaptiveCardSchemaKeyToString(key) + " was invalid. Expected type " + expectedType + ".");
+}
 
-    return builder;
+const Json::Value* FindTypeValue(const Json::Value& json)
+{
+    const char typeKey[] = "type";
+    return json.isObject() ? json.find(typeKey, typeKey + sizeof(typeKey) - 1) : nullptr;
 }
 } // namespace
 
@@ -25,13 +300,24 @@ namespace AdaptiveCards
 {
 std::string ParseUtil::JsonToString(const Json::Value& json)
 {
-    const thread_local Json::StreamWriterBuilder builder = ::CreateJsonStreamWriter();
-    std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
+    std::string output;
+    WriteJson(json, output);
+    output += '\n';
+    return output;
+}
 
-    std::ostringstream outStream;
-    writer->write(json, &outStream);
-    outStream << std::endl;
-    return outStream.str();
+void ParseUtil::WriteJson(const Json::Value& json, std::string& output)
+{
+    CompactJsonWriter(output).WriteValue(json);
+}
+
+void ParseUtil::WriteJson(const Json::Value& json, std::ostream& output)
+{
+    std::string buffer;
+    buffer.reserve(c_jsonStreamBufferSize);
+    CompactJsonWriter writer(buffer, &output);
+    writer.WriteValue(json);
+    writer.Flush();
 }
 
 void ParseUtil::ThrowIfNotJsonObject(const Json::Value& json)
@@ -44,56 +330,41 @@ void ParseUtil::ThrowIfNotJsonObject(const Json::Value& json)
 
 std::string ParseUtil::GetTypeAsString(const Json::Value& json)
 {
-    const char typeKey[] = "type";
-
-    if (!json.isMember(typeKey))
+    const Json::Value* typeValue = FindTypeValue(json);
+    if (typeValue == nullptr)
     {
-        std::stringstream ss;
-
-        ss << "The JSON element is missing the following value: ";
-        ss << typeKey;
+        throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing, "The JSON element is missing the following value: type");
+    }
 
-        throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing, ss.str());
+    if (typeValue->isArray() || typeValue->isObject())
+    {
+        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Value for property type was invalid. Expected type string.");
     }
 
-    return json.get(typeKey, Json::Value()).asString();
+    return typeValue->asString();
 }
 
 std::string ParseUtil::TryGetTypeAsString(const Json::Value& json)
 {
-    try
-    {
-        return GetTypeAsString(json);
-    }
-    catch (const AdaptiveCardParseException&)
-    {
-        return "";
-    }
+    const Json::Value* typeValue = FindTypeValue(json);
+    return (typeValue != nullptr && !typeValue->isArray() && !typeValue->isObject()) ? typeValue->asString() : std::string();
 }
 
+// Unlike GetString, doesn't throw if json isn't an object (but still throws if the value isn't a string).
 std::string ParseUtil::TryGetString(const Json::Value& json, AdaptiveCardSchemaKey key)
 {
-    try
-    {
-        return GetString(json, key);
-    }
-    catch (Json::Exception&)
-    {
-        return "";
-    }
+    return GetString(json, key);
 }
 
 // Get value mapped to key. Validates that value is string JSON type.
 std::string ParseUtil::GetString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
-    const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
-    if (propertyValue.empty())
+    const Json::Value* propertyValue = FindJsonValue(json, key);
+    if (propertyValue == nullptr || propertyValue->empty())
     {
         if (isRequired)
         {
-            throw AdaptiveCardParseException(
-                ErrorStatusCode::RequiredPropertyMissing, "Property is required but was found empty: " + propertyName);
+            ThrowRequiredPropertyMissing(key);
         }
         else
         {
@@ -101,14 +372,12 @@ std::string ParseUtil::GetString(const Json::Value& json, AdaptiveCardSchemaKey
         }
     }
 
-    if (!propertyValue.isString())
+    if (!propertyValue->isString())
     {
-        throw AdaptiveCardParseException(
-            ErrorStatusCode::InvalidPropertyValue,
-            "Value for property " + propertyName + " was invalid. Expected type string.");
+        ThrowInvalidPropertyType(key, "string");
     }
 
-    return propertyValue.asString();
+    return propertyValue->asString();
 }
 
 std::string ParseUtil::GetString(const Json::Value& json, AdaptiveCardSchemaKey key, const std::string& defaultValue, bool isRequired)
@@ -125,14 +394,14 @@ std::string ParseUtil::GetString(const Json::Value& json, AdaptiveCardSchemaKey
 
 std::string ParseUtil::GetJsonString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
-    const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
-    if (propertyValue.empty())
+    const Json::Value* propertyValue = FindJsonValue(json, key);
+    if (propertyValue == nullptr || propertyValue->empty())
     {
         if (isRequired)
         {
             throw AdaptiveCardParseException(
-                ErrorStatusCode::RequiredPropertyMissing, "Property is required but was found empty: " + propertyName);
+                ErrorStatusCode::RequiredPropertyMissing,
+                "Property is required but was found empty: " + AdaptiveCardSchemaKeyToString(key));
         }
         else
         {
@@ -140,20 +409,20 @@ std::string ParseUtil::GetJsonString(const Json::Value& json, AdaptiveCardSchema
         }
     }
 
-    return propertyValue.toStyledString();
+    return propertyValue->toStyledString();
 }
 
 // Get value mapped to key as a string, regardless of value's JSON type.
 std::string ParseUtil::GetValueAsString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
-    const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
-    if (propertyValue.empty())
+    const Json::Value* propertyValue = FindJsonValue(json, key);
+    if (propertyValue == nullptr || propertyValue->empty())
     {
         if (isRequired)
         {
             throw AdaptiveCardParseException(
-                ErrorStatusCode::RequiredPropertyMissing, "Property is required but was found empty: " + propertyName);
+                ErrorStatusCode::RequiredPropertyMissing,
+                "Property is required but was found empty: " + AdaptiveCardSchemaKeyToString(key));
         }
         else
         {
@@ -161,7 +430,7 @@ std::string ParseUtil::GetValueAsString(const Json::Value& json, AdaptiveCardSch
         }
     }
 
-    return propertyValue.asString();
+    return propertyValue->asString();
 }
 
 [[deprecated("Use generalized DeserializeValue<T> instead")]] std::shared_ptr<BackgroundImage> ParseUtil::GetBackgroundImage(const Json::Value& json)
@@ -171,50 +440,40 @@ std::string ParseUtil::GetValueAsString(const Json::Value& json, AdaptiveCardSch
 
 bool ParseUtil::GetBool(const Json::Value& json, AdaptiveCardSchemaKey key, bool defaultValue, bool isRequired)
 {
-    auto optionalBool = GetOptionalBool(json, key);
-
+    const std::optional<bool> optionalBool = GetOptionalBool(json, key);
     if (isRequired && !optionalBool.has_value())
     {
-        throw AdaptiveCardParseException(
-            ErrorStatusCode::RequiredPropertyMissing,
-            "Property is required but was found empty: " + AdaptiveCardSchemaKeyToString(key));
-    }
-    else
-    {
-        return optionalBool.value_or(defaultValue);
+        ThrowRequiredPropertyMissing(key);
     }
+
+    return optionalBool.value_or(defaultValue);
 }
 
 // Get optional boolean value at given key. Validates that value is bool type, if present.
 std::optional<bool> ParseUtil::GetOptionalBool(const Json::Value& json, AdaptiveCardSchemaKey key)
 {
-    const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
-    if (propertyValue.empty())
+    const Json::Value* propertyValue = FindJsonValue(json, key);
+    if (propertyValue == nullptr || propertyValue->empty())
     {
         return std::nullopt;
     }
 
-    if (!propertyValue.isBool())
+    if (!propertyValue->isBool())
     {
-        throw AdaptiveCardParseException(
-            ErrorStatusCode::InvalidPropertyValue,
-            "Value for property " + propertyName + " was invalid. Expected type bool.");
+        ThrowInvalidPropertyType(key, "bool");
     }
 
-    return propertyValue.asBool();
+    return propertyValue->asBool();
 }
 
 unsigned int ParseUtil::GetUInt(const Json::Value& json, AdaptiveCardSchemaKey key, unsigned int defaultValue, bool isRequired)
 {
-    const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
-    if (propertyValue.empty())
+    const Json::Value* propertyValue = FindJsonValue(json, key);
+    if (propertyValue == nullptr || propertyValue->empty())
     {
         if (isRequired)
         {
-            throw AdaptiveCardParseException(
-                ErrorStatusCode::RequiredPropertyMissing, "Property is required but was found empty: " + propertyName);
+            ThrowRequiredPropertyMissing(key);
         }
         else
         {
@@ -222,68 +481,55 @@ unsigned int ParseUtil::GetUInt(const Json::Value& json, AdaptiveCardSchemaKey k
         }
     }
 
-    if (!propertyValue.isUInt())
+    if (!propertyValue->isUInt())
     {
-        throw AdaptiveCardParseException(
-            ErrorStatusCode::InvalidPropertyValue,
-            "Value for property " + propertyName + " was invalid. Expected type uInt.");
+        ThrowInvalidPropertyType(key, "uInt");
     }
 
-    return propertyValue.asUInt();
+    return propertyValue->asUInt();
 }
 
 int ParseUtil::GetInt(const Json::Value& json, AdaptiveCardSchemaKey key, int defaultValue, bool isRequired)
 {
-    auto optionalInt = GetOptionalInt(json, key);
-
+    const std::optional<int> optionalInt = GetOptionalInt(json, key);
     if (isRequired && !optionalInt.has_value())
     {
-        throw AdaptiveCardParseException(
-            ErrorStatusCode::RequiredPropertyMissing,
-            "Property is required but was found empty: " + AdaptiveCardSchemaKeyToString(key));
-    }
-    else
-    {
-        return optionalInt.value_or(defaultValue);
+        ThrowRequiredPropertyMissing(key);
     }
+
+    return optionalInt.value_or(defaultValue);
 }
 
 std::optional<int> ParseUtil::GetOptionalInt(const Json::Value& json, AdaptiveCardSchemaKey key)
 {
-    const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
-    if (propertyValue.empty())
+    const Json::Value* propertyValue = FindJsonValue(json, key);
+    if (propertyValue == nullptr || propertyValue->empty())
     {
         return std::nullopt;
     }
 
-    if (!propertyValue.isInt())
+    if (!propertyValue->isInt())
     {
-        throw AdaptiveCardParseException(
-            ErrorStatusCode::InvalidPropertyValue,
-            "Value for property " + propertyName + " was invalid. Expected type int.");
+        ThrowInvalidPropertyType(key, "int");
     }
 
-    return propertyValue.asInt();
+    return propertyValue->asInt();
 }
 
 std::optional<double> ParseUtil::GetOptionalDouble(const Json::Value& json, AdaptiveCardSchemaKey key)
 {
-    const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
-    if (propertyValue.empty())
+    const Json::Value* propertyValue = FindJsonValue(json, key);
+    if (propertyValue == nullptr || propertyValue->empty())
     {
         return std::nullopt;
     }
 
-    if (!propertyValue.isDouble())
+    if (!propertyValue->isDouble())
     {
-        throw AdaptiveCardParseException(
-            ErrorStatusCode::InvalidPropertyValue,
-            "Value for property " + propertyName + " was invalid. Expected type double.");
+        ThrowInvalidPropertyType(key, "double");
     }
 
-    return propertyValue.asDouble();
+    return propertyValue->asDouble();
 }
 
 void ParseUtil::ExpectTypeString(const Json::Value& json, const std::string& expectedTypeStr)
@@ -317,27 +563,59 @@ void ParseUtil::ExpectKeyAndValueType(const Json::Value& json, const char* expec
             ErrorStatusCode::RequiredPropertyMissing, "The JSON element is missing the following key: " + std::string(expectedKey));
     }
 
-    auto value = json.get(expectedKey, Json::Value());
-    throwIfWrongType(value);
+    throwIfWrongType(json[expectedKey]);
 }
 
-Json::Value ParseUtil::GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+const Json::StaticString& AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey key)
 {
+    // Indexed by key. The handles point at the strings owned by the AdaptiveCardSchemaKey mapping, which lives as
+    // long as this table does. Keys without a mapping are left null.
+    static const std::vector<Json::StaticString> jsonKeys = []() {
+        const auto& entries = EnumHelpers::getAdaptiveCardSchemaKeyEnum().entries();
+        std::vector<Json::StaticString> keys(static_cast<size_t>(entries.back().first) + 1, Json::StaticString(nullptr));
+        for (const auto& entry : entries)
+        {
+            keys[static_cast<size_t>(entry.first)] = Json::StaticString(entry.second.c_str());
+        }
+        return keys;
+    }();
+
+    const auto index = static_cast<size_t>(key);
+    if (index >= jsonKeys.size() || jsonKeys[index].c_str() == nullptr)
+    {
+        throw std::out_of_range("Enum value has no string mapping");
+    }
+    return jsonKeys[index];
+}
+
+const Json::Value* ParseUtil::FindJsonValue(const Json::Value& json, AdaptiveCardSchemaKey key)
+{
+    if (!json.isObject())
+    {
+        return nullptr;
+    }
+
     const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto elementArray = json.get(propertyName, Json::Value());
+    return json.find(propertyName.data(), propertyName.data() + propertyName.size());
+}
+
+const Json::Value& ParseUtil::GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+{
+    const Json::Value* foundValue = FindJsonValue(json, key);
+    const Json::Value& elementArray = (foundValue != nullptr) ? *foundValue : Json::Value::nullSingleton();
 
     if (!elementArray.isNull() && !elementArray.isArray())
     {
         throw AdaptiveCardParseException(
             ErrorStatusCode::InvalidPropertyValue,
-            "Could not parse specified key: " + propertyName + ". It was not an array");
+            "Could not parse specified key: " + AdaptiveCardSchemaKeyToString(key) + ". It was not an array");
     }
 
     if (isRequired && elementArray.empty())
     {
         throw AdaptiveCardParseException(
             ErrorStatusCode::RequiredPropertyMissing,
-            "Could not parse required key: " + propertyName + ". It was not found");
+            "Could not parse required key: " + AdaptiveCardSchemaKeyToString(key) + ". It was not found");
     }
 
     return elementArray;
@@ -345,7 +623,7 @@ Json::Value ParseUtil::GetArray(const Json::Value& json, AdaptiveCardSchemaKey k
 
 std::vector<std::string> ParseUtil::GetStringArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
-    auto jsonArray = ParseUtil::GetArray(json, key, isRequired);
+    const auto& jsonArray = ParseUtil::GetArray(json, key, isRequired);
     std::vector<std::string> strings;
 
     strings.reserve(jsonArray.size());
@@ -375,14 +653,14 @@ Json::Value ParseUtil::GetJsonValueFromString(const std::string& jsonString)
     return jsonValue;
 }
 
-Json::Value ParseUtil::ExtractJsonValue(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+const Json::Value& ParseUtil::ExtractJsonValue(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
-    const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-    auto propertyValue = json.get(propertyName, Json::Value());
+    const Json::Value* foundValue = FindJsonValue(json, key);
+    const Json::Value& propertyValue = (foundValue != nullptr) ? *foundValue : Json::Value::nullSingleton();
     if (isRequired && propertyValue.empty())
     {
         throw AdaptiveCardParseException(
-            ErrorStatusCode::RequiredPropertyMissing, "Could not extract required key: " + propertyName + ".");
+            ErrorStatusCode::RequiredPropertyMissing, "Could not extract required key: " + AdaptiveCardSchemaKeyToString(key) + ".");
     }
     return propertyValue;
 }
@@ -406,17 +684,17 @@ std::shared_ptr<BaseActionElement> ParseUtil::GetActionFromJsonValue(ParseContex
     // Get the element's type
     std::string typeString = GetTypeAsString(json);
 
-    auto parser = context.actionParserRegistration->GetParser(typeString);
+    auto parser = context.actionParserRegistration->FindParser(typeString);
     if (parser == nullptr)
     {
-        parser = context.actionParserRegistration->GetParser("UnknownAction");
+        parser = context.actionParserRegistration->FindParser("UnknownAction");
     }
 
     // Parse it if it's allowed by the current parsers
     if (parser != nullptr)
     {
         // Use the parser that maps to the type
-        return parser->Deserialize(context, json);
+        return ActionElementParserWrapper::Deserialize(context, *parser, json);
     }
 
     return nullptr;
@@ -425,7 +703,7 @@ std::shared_ptr<BaseActionElement> ParseUtil::GetActionFromJsonValue(ParseContex
 std::vector<std::shared_ptr<BaseActionElement>> ParseUtil::GetActionCollection(
     ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
-    auto elementArray = GetArray(json, key, isRequired);
+    const auto& elementArray = GetArray(json, key, isRequired);
 
     std::vector<std::shared_ptr<BaseActionElement>> elements;
 
@@ -450,7 +728,7 @@ std::vector<std::shared_ptr<BaseActionElement>> ParseUtil::GetActionCollection(
 
 std::shared_ptr<BaseActionElement> ParseUtil::GetAction(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
 {
-    auto selectAction = ParseUtil::ExtractJsonValue(json, key, isRequired);
+    const auto& selectAction = ParseUtil::ExtractJsonValue(json, key, isRequired);
 
     if (!selectAction.empty())
     {
@@ -478,13 +756,13 @@ std::shared_ptr<BaseCardElement> ParseUtil::GetLabelFromJsonValue(ParseContext&
             ErrorStatusCode::InvalidPropertyValue, "Element type is not a string, TextBlock or RichTextBlock");
     }
 
-    auto parser = context.elementParserRegistration->GetParser(typeString);
+    auto parser = context.elementParserRegistration->FindParser(typeString);
 
     // Parse it if it's allowed by the current parsers
     if (parser != nullptr)
     {
         // Use the parser that maps to the type
-        return parser->Deserialize(context, json);
+        return BaseCardElementParserWrapper::Deserialize(context, *parser, json);
     }
 
     return nullptr;
@@ -492,7 +770,7 @@ std::shared_ptr<BaseCardElement> ParseUtil::GetLabelFromJsonValue(ParseContext&
 
 std::shared_ptr<BaseCardElement> ParseUtil::GetLabel(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key)
 {
-    auto label = ParseUtil::ExtractJsonValue(json, key);
+    const auto& label = ParseUtil::ExtractJsonValue(json, key);
 
     if (!label.empty())
     {
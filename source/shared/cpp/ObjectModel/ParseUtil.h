@@ -6,6 +6,7 @@
 #include "AdaptiveCardParseException.h"
 #include "BackgroundImage.h"
 #include "ParseContext.h"
+#include <type_traits>
 
 namespace AdaptiveCards
 {
@@ -15,10 +16,21 @@ class BaseActionElement;
 class BackgroundImage;
 class ParseContext;
 
+// Returns the JSON property name for key as a Json::StaticString. Serializers should use it to index Json::Values:
+// jsoncpp stores a StaticString key by pointer instead of copying the std::string that AdaptiveCardSchemaKeyToString
+// returns.
+const Json::StaticString& AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey key);
+
 namespace ParseUtil
 {
+    // Compact JSON followed by a newline
     std::string JsonToString(const Json::Value& json);
 
+    // Appends compact JSON, byte for byte what JsonToString returns without the newline. The stream is written to as
+    // the JSON is, through a small buffer, rather than once all of it has been.
+    void WriteJson(const Json::Value& json, std::string& output);
+    void WriteJson(const Json::Value& json, std::ostream& output);
+
     void ThrowIfNotJsonObject(const Json::Value& json);
 
     std::string GetTypeAsString(const Json::Value& json);
@@ -50,13 +62,19 @@ namespace ParseUtil
 
     std::optional<double> GetOptionalDouble(const Json::Value& json, AdaptiveCardSchemaKey key);
 
-    Json::Value GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
+    // Returns the value mapped to key without copying it, or nullptr if the key is not present or json is not an
+    // object.
+    const Json::Value* FindJsonValue(const Json::Value& json, AdaptiveCardSchemaKey key);
+
+    // GetArray and ExtractJsonValue return a reference into json (or to a shared null value if the key is missing),
+    // so the result must not outlive json. Bind the result to a value if a copy is needed.
+    const Json::Value& GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
 
     std::vector<std::string> GetStringArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
 
     Json::Value GetJsonValueFromString(const std::string& jsonString);
 
-    Json::Value ExtractJsonValue(const Json::Value& jsonRoot, AdaptiveCardSchemaKey key, bool isRequired = false);
+    const Json::Value& ExtractJsonValue(const Json::Value& jsonRoot, AdaptiveCardSchemaKey key, bool isRequired = false);
 
     template <typename T, typename Fn>
     std::optional<T> GetOptionalEnumValue(const Json::Value& json, AdaptiveCardSchemaKey key, Fn enumConverter);
@@ -124,28 +142,33 @@ namespace ParseUtil
 template <typename T, typename Fn>
 std::optional<T> ParseUtil::GetOptionalEnumValue(const Json::Value& json, AdaptiveCardSchemaKey key, Fn enumConverter)
 {
-    std::string propertyValueStr = "";
-    try
+    const Json::Value* propertyValue = FindJsonValue(json, key);
+    if (propertyValue == nullptr || propertyValue->empty())
     {
-        const std::string& propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto const& propertyValue = json.get(propertyName, Json::Value());
-        if (propertyValue.empty())
-        {
-            return std::nullopt;
-        }
+        return std::nullopt;
+    }
 
-        if (!propertyValue.isString())
-        {
-            throw AdaptiveCardParseException(
-                ErrorStatusCode::InvalidPropertyValue, "Enum type was invalid. Expected type string.");
-        }
+    if (!propertyValue->isString())
+    {
+        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Enum type was invalid. Expected type string.");
+    }
 
-        propertyValueStr = propertyValue.asString();
-        return enumConverter(propertyValueStr);
+    // The generated <Enum>TryFromString functions report an unknown value by returning an empty optional. Converters
+    // that return the enum itself (like <Enum>FromString) report it by throwing std::out_of_range, as they always have.
+    if constexpr (std::is_same_v<std::invoke_result_t<Fn&, const std::string&>, std::optional<T>>)
+    {
+        return enumConverter(propertyValue->asString());
     }
-    catch (const std::out_of_range&)
+    else
     {
-        return std::nullopt;
+        try
+        {
+            return enumConverter(propertyValue->asString());
+        }
+        catch (const std::out_of_range&)
+        {
+            return std::nullopt;
+        }
     }
 }
 
@@ -205,7 +228,7 @@ std::vector<std::shared_ptr<T>> ParseUtil::GetElementCollectionOfSingleType(
     const std::function<std::shared_ptr<T>(ParseContext& context, const Json::Value&)>& deserializer,
     bool isRequired)
 {
-    auto elementArray = GetArray(json, key, isRequired);
+    const auto& elementArray = GetArray(json, key, isRequired);
 
     std::vector<std::shared_ptr<T>> elements;
     if (elementArray.empty())
@@ -236,21 +259,14 @@ T ParseUtil::ExtractJsonValueAndMergeWithDefault(
     const T& defaultValue,
     const std::function<T(const Json::Value&, const T&)>& deserializer)
 {
-    T result = defaultValue;
-    try
-    {
-        auto jsonObject = ParseUtil::ExtractJsonValue(rootJson, key);
-        if (!jsonObject.empty())
-        {
-            result = deserializer(jsonObject, defaultValue);
-        }
-    }
-    catch (Json::Exception&)
+    // a missing value, or a rootJson that isn't an object, leaves the default in place
+    const Json::Value* jsonObject = FindJsonValue(rootJson, key);
+    if (jsonObject != nullptr && !jsonObject->empty())
     {
-        // value missing
+        return deserializer(*jsonObject, defaultValue);
     }
 
-    return result;
+    return defaultValue;
 }
 
 // Element [de]serialization
@@ -267,7 +283,7 @@ template <typename T>
 std::vector<std::shared_ptr<T>> ParseUtil::GetElementCollection(
     bool isTopToBottomContainer, ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired, const std::string& impliedType)
 {
-    auto elementArray = GetArray(json, key, isRequired);
+    const auto& elementArray = GetArray(json, key, isRequired);
 
     std::vector<std::shared_ptr<T>> elements;
     if (elementArray.empty())
@@ -281,7 +297,7 @@ std::vector<std::shared_ptr<T>> ParseUtil::GetElementCollection(
     const ContainerBleedDirection previousBleedState = context.GetBleedDirection();
 
     size_t currentIndex = 0;
-    for (auto& curJsonValue : elementArray)
+    for (const auto& curJsonValue : elementArray)
     {
         ContainerBleedDirection currentBleedState = previousBleedState;
 
@@ -303,22 +319,35 @@ std::vector<std::shared_ptr<T>> ParseUtil::GetElementCollection(
 
         context.PushBleedDirection(currentBleedState);
 
-        // If all items in this collection have the same implied type (i.e. Columns), verify
-        // that if set it is set correctly and set it if it isn't
-        if (!impliedType.empty())
+        std::shared_ptr<BaseElement> curElement;
+        if (impliedType.empty())
+        {
+            ParseJsonObject<T>(context, curJsonValue, curElement);
+        }
+        else
         {
-            const std::string typeString = ParseUtil::GetString(curJsonValue, AdaptiveCardSchemaKey::Type, impliedType, false);
-            if (typeString.compare(impliedType) != 0)
+            // If all items in this collection have the same implied type (i.e. Columns), verify
+            // that if set it is set correctly and set it if it isn't
+            const std::string typeString = ParseUtil::GetString(curJsonValue, AdaptiveCardSchemaKey::Type);
+            if (!typeString.empty() && typeString.compare(impliedType) != 0)
             {
                 throw AdaptiveCardParseException(
                     ErrorStatusCode::InvalidPropertyValue, "Unable to parse element of type " + typeString);
             }
 
-            curJsonValue[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = typeString;
+            if (typeString.empty())
+            {
+                // elementArray is borrowed from the caller, so only copy the element that needs its type filled in
+                Json::Value typedJsonValue = curJsonValue;
+                typedJsonValue[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Type)] = impliedType;
+                ParseJsonObject<T>(context, typedJsonValue, curElement);
+            }
+            else
+            {
+                ParseJsonObject<T>(context, curJsonValue, curElement);
+            }
         }
 
-        std::shared_ptr<BaseElement> curElement;
-        ParseJsonObject<T>(context, curJsonValue, curElement);
         elements.push_back(std::static_pointer_cast<T>(curElement));
 
         // restores the parent's bleed state
@@ -53,15 +53,15 @@ Json::Value Refresh::SerializeToJsonValue() const
 
     if (m_action != nullptr)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Action)] = m_action->SerializeToJsonValue();
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Action)] = m_action->SerializeToJsonValue();
     }
 
     if (!m_userIds.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::UserIds)] = Json::Value(Json::arrayValue);
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::UserIds)] = Json::Value(Json::arrayValue);
         for (std::string userId : m_userIds)
         {
-            root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::UserIds)].append(userId);
+            root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::UserIds)].append(userId);
         }
     }
 
@@ -24,11 +24,11 @@ Json::Value RichTextBlock::SerializeToJsonValue() const
 
     if (m_hAlignment.has_value())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment)] =
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::HorizontalAlignment)] =
             HorizontalAlignmentToString(m_hAlignment.value_or(HorizontalAlignment::Left));
     }
 
-    const std::string& inlinesPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Inlines);
+    const Json::StaticString& inlinesPropertyName = AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Inlines);
     root[inlinesPropertyName] = Json::Value(Json::arrayValue);
     for (const auto& currentInline : GetInlines())
     {
@@ -64,7 +64,7 @@ std::shared_ptr<BaseCardElement> RichTextBlockParser::Deserialize(ParseContext&
 
     std::shared_ptr<RichTextBlock> richTextBlock = BaseCardElement::Deserialize<RichTextBlock>(context, json);
     richTextBlock->SetHorizontalAlignment(ParseUtil::GetOptionalEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentFromString));
+        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentTryFromString));
 
     auto inlines = ParseUtil::GetElementCollectionOfSingleType<Inline>(
         context, json, AdaptiveCardSchemaKey::Inlines, Inline::Deserialize, false);
@@ -80,7 +80,9 @@ std::shared_ptr<BaseCardElement> RichTextBlockParser::DeserializeFromString(Pars
 
 void RichTextBlock::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Inlines)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::HorizontalAlignment,
+         AdaptiveCardSchemaKey::Inlines});
+    m_knownProperties = &knownProperties;
 }
@@ -20,17 +20,17 @@ Json::Value RichTextElementProperties::SerializeToJsonValue(Json::Value& root) c
     (void)TextElementProperties::SerializeToJsonValue(root);
     if (GetItalic())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Italic)] = true;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Italic)] = true;
     }
 
     if (GetStrikethrough())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Strikethrough)] = true;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Strikethrough)] = true;
     }
 
     if (GetUnderline())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Underline)] = true;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Underline)] = true;
     }
 
     return root;
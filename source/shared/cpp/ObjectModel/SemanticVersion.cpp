@@ -6,7 +6,33 @@
 
 using namespace AdaptiveCards;
 
-SemanticVersion::SemanticVersion(const std::string& version) : _major(0), _minor(0), _build(0), _revision(0)
+namespace
+{
+// parses a run of digits matched by the version regex; fails if it doesn't fit in an int
+bool ParseVersionPart(const std::ssub_match& match, unsigned int& part)
+{
+    int value = 0;
+    const auto result = std::from_chars(&*match.first, &*match.first + match.length(), value);
+    if (result.ec != std::errc())
+    {
+        return false;
+    }
+    part = static_cast<unsigned int>(value);
+    return true;
+}
+} // namespace
+
+SemanticVersion::SemanticVersion(const std::string& version)
+{
+    const auto parsedVersion = TryParse(version);
+    if (!parsedVersion.has_value())
+    {
+        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Semantic version invalid: " + version);
+    }
+    *this = *parsedVersion;
+}
+
+std::optional<SemanticVersion> SemanticVersion::TryParse(const std::string& version)
 {
     // valid:
     // "1"
@@ -19,52 +45,42 @@ SemanticVersion::SemanticVersion(const std::string& version) : _major(0), _minor
     // "1."
     // "F"
 
-    bool versionValid = false;
 #pragma warning(push)
 #pragma warning(disable : 26426)
     // disable spurious warning (Global initializer calls a non-constexpr function.) -- this isn't global
     static const std::regex versionMatch(R"regex(^([\d]+)(?:\.([\d]+))?(?:\.([\d]+))?(?:\.([\d]+))?$)regex");
 #pragma warning(pop)
     std::smatch subMatches;
-    if (std::regex_match(version, subMatches, versionMatch))
+    if (!std::regex_match(version, subMatches, versionMatch))
     {
-        versionValid = true;
-        // subMatches[0] contains the entire string, so no need to refer to it here
-
-        try
-        {
-            // subMatches[1] contains the major version
-            if (subMatches[1].matched)
-            {
-                _major = std::stoi(subMatches[1]);
-            }
+        return std::nullopt;
+    }
 
-            if (subMatches[2].matched)
-            {
-                // subMatches[2] contains the minor version
-                _minor = std::stoi(subMatches[2]);
-            }
+    // subMatches[0] contains the entire string, so no need to refer to it here
+    // subMatches[1] contains the major version, which the regex requires
+    SemanticVersion parsedVersion;
+    if (!ParseVersionPart(subMatches[1], parsedVersion._major))
+    {
+        return std::nullopt;
+    }
 
-            if (subMatches[3].matched)
-            {
-                // subMatches[3] contains the build version
-                _build = std::stoi(subMatches[3]);
-            }
+    // subMatches[2] contains the minor version
+    if (subMatches[2].matched && !ParseVersionPart(subMatches[2], parsedVersion._minor))
+    {
+        return std::nullopt;
+    }
 
-            if (subMatches[4].matched)
-            {
-                // subMatches[4] contains the revision
-                _revision = std::stoi(subMatches[4]);
-            }
-        }
-        catch (const std::out_of_range&)
-        {
-            versionValid = false;
-        }
+    // subMatches[3] contains the build version
+    if (subMatches[3].matched && !ParseVersionPart(subMatches[3], parsedVersion._build))
+    {
+        return std::nullopt;
     }
 
-    if (!versionValid)
+    // subMatches[4] contains the revision
+    if (subMatches[4].matched && !ParseVersionPart(subMatches[4], parsedVersion._revision))
     {
-        throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Semantic version invalid: " + version);
+        return std::nullopt;
     }
+
+    return parsedVersion;
 }
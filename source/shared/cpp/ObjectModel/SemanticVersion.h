@@ -11,6 +11,9 @@ class SemanticVersion
 public:
     SemanticVersion(const std::string& version);
 
+    // Like the constructor, but returns an empty optional rather than throwing if version is invalid
+    static std::optional<SemanticVersion> TryParse(const std::string& version);
+
     unsigned int GetMajor() const
     {
         return _major;
@@ -36,6 +39,8 @@ public:
     }
 
 private:
+    SemanticVersion() : _major(0), _minor(0), _build(0), _revision(0) {}
+
     unsigned int _major;
     unsigned int _minor;
     unsigned int _build;
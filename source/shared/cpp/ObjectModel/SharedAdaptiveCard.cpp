@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "SharedAdaptiveCard.h"
+#include "ElementVisitor.h"
 #include "ParseUtil.h"
 #include "Util.h"
 #include "ShowCardAction.h"
@@ -10,6 +11,7 @@
 #include "SemanticVersion.h"
 #include "ParseContext.h"
 #include "BackgroundImage.h"
+#include "CardBinaryFormat.h"
 
 using namespace AdaptiveCards;
 
@@ -64,7 +66,6 @@ AdaptiveCard::AdaptiveCard(
     m_language(language), m_verticalContentAlignment(verticalContentAlignment), m_height(height),
     m_minHeight(minHeight), m_internalId{InternalId::Next()}, m_additionalProperties{}
 {
-    PopulateKnownPropertiesSet();
 }
 
 AdaptiveCard::AdaptiveCard(
@@ -116,7 +117,6 @@ AdaptiveCard::AdaptiveCard(
     m_verticalContentAlignment(verticalContentAlignment), m_height(height),
     m_minHeight(minHeight), m_internalId{InternalId::Next()}, m_body(body), m_actions(actions), m_additionalProperties{}
 {
-    PopulateKnownPropertiesSet();
 }
 
 #ifdef __ANDROID__
@@ -173,6 +173,12 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(
 #else
 std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json, const std::string& rendererVersion, ParseContext& context)
 #endif // __ANDROID__
+{
+    auto card = DeserializeCard(json, rendererVersion, context);
+    return std::make_shared<ParseResult>(card, context.warnings);
+}
+
+std::shared_ptr<AdaptiveCard> AdaptiveCard::DeserializeCard(const Json::Value& json, const std::string& rendererVersion, ParseContext& context)
 {
     ParseUtil::ThrowIfNotJsonObject(json);
 
@@ -218,7 +224,7 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
 
             context.warnings.push_back(std::make_shared<AdaptiveCardParseWarning>(
                 AdaptiveCards::WarningStatusCode::UnsupportedSchemaVersion, "Schema version not supported"));
-            return std::make_shared<ParseResult>(MakeFallbackTextCard(fallbackText, language, speak), context.warnings);
+            return MakeFallbackTextCard(fallbackText, language, speak);
         }
     }
 
@@ -229,13 +235,13 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
         context, json, AdaptiveCardSchemaKey::Authentication, Authentication::Deserialize);
 
     ContainerStyle style =
-        ParseUtil::GetEnumValue<ContainerStyle>(json, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleFromString);
+        ParseUtil::GetEnumValue<ContainerStyle>(json, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleTryFromString);
     context.SetParentalContainerStyle(style);
 
     VerticalContentAlignment verticalContentAlignment = ParseUtil::GetEnumValue<VerticalContentAlignment>(
-        json, AdaptiveCardSchemaKey::VerticalContentAlignment, VerticalContentAlignment::Top, VerticalContentAlignmentFromString);
+        json, AdaptiveCardSchemaKey::VerticalContentAlignment, VerticalContentAlignment::Top, VerticalContentAlignmentTryFromString);
     HeightType height =
-        ParseUtil::GetEnumValue<HeightType>(json, AdaptiveCardSchemaKey::Height, HeightType::Auto, HeightTypeFromString);
+        ParseUtil::GetEnumValue<HeightType>(json, AdaptiveCardSchemaKey::Height, HeightType::Auto, HeightTypeTryFromString);
 
     unsigned int minHeight =
         ParseSizeForPixelSize(ParseUtil::GetString(json, AdaptiveCardSchemaKey::MinHeight), &context.warnings).value_or(0);
@@ -255,11 +261,14 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
     // Parse optional selectAction
     result->SetSelectAction(ParseUtil::GetAction(context, json, AdaptiveCardSchemaKey::SelectAction, false));
 
+    result->m_idIndex.index.Build(*result);
+    result->m_idIndex.isBuilt = true;
+
     Json::Value additionalProperties;
     HandleUnknownProperties(json, result->GetKnownProperties(), additionalProperties);
-    result->SetAdditionalProperties(additionalProperties);
+    result->SetAdditionalProperties(std::move(additionalProperties));
 
-    return std::make_shared<ParseResult>(result, context.warnings);
+    return result;
 }
 
 #ifdef __ANDROID__
@@ -283,78 +292,99 @@ std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromString(const std::stri
     return AdaptiveCard::Deserialize(ParseUtil::GetJsonValueFromString(jsonString), rendererVersion, context);
 }
 
+#ifdef __ANDROID__
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromBinary(const std::vector<char>& data) throw(AdaptiveCards::AdaptiveCardParseException)
+#else
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromBinary(const std::vector<char>& data)
+#endif // __ANDROID__
+{
+    ParseContext context;
+    return AdaptiveCard::DeserializeFromBinary(data.data(), data.size(), context);
+}
+
+#ifdef __ANDROID__
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromBinary(
+    const char* data, size_t size, ParseContext& context) throw(AdaptiveCards::AdaptiveCardParseException)
+#else
+std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromBinary(const char* data, size_t size, ParseContext& context)
+#endif // __ANDROID__
+{
+    auto card = DeserializeCardFromBinary(data, size, context);
+    return std::make_shared<ParseResult>(card, context.warnings);
+}
+
 Json::Value AdaptiveCard::SerializeToJsonValue() const
 {
     Json::Value root = GetAdditionalProperties();
-    root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = CardElementTypeToString(CardElementType::AdaptiveCard);
+    root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Type)] = CardElementTypeToString(CardElementType::AdaptiveCard);
 
     if (!m_version.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Version)] = m_version;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Version)] = m_version;
     }
     else
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Version)] = "1.0";
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Version)] = "1.0";
     }
 
     if (!m_fallbackText.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FallbackText)] = m_fallbackText;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::FallbackText)] = m_fallbackText;
     }
     if (m_backgroundImage != nullptr && m_backgroundImage->ShouldSerialize())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundImage)] = m_backgroundImage->SerializeToJsonValue();
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::BackgroundImage)] = m_backgroundImage->SerializeToJsonValue();
     }
     if (m_refresh != nullptr && m_refresh->ShouldSerialize())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Refresh)] = m_refresh->SerializeToJsonValue();
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Refresh)] = m_refresh->SerializeToJsonValue();
     }
     if (m_authentication != nullptr && m_authentication->ShouldSerialize())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Authentication)] = m_authentication->SerializeToJsonValue();
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Authentication)] = m_authentication->SerializeToJsonValue();
     }
     if (!m_speak.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Speak)] = m_speak;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Speak)] = m_speak;
     }
     if (!m_language.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Language)] = m_language;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Language)] = m_language;
     }
     if (m_style != ContainerStyle::None)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style)] = ContainerStyleToString(m_style);
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Style)] = ContainerStyleToString(m_style);
     }
     if (m_verticalContentAlignment != VerticalContentAlignment::Top)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment)] =
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::VerticalContentAlignment)] =
             VerticalContentAlignmentToString(m_verticalContentAlignment);
     }
 
     if (m_minHeight)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MinHeight)] = std::to_string(GetMinHeight()) + "px";
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::MinHeight)] = std::to_string(GetMinHeight()) + "px";
     }
 
     if (m_rtl.has_value())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl)] = m_rtl.value_or("");
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Rtl)] = m_rtl.value_or("");
     }
 
     const HeightType height = GetHeight();
     if (height != HeightType::Auto)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height)] = HeightTypeToString(GetHeight());
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Height)] = HeightTypeToString(GetHeight());
     }
 
-    const std::string& bodyPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Body);
+    const Json::StaticString& bodyPropertyName = AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Body);
     root[bodyPropertyName] = Json::Value(Json::arrayValue);
     for (const auto& cardElement : GetBody())
     {
         root[bodyPropertyName].append(cardElement->SerializeToJsonValue());
     }
 
-    const std::string& actionsPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions);
+    const Json::StaticString& actionsPropertyName = AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Actions);
     root[actionsPropertyName] = Json::Value(Json::arrayValue);
     for (const auto& action : GetActions())
     {
@@ -389,6 +419,23 @@ std::string AdaptiveCard::Serialize() const
     return ParseUtil::JsonToString(SerializeToJsonValue());
 }
 
+void AdaptiveCard::SerializeTo(std::string& buffer) const
+{
+    ParseUtil::WriteJson(SerializeToJsonValue(), buffer);
+    buffer += '\n';
+}
+
+void AdaptiveCard::SerializeTo(std::ostream& stream) const
+{
+    ParseUtil::WriteJson(SerializeToJsonValue(), stream);
+    stream << '\n';
+}
+
+std::vector<char> AdaptiveCard::SerializeToBinary() const
+{
+    return SerializeCardToBinary(*this);
+}
+
 std::string AdaptiveCard::GetVersion() const
 {
     return m_version;
@@ -514,6 +561,48 @@ void AdaptiveCard::SetSelectAction(const std::shared_ptr<BaseActionElement> acti
     m_selectAction = action;
 }
 
+std::shared_ptr<BaseElement> AdaptiveCard::GetElementById(const std::string& id) const
+{
+    std::lock_guard<std::mutex> lock(m_idIndex.mutex);
+    if (m_idIndex.isBuilt)
+    {
+        if (auto element = m_idIndex.index.Find(*this, id))
+        {
+            return element;
+        }
+    }
+
+    // the element may have been added, moved or given the id since the index was built
+    m_idIndex.index.Build(*this);
+    m_idIndex.isBuilt = true;
+    return m_idIndex.index.Find(*this, id);
+}
+
+ElementIdIndex AdaptiveCard::GetIdIndex() const
+{
+    ElementIdIndex index;
+    index.Build(*this);
+    return index;
+}
+
+AdaptiveCard::IdIndexState::IdIndexState(const IdIndexState& other)
+{
+    std::lock_guard<std::mutex> lock(other.mutex);
+    index = other.index;
+    isBuilt = other.isBuilt;
+}
+
+AdaptiveCard::IdIndexState& AdaptiveCard::IdIndexState::operator=(const IdIndexState& other)
+{
+    if (this != &other)
+    {
+        std::scoped_lock lock(mutex, other.mutex);
+        index = other.index;
+        isBuilt = other.isBuilt;
+    }
+    return *this;
+}
+
 VerticalContentAlignment AdaptiveCard::GetVerticalContentAlignment() const
 {
     return m_verticalContentAlignment;
@@ -545,30 +634,27 @@ void AdaptiveCard::SetRtl(const std::optional<bool>& value)
     m_rtl = value;
 }
 
-void AdaptiveCard::PopulateKnownPropertiesSet()
-{
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Version),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Body),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FallbackText),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundImage),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Refresh),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Authentication),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MinHeight),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Speak),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Language),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Schema)});
-}
-
 const std::unordered_set<std::string>& AdaptiveCard::GetKnownProperties() const
 {
-    return m_knownProperties;
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        {},
+        {AdaptiveCardSchemaKey::Type,
+         AdaptiveCardSchemaKey::Version,
+         AdaptiveCardSchemaKey::Body,
+         AdaptiveCardSchemaKey::Actions,
+         AdaptiveCardSchemaKey::FallbackText,
+         AdaptiveCardSchemaKey::BackgroundImage,
+         AdaptiveCardSchemaKey::Refresh,
+         AdaptiveCardSchemaKey::Authentication,
+         AdaptiveCardSchemaKey::MinHeight,
+         AdaptiveCardSchemaKey::Speak,
+         AdaptiveCardSchemaKey::Language,
+         AdaptiveCardSchemaKey::VerticalContentAlignment,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::SelectAction,
+         AdaptiveCardSchemaKey::Height,
+         AdaptiveCardSchemaKey::Schema});
+    return knownProperties;
 }
 
 const Json::Value& AdaptiveCard::GetAdditionalProperties() const
@@ -587,26 +673,7 @@ void AdaptiveCard::SetAdditionalProperties(const Json::Value& value)
 
 std::vector<RemoteResourceInformation> AdaptiveCard::GetResourceInformation()
 {
-    auto resourceVector = std::vector<RemoteResourceInformation>();
-
-    auto backgroundImage = GetBackgroundImage();
-    if (backgroundImage != nullptr)
-    {
-        RemoteResourceInformation backgroundImageInfo;
-        backgroundImageInfo.url = backgroundImage->GetUrl();
-        backgroundImageInfo.mimeType = "image";
-        resourceVector.push_back(backgroundImageInfo);
-    }
-
-    for (auto item : m_body)
-    {
-        item->GetResourceInformation(resourceVector);
-    }
-
-    for (auto item : m_actions)
-    {
-        item->GetResourceInformation(resourceVector);
-    }
-
+    std::vector<RemoteResourceInformation> resourceVector;
+    CollectResourceInformation(*this, resourceVector);
     return resourceVector;
 }
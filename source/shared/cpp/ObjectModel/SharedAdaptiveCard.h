@@ -8,6 +8,7 @@
 #include "ParseResult.h"
 #include "Refresh.h"
 #include "Authentication.h"
+#include "ElementIdIndex.h"
 
 namespace AdaptiveCards
 {
@@ -16,6 +17,8 @@ class BackgroundImage;
 
 class AdaptiveCard
 {
+    friend class ShowCardActionParser;
+
 public:
     AdaptiveCard();
 
@@ -115,6 +118,17 @@ public:
     std::vector<std::shared_ptr<BaseActionElement>>& GetActions();
     const std::vector<std::shared_ptr<BaseActionElement>>& GetActions() const;
 
+    // Finds an element or action of this card by id without walking the card; fallback content is only found
+    // through GetIdIndex().FindAll. Elements in the card of an Action.ShowCard are found through that card.
+    //
+    // The index is built when the card is parsed, or by the first lookup on a card that was built otherwise. Changes
+    // to the card don't have to be reported: an element found through the index is checked to still be where it was,
+    // with the id, in time proportional to how deeply it's nested. A lookup that finds nothing rebuilds the index and
+    // looks again, so looking up an id the card doesn't have walks the card.
+    std::shared_ptr<BaseElement> GetElementById(const std::string& id) const;
+    // An index of the card as it is now
+    ElementIdIndex GetIdIndex() const;
+
     const std::unordered_set<std::string>& GetKnownProperties() const;
     const Json::Value& GetAdditionalProperties() const;
     void SetAdditionalProperties(Json::Value&& additionalProperties);
@@ -139,6 +153,10 @@ public:
         const std::string& jsonString, std::string rendererVersion) throw(AdaptiveCards::AdaptiveCardParseException);
     static std::shared_ptr<AdaptiveCard> MakeFallbackTextCard(
         const std::string& fallbackText, const std::string& language, const std::string& speak) throw(AdaptiveCards::AdaptiveCardParseException);
+
+    static std::shared_ptr<ParseResult> DeserializeFromBinary(
+        const char* data, size_t size, ParseContext& context) throw(AdaptiveCards::AdaptiveCardParseException);
+    static std::shared_ptr<ParseResult> DeserializeFromBinary(const std::vector<char>& data) throw(AdaptiveCards::AdaptiveCardParseException);
 #else
     static std::shared_ptr<ParseResult> DeserializeFromFile(const std::string& jsonFile, const std::string& rendererVersion, ParseContext& context);
     static std::shared_ptr<ParseResult> DeserializeFromFile(const std::string& jsonFile, const std::string& rendererVersion);
@@ -151,9 +169,20 @@ public:
     static std::shared_ptr<AdaptiveCard> MakeFallbackTextCard(
         const std::string& fallbackText, const std::string& language, const std::string& speak);
 
+    // Loads a card written by SerializeToBinary (see CardBinaryFormat.h). Elements stored as JSON are parsed with the
+    // parsers registered on the context.
+    static std::shared_ptr<ParseResult> DeserializeFromBinary(const char* data, size_t size, ParseContext& context);
+    static std::shared_ptr<ParseResult> DeserializeFromBinary(const std::vector<char>& data);
+
 #endif // __ANDROID__
     Json::Value SerializeToJsonValue() const;
     std::string Serialize() const;
+    // Appends what Serialize returns to a caller's buffer or stream, so the buffer can be reused across cards. The card
+    // is still built as a Json::Value (SerializeToJsonValue) first; only writing that out as text is saved.
+    void SerializeTo(std::string& buffer) const;
+    void SerializeTo(std::ostream& stream) const;
+    // A compact binary encoding of the card that DeserializeFromBinary loads without going through JSON
+    std::vector<char> SerializeToBinary() const;
 
     const InternalId GetInternalId() const
     {
@@ -161,8 +190,10 @@ public:
     }
 
 private:
+    // Deserialize without the ParseResult; warnings are left in context.warnings. Used for nested cards, whose
+    // warnings belong to the card they are nested in.
+    static std::shared_ptr<AdaptiveCard> DeserializeCard(const Json::Value& json, const std::string& rendererVersion, ParseContext& context);
     static void _ValidateLanguage(const std::string& language, std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& warnings);
-    void PopulateKnownPropertiesSet();
 
     std::string m_version;
     std::string m_fallbackText;
@@ -177,12 +208,25 @@ private:
     unsigned int m_minHeight;
     std::optional<bool> m_rtl;
     InternalId m_internalId;
-    std::unordered_set<std::string> m_knownProperties;
     Json::Value m_additionalProperties;
 
     std::vector<std::shared_ptr<BaseCardElement>> m_body;
     std::vector<std::shared_ptr<BaseActionElement>> m_actions;
 
     std::shared_ptr<BaseActionElement> m_selectAction;
+
+    // Lookups are const and may run on several threads at once, so they take the lock to rebuild the index or read it
+    struct IdIndexState
+    {
+        IdIndexState() = default;
+        IdIndexState(const IdIndexState& other);
+        IdIndexState& operator=(const IdIndexState& other);
+
+        mutable std::mutex mutex;
+        ElementIdIndex index;
+        bool isBuilt = false;
+    };
+
+    mutable IdIndexState m_idIndex;
 };
 } // namespace AdaptiveCards
@@ -4,10 +4,63 @@
 #include "SharedAdaptiveCard.h"
 #include "ParseUtil.h"
 #include "ShowCardAction.h"
+#include "ElementVisitor.h"
 #include "ParseContext.h"
+#include "Util.h"
 
 using namespace AdaptiveCards;
 
+// What it takes to parse a deferred card later on, as it would have been parsed along with its action
+struct ShowCardAction::DeferredCard
+{
+    Json::Value json;
+    std::shared_ptr<ElementParserRegistration> elementParserRegistration;
+    std::shared_ptr<ActionParserRegistration> actionParserRegistration;
+    // the arena of the parse that deferred the card may be in use by another parse by now, so the card gets its own
+    bool usesArena = false;
+
+    // guards everything below; isParsed can also be read without it
+    std::mutex mutex;
+    std::string language;
+    std::string version;
+    std::atomic<bool> isParsed{false};
+    std::shared_ptr<AdaptiveCard> card;
+    std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
+
+    // if this throws, the card stays unparsed and the next call tries again
+    void ParseIfNeeded()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!isParsed)
+        {
+            Parse();
+        }
+    }
+
+private:
+    void Parse()
+    {
+        ParseContext context(elementParserRegistration, actionParserRegistration);
+        context.SetLanguage(language);
+        if (usesArena)
+        {
+            context.SetArena(std::make_shared<ParseArena>());
+        }
+        context.SetDeferShowCardParsing(true);
+
+        const auto parseResult = AdaptiveCard::Deserialize(json, "", context);
+        card = parseResult->GetAdaptiveCard();
+        if (card->GetVersion().empty())
+        {
+            card->SetVersion(version);
+        }
+        warnings = parseResult->GetWarnings();
+
+        json = Json::Value();
+        isParsed = true;
+    }
+};
+
 ShowCardAction::ShowCardAction() : BaseActionElement(ActionType::ShowCard)
 {
     PopulateKnownPropertiesSet();
@@ -17,42 +70,113 @@ Json::Value ShowCardAction::SerializeToJsonValue() const
 {
     Json::Value root = BaseActionElement::SerializeToJsonValue();
 
-    root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card)] = GetCard()->SerializeToJsonValue();
+    root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Card)] = GetCard()->SerializeToJsonValue();
 
     return root;
 }
 
 std::shared_ptr<AdaptiveCard> ShowCardAction::GetCard() const
 {
+    if (m_deferredCard)
+    {
+        m_deferredCard->ParseIfNeeded();
+        return m_deferredCard->card;
+    }
     return m_card;
 }
 
 void ShowCardAction::SetCard(const std::shared_ptr<AdaptiveCard> card)
 {
     m_card = card;
+    m_deferredCard.reset();
+}
+
+bool ShowCardAction::IsCardParsed() const
+{
+    return !m_deferredCard || m_deferredCard->isParsed;
+}
+
+std::vector<std::shared_ptr<AdaptiveCardParseWarning>> ShowCardAction::GetCardWarnings() const
+{
+    if (m_deferredCard)
+    {
+        GetCard();
+        return m_deferredCard->warnings;
+    }
+    return {};
 }
 
 void ShowCardAction::SetLanguage(const std::string& value)
 {
     // If the card inside doesn't specify language, propagate
-    if (m_card->GetLanguage().empty())
+    if (m_deferredCard)
+    {
+        // under the parse's lock, so the value is either picked up by the parse or applied to the card it produced
+        std::lock_guard<std::mutex> lock(m_deferredCard->mutex);
+        if (!m_deferredCard->isParsed)
+        {
+            m_deferredCard->language = value;
+        }
+        else if (m_deferredCard->card->GetLanguage().empty())
+        {
+            m_deferredCard->card->SetLanguage(value);
+        }
+    }
+    else if (m_card->GetLanguage().empty())
     {
         m_card->SetLanguage(value);
     }
 }
 
-std::shared_ptr<BaseActionElement> ShowCardActionParser::Deserialize(ParseContext& context, const Json::Value& json)
+void ShowCardAction::SetVersion(const std::string& value)
 {
-    std::shared_ptr<ShowCardAction> showCardAction = BaseActionElement::Deserialize<ShowCardAction>(context, json);
+    // If the card inside doesn't specify a version, propagate
+    if (m_deferredCard)
+    {
+        // under the parse's lock, so the value is either picked up by the parse or applied to the card it produced
+        std::lock_guard<std::mutex> lock(m_deferredCard->mutex);
+        if (!m_deferredCard->isParsed)
+        {
+            m_deferredCard->version = value;
+        }
+        else if (m_deferredCard->card->GetVersion().empty())
+        {
+            m_deferredCard->card->SetVersion(value);
+        }
+    }
+    else if (m_card->GetVersion().empty())
+    {
+        m_card->SetVersion(value);
+    }
+}
 
-    const std::string& propertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card);
+void ShowCardAction::DeferCard(const ParseContext& context, const Json::Value& json)
+{
+    m_deferredCard = std::make_shared<DeferredCard>();
+    m_deferredCard->json = json;
+    m_deferredCard->elementParserRegistration = context.elementParserRegistration;
+    m_deferredCard->actionParserRegistration = context.actionParserRegistration;
+    m_deferredCard->usesArena = context.GetArena() != nullptr;
+    m_deferredCard->language = context.GetLanguage();
+    m_card.reset();
+}
 
-    auto parseResult = AdaptiveCard::Deserialize(json.get(propertyName, Json::Value()), "", context);
+std::shared_ptr<BaseActionElement> ShowCardActionParser::Deserialize(ParseContext& context, const Json::Value& json)
+{
+    std::shared_ptr<ShowCardAction> showCardAction = BaseActionElement::Deserialize<ShowCardAction>(context, json);
 
-    auto showCardWarnings = parseResult->GetWarnings();
-    auto warningsEnd = context.warnings.insert(context.warnings.end(), showCardWarnings.begin(), showCardWarnings.end());
+    if (context.GetDeferShowCardParsing())
+    {
+        // fail on a missing card now, as parsing it along with the action would
+        const Json::Value& cardJson = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Card);
+        ParseUtil::ThrowIfNotJsonObject(cardJson);
+        showCardAction->DeferCard(context, cardJson);
+        return showCardAction;
+    }
 
-    showCardAction->SetCard(parseResult->GetAdaptiveCard());
+    // the card's warnings go straight into context.warnings, once
+    showCardAction->SetCard(
+        AdaptiveCard::DeserializeCard(ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Card), "", context));
 
     return showCardAction;
 }
@@ -64,13 +188,13 @@ std::shared_ptr<BaseActionElement> ShowCardActionParser::DeserializeFromString(P
 
 void ShowCardAction::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Card});
+    m_knownProperties = &knownProperties;
 }
 
 void ShowCardAction::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
 {
-    auto card = GetCard();
-    auto showCardResources = card->GetResourceInformation();
-    auto resourceInfoEnd = resourceInfo.insert(resourceInfo.end(), showCardResources.begin(), showCardResources.end());
-    return;
+    CollectResourceInformation(*this, resourceInfo);
 }
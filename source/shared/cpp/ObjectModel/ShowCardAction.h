@@ -11,6 +11,8 @@ namespace AdaptiveCards
 {
 class ShowCardAction : public BaseActionElement
 {
+    friend class ShowCardActionParser;
+
 public:
     ShowCardAction();
     ShowCardAction(const ShowCardAction&) = default;
@@ -21,17 +23,32 @@ public:
 
     Json::Value SerializeToJsonValue() const override;
 
+    // If the card was deferred (see ParseContext::SetDeferShowCardParsing), the first call parses it and throws
+    // AdaptiveCardParseException if that fails. Safe to call from several threads at once.
     std::shared_ptr<AdaptiveCards::AdaptiveCard> GetCard() const;
     void SetCard(const std::shared_ptr<AdaptiveCards::AdaptiveCard>);
 
+    // False only while a deferred card is waiting to be parsed
+    bool IsCardParsed() const;
+
+    // Warnings raised when a deferred card was parsed; parses it if it hasn't been yet. Warnings of a card that was
+    // parsed along with its action are reported through that parse instead.
+    std::vector<std::shared_ptr<AdaptiveCardParseWarning>> GetCardWarnings() const;
+
     void SetLanguage(const std::string& value);
+    void SetVersion(const std::string& value);
 
     void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo) override;
 
 private:
+    struct DeferredCard;
+
     void PopulateKnownPropertiesSet();
+    void DeferCard(const ParseContext& context, const Json::Value& json);
 
     std::shared_ptr<AdaptiveCard> m_card;
+    // set instead of m_card while the card is deferred; shared by copies of this action
+    std::shared_ptr<DeferredCard> m_deferredCard;
 };
 
 class ShowCardActionParser : public ActionElementParser
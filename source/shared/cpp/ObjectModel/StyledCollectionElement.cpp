@@ -131,34 +131,34 @@ Json::Value StyledCollectionElement::SerializeToJsonValue() const
 
     if (m_selectAction != nullptr)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction)] =
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::SelectAction)] =
             BaseCardElement::SerializeSelectAction(m_selectAction);
     }
 
     if (m_backgroundImage != nullptr && !m_backgroundImage->GetUrl().empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundImage)] = m_backgroundImage->SerializeToJsonValue();
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::BackgroundImage)] = m_backgroundImage->SerializeToJsonValue();
     }
 
     if (GetStyle() != ContainerStyle::None)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style)] = ContainerStyleToString(GetStyle());
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Style)] = ContainerStyleToString(GetStyle());
     }
 
     if (GetVerticalContentAlignment().has_value())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment)] =
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::VerticalContentAlignment)] =
             VerticalContentAlignmentToString(GetVerticalContentAlignment().value_or(VerticalContentAlignment::Top));
     }
 
     if (GetBleed())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Bleed)] = true;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Bleed)] = true;
     }
 
     if (m_minHeight)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MinHeight)] = std::to_string(GetMinHeight()) + "px";
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::MinHeight)] = std::to_string(GetMinHeight()) + "px";
     }
 
     return root;
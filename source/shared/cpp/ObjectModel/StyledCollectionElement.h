@@ -12,6 +12,8 @@ namespace AdaptiveCards
 {
 class StyledCollectionElement : public CollectionCoreElement
 {
+    friend class CardBinaryReader;
+
 public:
     StyledCollectionElement(const StyledCollectionElement&) = default;
     StyledCollectionElement(StyledCollectionElement&&) = default;
@@ -109,10 +111,10 @@ std::shared_ptr<T> StyledCollectionElement::Deserialize(ParseContext& context, c
     collection->SetCanFallbackToAncestor(canFallbackToAncestor);
 
     collection->SetStyle(ParseUtil::GetEnumValue<ContainerStyle>(
-        value, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleFromString));
+        value, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleTryFromString));
 
     collection->SetVerticalContentAlignment(ParseUtil::GetOptionalEnumValue<VerticalContentAlignment>(
-        value, AdaptiveCardSchemaKey::VerticalContentAlignment, VerticalContentAlignmentFromString));
+        value, AdaptiveCardSchemaKey::VerticalContentAlignment, VerticalContentAlignmentTryFromString));
 
     collection->SetBleed(ParseUtil::GetBool(value, AdaptiveCardSchemaKey::Bleed, false));
 
@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "ParseUtil.h"
 #include "SubmitAction.h"
+#include "Util.h"
 
 using namespace AdaptiveCards;
 
@@ -47,12 +48,12 @@ Json::Value SubmitAction::SerializeToJsonValue() const
 
     if (!m_dataJson.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Data)] = m_dataJson;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Data)] = m_dataJson;
     }
 
     if (m_associatedInputs != AssociatedInputs::Auto)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AssociatedInputs)] = AssociatedInputsToString(m_associatedInputs);
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::AssociatedInputs)] = AssociatedInputsToString(m_associatedInputs);
     }
 
     return root;
@@ -64,7 +65,7 @@ std::shared_ptr<BaseActionElement> SubmitActionParser::Deserialize(ParseContext&
 
     submitAction->SetDataJson(ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Data));
     submitAction->SetAssociatedInputs(ParseUtil::GetEnumValue<AssociatedInputs>(
-        json, AdaptiveCardSchemaKey::AssociatedInputs, AssociatedInputs::Auto, AssociatedInputsFromString));
+        json, AdaptiveCardSchemaKey::AssociatedInputs, AssociatedInputs::Auto, AssociatedInputsTryFromString));
 
     return submitAction;
 }
@@ -76,7 +77,9 @@ std::shared_ptr<BaseActionElement> SubmitActionParser::DeserializeFromString(Par
 
 void SubmitAction::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Data),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AssociatedInputs)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Data,
+         AdaptiveCardSchemaKey::AssociatedInputs});
+    m_knownProperties = &knownProperties;
 }
@@ -3,6 +3,7 @@
 
 #include "pch.h"
 #include "Table.h"
+#include "Util.h"
 
 namespace AdaptiveCards
 {
@@ -15,14 +16,16 @@ Table::Table() :
 
 void Table::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Columns),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FirstRowAsHeaders),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::GridStyle),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalCellContentAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rows),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ShowGridLines),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalCellContentAlignment)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Columns,
+         AdaptiveCardSchemaKey::FirstRowAsHeaders,
+         AdaptiveCardSchemaKey::GridStyle,
+         AdaptiveCardSchemaKey::HorizontalCellContentAlignment,
+         AdaptiveCardSchemaKey::Rows,
+         AdaptiveCardSchemaKey::ShowGridLines,
+         AdaptiveCardSchemaKey::VerticalCellContentAlignment});
+    m_knownProperties = &knownProperties;
 }
 
 bool Table::GetShowGridLines() const
@@ -119,7 +122,7 @@ Json::Value Table::SerializeToJsonValue() const
 
     if (!m_columnDefinitions.empty())
     {
-        const std::string& columnsPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Columns);
+        const Json::StaticString& columnsPropertyName = AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Columns);
         root[columnsPropertyName] = Json::Value(Json::arrayValue);
         for (const auto& columnDefinition : m_columnDefinitions)
         {
@@ -129,7 +132,7 @@ Json::Value Table::SerializeToJsonValue() const
 
     if (!m_rows.empty())
     {
-        const std::string& rowsPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rows);
+        const Json::StaticString& rowsPropertyName = AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Rows);
         root[rowsPropertyName] = Json::Value(Json::arrayValue);
         for (const auto& row : m_rows)
         {
@@ -139,28 +142,28 @@ Json::Value Table::SerializeToJsonValue() const
 
     if (m_showGridLines != true)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ShowGridLines)] = m_showGridLines;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::ShowGridLines)] = m_showGridLines;
     }
 
     if (m_firstRowAsHeaders != true)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FirstRowAsHeaders)] = m_firstRowAsHeaders;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::FirstRowAsHeaders)] = m_firstRowAsHeaders;
     }
 
     if (m_gridStyle != ContainerStyle::None)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::GridStyle)] = ContainerStyleToString(m_gridStyle);
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::GridStyle)] = ContainerStyleToString(m_gridStyle);
     }
 
     if (m_horizontalCellContentAlignment.has_value())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalCellContentAlignment)] =
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::HorizontalCellContentAlignment)] =
             HorizontalAlignmentToString(m_horizontalCellContentAlignment.value_or(HorizontalAlignment::Left));
     }
 
     if (m_verticalCellContentAlignment.has_value())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalCellContentAlignment)] =
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::VerticalCellContentAlignment)] =
             VerticalContentAlignmentToString(m_verticalCellContentAlignment.value_or(VerticalContentAlignment::Top));
     }
 
@@ -184,12 +187,12 @@ std::shared_ptr<BaseCardElement> TableParser::Deserialize(ParseContext& context,
 
     table->SetShowGridLines(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::ShowGridLines, true, false));
     table->SetGridStyle(ParseUtil::GetEnumValue<ContainerStyle>(
-        json, AdaptiveCardSchemaKey::GridStyle, ContainerStyle::None, ContainerStyleFromString));
+        json, AdaptiveCardSchemaKey::GridStyle, ContainerStyle::None, ContainerStyleTryFromString));
     table->SetFirstRowAsHeaders(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::FirstRowAsHeaders, true, false));
     table->SetHorizontalCellContentAlignment(ParseUtil::GetOptionalEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalCellContentAlignment, HorizontalAlignmentFromString));
+        json, AdaptiveCardSchemaKey::HorizontalCellContentAlignment, HorizontalAlignmentTryFromString));
     table->SetVerticalCellContentAlignment(ParseUtil::GetOptionalEnumValue<VerticalContentAlignment>(
-        json, AdaptiveCardSchemaKey::VerticalCellContentAlignment, VerticalContentAlignmentFromString));
+        json, AdaptiveCardSchemaKey::VerticalCellContentAlignment, VerticalContentAlignmentTryFromString));
 
     return table;
 }
@@ -24,26 +24,26 @@ Json::Value TableColumnDefinition::SerializeToJsonValue()
 
     if (m_horizontalCellContentAlignment.has_value())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalCellContentAlignment)] =
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::HorizontalCellContentAlignment)] =
             HorizontalAlignmentToString(m_horizontalCellContentAlignment.value_or(HorizontalAlignment::Left));
     }
 
     if (m_verticalCellContentAlignment.has_value())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalCellContentAlignment)] =
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::VerticalCellContentAlignment)] =
             VerticalContentAlignmentToString(m_verticalCellContentAlignment.value_or(VerticalContentAlignment::Top));
     }
 
     if (m_width.has_value())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Width)] = *m_width;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Width)] = *m_width;
     }
 
     if (m_pixelWidth.has_value())
     {
         std::ostringstream pixelStr;
         pixelStr << *m_pixelWidth << "px";
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Width)] = pixelStr.str();
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Width)] = pixelStr.str();
     }
 
     return root;
@@ -93,12 +93,12 @@ void TableColumnDefinition::SetPixelWidth(const std::optional<unsigned int>& val
 
 std::shared_ptr<TableColumnDefinition> TableColumnDefinition::Deserialize(ParseContext& context, const Json::Value& json)
 {
-    auto tableColumnDefinition = std::make_shared<TableColumnDefinition>();
+    auto tableColumnDefinition = MakeSharedInArena<TableColumnDefinition>(context.GetArena());
 
     tableColumnDefinition->SetHorizontalCellContentAlignment(ParseUtil::GetOptionalEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalCellContentAlignment, HorizontalAlignmentFromString));
+        json, AdaptiveCardSchemaKey::HorizontalCellContentAlignment, HorizontalAlignmentTryFromString));
     tableColumnDefinition->SetVerticalCellContentAlignment(ParseUtil::GetOptionalEnumValue<VerticalContentAlignment>(
-        json, AdaptiveCardSchemaKey::VerticalCellContentAlignment, VerticalContentAlignmentFromString));
+        json, AdaptiveCardSchemaKey::VerticalCellContentAlignment, VerticalContentAlignmentTryFromString));
 
     if (const auto& widthValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Width, false); !widthValue.empty())
     {
@@ -5,6 +5,7 @@
 #include "TableRow.h"
 #include "TableCell.h"
 #include "ParseUtil.h"
+#include "Util.h"
 
 namespace AdaptiveCards
 {
@@ -18,12 +19,14 @@ TableRow::TableRow() :
 
 void TableRow::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Cells),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalCellContentAlignment),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Rtl),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalCellContentAlignment)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Cells,
+         AdaptiveCardSchemaKey::HorizontalCellContentAlignment,
+         AdaptiveCardSchemaKey::Rtl,
+         AdaptiveCardSchemaKey::Style,
+         AdaptiveCardSchemaKey::VerticalCellContentAlignment});
+    m_knownProperties = &knownProperties;
 }
 
 std::vector<std::shared_ptr<TableCell>>& TableRow::GetCells()
@@ -72,7 +75,7 @@ Json::Value TableRow::SerializeToJsonValue() const
 
     if (!m_cells.empty())
     {
-        const std::string& cellsPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Cells);
+        const Json::StaticString& cellsPropertyName = AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Cells);
         root[cellsPropertyName] = Json::Value(Json::arrayValue);
         for (const auto& cardElement : m_cells)
         {
@@ -82,19 +85,19 @@ Json::Value TableRow::SerializeToJsonValue() const
 
     if (m_horizontalCellContentAlignment.has_value())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalCellContentAlignment)] =
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::HorizontalCellContentAlignment)] =
             HorizontalAlignmentToString(m_horizontalCellContentAlignment.value_or(HorizontalAlignment::Left));
     }
 
     if (m_verticalCellContentAlignment.has_value())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalCellContentAlignment)] =
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::VerticalCellContentAlignment)] =
             VerticalContentAlignmentToString(m_verticalCellContentAlignment.value_or(VerticalContentAlignment::Top));
     }
 
     if (m_style != ContainerStyle::None)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style)] = ContainerStyleToString(m_style);
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Style)] = ContainerStyleToString(m_style);
     }
 
     return root;
@@ -115,11 +118,11 @@ std::shared_ptr<TableRow> TableRow::DeserializeTableRow(ParseContext& context, c
     std::shared_ptr<TableRow> tableRow = BaseCardElement::Deserialize<TableRow>(context, json);
 
     tableRow->SetHorizontalCellContentAlignment(ParseUtil::GetOptionalEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalCellContentAlignment, HorizontalAlignmentFromString));
+        json, AdaptiveCardSchemaKey::HorizontalCellContentAlignment, HorizontalAlignmentTryFromString));
     tableRow->SetVerticalCellContentAlignment(ParseUtil::GetOptionalEnumValue<VerticalContentAlignment>(
-        json, AdaptiveCardSchemaKey::VerticalCellContentAlignment, VerticalContentAlignmentFromString));
+        json, AdaptiveCardSchemaKey::VerticalCellContentAlignment, VerticalContentAlignmentTryFromString));
     tableRow->SetStyle(ParseUtil::GetEnumValue<ContainerStyle>(
-        json, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleFromString));
+        json, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleTryFromString));
 
     auto cells = ParseUtil::GetElementCollectionOfSingleType<TableCell>(
         context, json, AdaptiveCardSchemaKey::Cells, &TableCell::DeserializeTableCell, false);
@@ -0,0 +1,2630 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "TemplateExpression.h"
+#include "AdaptiveCardParseException.h"
+#include "ParseUtil.h"
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+using namespace AdaptiveCards;
+
+namespace
+{
+using Arguments = std::vector<std::unique_ptr<TemplateExpression>>;
+
+// An expression nested deeper than this is left as written, rather than parsed (and later evaluated and destroyed)
+// until the stack runs out
+constexpr unsigned int c_maxExpressionNesting = 256;
+
+[[noreturn]] void ThrowTemplateError(const std::string& message)
+{
+    throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, message);
+}
+
+bool IsNumber(const Json::Value& value)
+{
+    return value.isInt() || value.isInt64() || value.isUInt64() || value.isDouble();
+}
+
+bool IsIntegral(const Json::Value& value)
+{
+    return value.type() == Json::intValue || (value.type() == Json::uintValue && value.isInt64());
+}
+
+// JavaScript has a single type of number, so a computed number that is whole is kept as an integer (and written
+// without a fraction)
+Json::Value MakeNumber(double value)
+{
+    if (std::isfinite(value) && std::floor(value) == value && std::fabs(value) < 9.2e18)
+    {
+        return Json::Value(static_cast<Json::Int64>(value));
+    }
+    return Json::Value(value);
+}
+
+double ToDouble(const Json::Value& value)
+{
+    if (!IsNumber(value))
+    {
+        ThrowTemplateError(TemplateValueToString(value) + " is not a number");
+    }
+    return value.asDouble();
+}
+
+Json::Int64 ToInteger(const Json::Value& value)
+{
+    if (IsIntegral(value))
+    {
+        return value.asInt64();
+    }
+    const double number = ToDouble(value);
+    if (std::floor(number) != number)
+    {
+        ThrowTemplateError(TemplateValueToString(value) + " is not an integer");
+    }
+    return static_cast<Json::Int64>(number);
+}
+
+// false, null and undefined are false; anything else is true
+bool IsTrue(const TemplateValue& value)
+{
+    const auto& json = value.Get();
+    return json.isBool() ? json.asBool() : !value.IsUndefined() && !json.isNull();
+}
+
+bool AreEqual(const Json::Value& first, const Json::Value& second)
+{
+    if (IsNumber(first) && IsNumber(second))
+    {
+        return IsIntegral(first) && IsIntegral(second) ? first.asInt64() == second.asInt64() :
+                                                         first.asDouble() == second.asDouble();
+    }
+    if (first.type() != second.type())
+    {
+        return false;
+    }
+    if (first.isArray())
+    {
+        if (first.size() != second.size())
+        {
+            return false;
+        }
+        for (Json::ArrayIndex i = 0; i < first.size(); ++i)
+        {
+            if (!AreEqual(first[i], second[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (first.isObject())
+    {
+        if (first.size() != second.size())
+        {
+            return false;
+        }
+        for (auto it = first.begin(); it != first.end(); ++it)
+        {
+            const auto name = it.name();
+            const auto* other = second.find(name.data(), name.data() + name.size());
+            if (other == nullptr || !AreEqual(*it, *other))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    return first == second;
+}
+
+// Numbers compare as numbers and strings as strings; values of other types don't compare
+std::optional<int> Compare(const Json::Value& first, const Json::Value& second)
+{
+    if (IsNumber(first) && IsNumber(second))
+    {
+        if (IsIntegral(first) && IsIntegral(second))
+        {
+            const auto a = first.asInt64();
+            const auto b = second.asInt64();
+            return a < b ? -1 : (a > b ? 1 : 0);
+        }
+        const auto a = first.asDouble();
+        const auto b = second.asDouble();
+        return a < b ? -1 : (a > b ? 1 : 0);
+    }
+    if (first.isString() && second.isString())
+    {
+        const int result = std::strcmp(first.asCString(), second.asCString());
+        return result < 0 ? -1 : (result > 0 ? 1 : 0);
+    }
+    return std::nullopt;
+}
+
+Json::Value Arithmetic(TemplateOperator op, const Json::Value& first, const Json::Value& second)
+{
+    if (op == TemplateOperator::Add && (first.isString() || second.isString()))
+    {
+        return TemplateValueToString(first) + TemplateValueToString(second);
+    }
+
+    if (IsIntegral(first) && IsIntegral(second) && op != TemplateOperator::Power)
+    {
+        const auto a = first.asInt64();
+        const auto b = second.asInt64();
+        // outside of this range, the result may not fit and is computed as a double
+        constexpr Json::Int64 exact = Json::Int64{1} << 31;
+        const bool isSmall = a > -exact && a < exact && b > -exact && b < exact;
+        switch (op)
+        {
+        case TemplateOperator::Add:
+            if (isSmall)
+            {
+                return Json::Value(a + b);
+            }
+            break;
+        case TemplateOperator::Subtract:
+            if (isSmall)
+            {
+                return Json::Value(a - b);
+            }
+            break;
+        case TemplateOperator::Multiply:
+            if (isSmall)
+            {
+                return Json::Value(a * b);
+            }
+            break;
+        case TemplateOperator::Divide:
+        case TemplateOperator::Modulo:
+            if (b == 0)
+            {
+                ThrowTemplateError("Cannot divide by zero");
+            }
+            if (b != -1)
+            {
+                return Json::Value(op == TemplateOperator::Divide ? a / b : a % b);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    const double a = ToDouble(first);
+    const double b = ToDouble(second);
+    switch (op)
+    {
+    case TemplateOperator::Power:
+        return MakeNumber(std::pow(a, b));
+    case TemplateOperator::Multiply:
+        return MakeNumber(a * b);
+    case TemplateOperator::Divide:
+        if (b == 0)
+        {
+            ThrowTemplateError("Cannot divide by zero");
+        }
+        return MakeNumber(a / b);
+    case TemplateOperator::Modulo:
+        if (b == 0)
+        {
+            ThrowTemplateError("Cannot divide by zero");
+        }
+        return MakeNumber(std::fmod(a, b));
+    case TemplateOperator::Add:
+        return MakeNumber(a + b);
+    case TemplateOperator::Subtract:
+        return MakeNumber(a - b);
+    default:
+        ThrowTemplateError("Not an arithmetic operator");
+    }
+}
+
+// A property of an object: an exact match, or failing that, one that differs only in case
+const Json::Value* FindProperty(const Json::Value& object, const std::string& name)
+{
+    if (!object.isObject())
+    {
+        return nullptr;
+    }
+    if (const auto* exact = object.find(name.data(), name.data() + name.size()))
+    {
+        return exact;
+    }
+    for (auto it = object.begin(); it != object.end(); ++it)
+    {
+        const auto memberName = it.name();
+        if (memberName.size() == name.size() &&
+            std::equal(name.cbegin(), name.cend(), memberName.cbegin(), [](char first, char second) {
+                return std::tolower(static_cast<unsigned char>(first)) ==
+                       std::tolower(static_cast<unsigned char>(second));
+            }))
+        {
+            return &*it;
+        }
+    }
+    return nullptr;
+}
+
+// Moves past a string literal starting at position (at its quote), for the scanners that only need to skip them
+size_t SkipQuoted(std::string_view text, size_t position)
+{
+    const char quote = text[position++];
+    while (position < text.size() && text[position] != quote)
+    {
+        position += text[position] == '\\' ? 2 : 1;
+    }
+    return std::min(position + 1, text.size());
+}
+
+// Parsing
+
+enum class TokenType
+{
+    End,
+    Number,
+    String,
+    Identifier,
+    Symbol
+};
+
+struct Token
+{
+    TokenType type;
+    std::string_view text;
+    size_t start;
+};
+} // namespace
+
+namespace AdaptiveCards
+{
+class TemplateExpressionParser
+{
+public:
+    explicit TemplateExpressionParser(std::string_view text) : m_text(text), m_position(0) { Advance(); }
+
+    std::unique_ptr<TemplateExpression> ParseAll()
+    {
+        auto expression = ParseBinary(0);
+        if (m_token.type != TokenType::End)
+        {
+            Fail("unexpected " + std::string(m_token.text));
+        }
+        return expression;
+    }
+
+private:
+    [[noreturn]] void Fail(const std::string& reason)
+    {
+        ThrowTemplateError("Invalid template expression \"" + std::string(m_text) + "\": " + reason);
+    }
+
+    // Puts back how deeply nested the parse was once the part of the expression it was made for has been parsed
+    class NestingScope
+    {
+    public:
+        explicit NestingScope(unsigned int& nesting) : m_nesting(nesting), m_entered(nesting) {}
+        ~NestingScope() { m_nesting = m_entered; }
+
+    private:
+        unsigned int& m_nesting;
+        const unsigned int m_entered;
+    };
+
+    // Called for each level the expression being parsed goes down, whether by recursion or (for chains such as
+    // a + b + c, which make trees as deep) by looping
+    void Nest()
+    {
+        if (++m_nesting > c_maxExpressionNesting)
+        {
+            Fail("nested too deeply");
+        }
+    }
+
+    void Advance()
+    {
+        m_previousEnd = m_tokenEnd;
+        while (m_position < m_text.size() && std::isspace(static_cast<unsigned char>(m_text[m_position])))
+        {
+            ++m_position;
+        }
+
+        const size_t start = m_position;
+        if (m_position == m_text.size())
+        {
+            m_token = {TokenType::End, std::string_view(), start};
+            return;
+        }
+
+        const char c = m_text[m_position];
+        if (std::isdigit(static_cast<unsigned char>(c)) ||
+            (c == '.' && m_position + 1 < m_text.size() &&
+             std::isdigit(static_cast<unsigned char>(m_text[m_position + 1]))))
+        {
+            while (m_position < m_text.size() &&
+                   (std::isdigit(static_cast<unsigned char>(m_text[m_position])) || m_text[m_position] == '.'))
+            {
+                ++m_position;
+            }
+            if (m_position < m_text.size() && (m_text[m_position] == 'e' || m_text[m_position] == 'E'))
+            {
+                ++m_position;
+                if (m_position < m_text.size() && (m_text[m_position] == '+' || m_text[m_position] == '-'))
+                {
+                    ++m_position;
+                }
+                while (m_position < m_text.size() && std::isdigit(static_cast<unsigned char>(m_text[m_position])))
+                {
+                    ++m_position;
+                }
+            }
+            m_token = {TokenType::Number, m_text.substr(start, m_position - start), start};
+        }
+        else if (c == '\'' || c == '"')
+        {
+            m_position = SkipQuoted(m_text, m_position);
+            if (m_text[m_position - 1] != c || m_position - start < 2)
+            {
+                Fail("unterminated string");
+            }
+            m_token = {TokenType::String, m_text.substr(start, m_position - start), start};
+        }
+        else if (std::isalpha(static_cast<unsigned char>(c)) || c == '_' || c == '$' || c == '@' || c == '#')
+        {
+            ++m_position;
+            while (m_position < m_text.size() && (std::isalnum(static_cast<unsigned char>(m_text[m_position])) ||
+                                                   m_text[m_position] == '_' || m_text[m_position] == '$'))
+            {
+                ++m_position;
+            }
+            m_token = {TokenType::Identifier, m_text.substr(start, m_position - start), start};
+        }
+        else
+        {
+            static constexpr const char* twoCharacterSymbols[] = {"<=", ">=", "==", "!=", "&&", "||"};
+            size_t length = 1;
+            for (const auto* symbol : twoCharacterSymbols)
+            {
+                if (m_text.substr(m_position, 2) == symbol)
+                {
+                    length = 2;
+                }
+            }
+            if (length == 1 && std::strchr("()[]{},.:!+-*/%^&<>", c) == nullptr)
+            {
+                Fail(std::string("unexpected character ") + c);
+            }
+            m_position += length;
+            m_token = {TokenType::Symbol, m_text.substr(start, length), start};
+        }
+        m_tokenEnd = m_position;
+    }
+
+    bool IsSymbol(std::string_view symbol) const { return m_token.type == TokenType::Symbol && m_token.text == symbol; }
+
+    void Expect(std::string_view symbol)
+    {
+        if (!IsSymbol(symbol))
+        {
+            Fail("expected " + std::string(symbol));
+        }
+        Advance();
+    }
+
+    std::unique_ptr<TemplateExpression> MakeNode(TemplateExpressionKind kind)
+    {
+        return std::unique_ptr<TemplateExpression>(new TemplateExpression(kind));
+    }
+
+    void SetText(TemplateExpression& expression, size_t start)
+    {
+        expression.m_text = std::string(m_text.substr(start, m_previousEnd - start));
+    }
+
+    // Binary operators by precedence, loosest first
+    static std::optional<TemplateOperator> GetBinaryOperator(std::string_view symbol, int level)
+    {
+        static const std::vector<std::vector<std::pair<std::string_view, TemplateOperator>>> levels{
+            {{"||", TemplateOperator::Or}},
+            {{"&&", TemplateOperator::And}},
+            {{"==", TemplateOperator::Equal}, {"!=", TemplateOperator::NotEqual}},
+            {{"<", TemplateOperator::Less},
+             {"<=", TemplateOperator::LessOrEqual},
+             {">", TemplateOperator::Greater},
+             {">=", TemplateOperator::GreaterOrEqual}},
+            {{"+", TemplateOperator::Add}, {"-", TemplateOperator::Subtract}, {"&", TemplateOperator::Concatenate}},
+            {{"*", TemplateOperator::Multiply}, {"/", TemplateOperator::Divide}, {"%", TemplateOperator::Modulo}},
+            {{"^", TemplateOperator::Power}}};
+
+        for (const auto& entry : levels[level])
+        {
+            if (entry.first == symbol)
+            {
+                return entry.second;
+            }
+        }
+        return std::nullopt;
+    }
+
+    std::unique_ptr<TemplateExpression> ParseBinary(int level)
+    {
+        constexpr int powerLevel = 6;
+        if (level > powerLevel)
+        {
+            return ParseUnary();
+        }
+
+        NestingScope scope(m_nesting);
+        const size_t start = m_token.start;
+        auto left = ParseBinary(level + 1);
+        while (m_token.type == TokenType::Symbol)
+        {
+            const auto op = GetBinaryOperator(m_token.text, level);
+            if (!op.has_value())
+            {
+                break;
+            }
+            Nest();
+            Advance();
+
+            auto node = MakeNode(TemplateExpressionKind::Binary);
+            node->m_operator = *op;
+            node->m_children.push_back(std::move(left));
+            // ^ groups to the right
+            node->m_children.push_back(ParseBinary(level == powerLevel ? level : level + 1));
+            SetText(*node, start);
+            left = Fold(std::move(node));
+        }
+        return left;
+    }
+
+    std::unique_ptr<TemplateExpression> ParseUnary()
+    {
+        const size_t start = m_token.start;
+        if (IsSymbol("!") || IsSymbol("-") || IsSymbol("+"))
+        {
+            NestingScope scope(m_nesting);
+            Nest();
+            const auto symbol = m_token.text;
+            Advance();
+            auto operand = ParseUnary();
+            if (symbol == "+")
+            {
+                return operand;
+            }
+
+            auto node = MakeNode(symbol == "!" ? TemplateExpressionKind::Not : TemplateExpressionKind::Negate);
+            node->m_children.push_back(std::move(operand));
+            SetText(*node, start);
+            return Fold(std::move(node));
+        }
+        return ParsePostfix();
+    }
+
+    std::unique_ptr<TemplateExpression> ParsePostfix()
+    {
+        NestingScope scope(m_nesting);
+        const size_t start = m_token.start;
+        auto expression = ParsePrimary();
+        while (true)
+        {
+            if (IsSymbol(".") || IsSymbol("["))
+            {
+                Nest();
+            }
+            if (IsSymbol("."))
+            {
+                Advance();
+                if (m_token.type != TokenType::Identifier)
+                {
+                    Fail("expected a property name");
+                }
+                auto node = MakeNode(TemplateExpressionKind::Member);
+                node->m_name = std::string(m_token.text);
+                Advance();
+                node->m_children.push_back(std::move(expression));
+                SetText(*node, start);
+                expression = std::move(node);
+            }
+            else if (IsSymbol("["))
+            {
+                Advance();
+                auto node = MakeNode(TemplateExpressionKind::Index);
+                node->m_children.push_back(std::move(expression));
+                node->m_children.push_back(ParseBinary(0));
+                Expect("]");
+                SetText(*node, start);
+                expression = std::move(node);
+            }
+            else
+            {
+                return expression;
+            }
+        }
+    }
+
+    std::unique_ptr<TemplateExpression> ParsePrimary()
+    {
+        NestingScope scope(m_nesting);
+        Nest();
+        const size_t start = m_token.start;
+        std::unique_ptr<TemplateExpression> node;
+        switch (m_token.type)
+        {
+        case TokenType::Number:
+            node = MakeNode(TemplateExpressionKind::Constant);
+            node->m_constant = ParseNumber(m_token.text);
+            Advance();
+            break;
+        case TokenType::String:
+            node = MakeNode(TemplateExpressionKind::Constant);
+            node->m_constant = ParseString(m_token.text);
+            Advance();
+            break;
+        case TokenType::Identifier:
+        {
+            const std::string name(m_token.text);
+            Advance();
+            if (IsSymbol("("))
+            {
+                node = ParseCall(name);
+            }
+            else if (name == "true" || name == "false")
+            {
+                node = MakeNode(TemplateExpressionKind::Constant);
+                node->m_constant = name == "true";
+            }
+            else if (name == "null")
+            {
+                node = MakeNode(TemplateExpressionKind::Constant);
+            }
+            else
+            {
+                node = MakeNode(TemplateExpressionKind::Identifier);
+                node->m_name = name;
+            }
+            break;
+        }
+        case TokenType::Symbol:
+            if (IsSymbol("("))
+            {
+                Advance();
+                node = ParseBinary(0);
+                Expect(")");
+                // the parentheses are part of what the expression was written as
+                SetText(*node, start);
+                return node;
+            }
+            if (IsSymbol("["))
+            {
+                Advance();
+                node = MakeNode(TemplateExpressionKind::Array);
+                while (!IsSymbol("]"))
+                {
+                    node->m_children.push_back(ParseBinary(0));
+                    if (!IsSymbol("]"))
+                    {
+                        Expect(",");
+                    }
+                }
+                Advance();
+                break;
+            }
+            if (IsSymbol("{"))
+            {
+                Advance();
+                node = MakeNode(TemplateExpressionKind::Object);
+                while (!IsSymbol("}"))
+                {
+                    if (m_token.type == TokenType::Identifier)
+                    {
+                        node->m_keys.emplace_back(m_token.text);
+                    }
+                    else if (m_token.type == TokenType::String)
+                    {
+                        node->m_keys.push_back(ParseString(m_token.text));
+                    }
+                    else
+                    {
+                        Fail("expected a property name");
+                    }
+                    Advance();
+                    Expect(":");
+                    node->m_children.push_back(ParseBinary(0));
+                    if (!IsSymbol("}"))
+                    {
+                        Expect(",");
+                    }
+                }
+                Advance();
+                break;
+            }
+            Fail("unexpected " + std::string(m_token.text));
+        case TokenType::End:
+        default:
+            Fail("unexpected end of expression");
+        }
+        SetText(*node, start);
+        return Fold(std::move(node));
+    }
+
+    std::unique_ptr<TemplateExpression> ParseCall(const std::string& name);
+
+    // An operation or call of constants is replaced with its value, so that it isn't evaluated again for each data
+    std::unique_ptr<TemplateExpression> Fold(std::unique_ptr<TemplateExpression> expression);
+
+    Json::Value ParseNumber(std::string_view text)
+    {
+        if (text.find_first_of(".eE") == std::string_view::npos)
+        {
+            Json::Int64 integer = 0;
+            const auto result = std::from_chars(text.data(), text.data() + text.size(), integer);
+            if (result.ec == std::errc() && result.ptr == text.data() + text.size())
+            {
+                return Json::Value(integer);
+            }
+        }
+
+        char* end = nullptr;
+        const std::string number(text);
+        const double value = std::strtod(number.c_str(), &end);
+        if (end != number.c_str() + number.size())
+        {
+            Fail("invalid number " + number);
+        }
+        // kept as a double, so that 5 / 2.0 divides as doubles rather than as integers
+        return Json::Value(value);
+    }
+
+    // text includes the quotes
+    std::string ParseString(std::string_view text)
+    {
+        std::string value;
+        for (size_t i = 1; i + 1 < text.size(); ++i)
+        {
+            if (text[i] != '\\' || i + 2 >= text.size())
+            {
+                value += text[i];
+                continue;
+            }
+
+            switch (text[++i])
+            {
+            case 'n':
+                value += '\n';
+                break;
+            case 'r':
+                value += '\r';
+                break;
+            case 't':
+                value += '\t';
+                break;
+            default:
+                value += text[i];
+                break;
+            }
+        }
+        return value;
+    }
+
+    std::string_view m_text;
+    size_t m_position;
+    Token m_token;
+    size_t m_tokenEnd = 0;
+    unsigned int m_nesting = 0;
+    // where the token before the current one ended, for SetText
+    size_t m_previousEnd = 0;
+};
+} // namespace AdaptiveCards
+
+namespace
+{
+// Functions
+
+const Json::Value& NullValue()
+{
+    static const Json::Value null;
+    return null;
+}
+
+TemplateValue EvaluateArgument(TemplateEvaluator& evaluator, const Arguments& arguments, size_t index)
+{
+    return index < arguments.size() ? evaluator.Evaluate(*arguments[index]) : TemplateValue();
+}
+
+std::string StringArgument(TemplateEvaluator& evaluator, const Arguments& arguments, size_t index)
+{
+    const auto value = EvaluateArgument(evaluator, arguments, index);
+    return TemplateValueToString(value.Get());
+}
+
+double NumberArgument(TemplateEvaluator& evaluator, const Arguments& arguments, size_t index)
+{
+    return ToDouble(EvaluateArgument(evaluator, arguments, index).Get());
+}
+
+Json::Int64 IntegerArgument(TemplateEvaluator& evaluator, const Arguments& arguments, size_t index)
+{
+    return ToInteger(EvaluateArgument(evaluator, arguments, index).Get());
+}
+
+const Json::Value& ArrayOf(const TemplateValue& value, const char* function)
+{
+    if (!value.Get().isArray())
+    {
+        ThrowTemplateError(std::string(function) + " expects an array");
+    }
+    return value.Get();
+}
+
+// For functions that take either their values as arguments or a single array of them
+Json::Value ValuesArgument(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    if (arguments.size() == 1)
+    {
+        auto value = evaluator.Evaluate(*arguments[0]);
+        if (value.Get().isArray())
+        {
+            return value.Release();
+        }
+        Json::Value values(Json::arrayValue);
+        values.append(value.Release());
+        return values;
+    }
+
+    Json::Value values(Json::arrayValue);
+    for (const auto& argument : arguments)
+    {
+        values.append(evaluator.Evaluate(*argument).Release());
+    }
+    return values;
+}
+
+size_t CountCodePoints(const std::string& value)
+{
+    return std::count_if(
+        value.cbegin(), value.cend(), [](char c) { return (static_cast<unsigned char>(c) & 0xC0) != 0x80; });
+}
+
+// String functions
+
+TemplateValue StringFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    return Json::Value(StringArgument(evaluator, arguments, 0));
+}
+
+TemplateValue ConcatFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    std::vector<TemplateValue> values;
+    bool areArrays = true;
+    for (const auto& argument : arguments)
+    {
+        values.push_back(evaluator.Evaluate(*argument));
+        areArrays = areArrays && values.back().Get().isArray();
+    }
+
+    if (areArrays)
+    {
+        Json::Value result(Json::arrayValue);
+        for (const auto& value : values)
+        {
+            for (const auto& item : value.Get())
+            {
+                result.append(item);
+            }
+        }
+        return result;
+    }
+
+    std::string result;
+    for (const auto& value : values)
+    {
+        result += TemplateValueToString(value.Get());
+    }
+    return Json::Value(result);
+}
+
+TemplateValue LengthFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto value = evaluator.Evaluate(*arguments[0]);
+    const auto& json = value.Get();
+    if (json.isArray() || json.isObject())
+    {
+        return Json::Value(static_cast<Json::Int64>(json.size()));
+    }
+    return Json::Value(static_cast<Json::Int64>(CountCodePoints(TemplateValueToString(json))));
+}
+
+TemplateValue ToLowerFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    auto value = StringArgument(evaluator, arguments, 0);
+    std::transform(
+        value.begin(), value.end(), value.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return Json::Value(value);
+}
+
+TemplateValue ToUpperFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    auto value = StringArgument(evaluator, arguments, 0);
+    std::transform(
+        value.begin(), value.end(), value.begin(), [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+    return Json::Value(value);
+}
+
+TemplateValue TrimFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto value = StringArgument(evaluator, arguments, 0);
+    const auto first = value.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos)
+    {
+        return Json::Value("");
+    }
+    return Json::Value(value.substr(first, value.find_last_not_of(" \t\r\n") - first + 1));
+}
+
+TemplateValue SubstringFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto value = StringArgument(evaluator, arguments, 0);
+    const auto start = IntegerArgument(evaluator, arguments, 1);
+    const auto length = arguments.size() > 2 ? IntegerArgument(evaluator, arguments, 2) :
+                                               static_cast<Json::Int64>(value.size()) - start;
+    if (start < 0 || length < 0 || static_cast<size_t>(start + length) > value.size())
+    {
+        ThrowTemplateError("substring is out of range");
+    }
+    return Json::Value(value.substr(static_cast<size_t>(start), static_cast<size_t>(length)));
+}
+
+TemplateValue IndexOf(TemplateEvaluator& evaluator, const Arguments& arguments, bool isLast)
+{
+    const auto container = evaluator.Evaluate(*arguments[0]);
+    const auto search = evaluator.Evaluate(*arguments[1]);
+    if (container.Get().isArray())
+    {
+        const auto& items = container.Get();
+        for (Json::ArrayIndex i = 0; i < items.size(); ++i)
+        {
+            const auto index = isLast ? items.size() - 1 - i : i;
+            if (AreEqual(items[index], search.Get()))
+            {
+                return Json::Value(static_cast<Json::Int64>(index));
+            }
+        }
+        return Json::Value(Json::Int64{-1});
+    }
+
+    const auto value = TemplateValueToString(container.Get());
+    const auto text = TemplateValueToString(search.Get());
+    const auto index = isLast ? value.rfind(text) : value.find(text);
+    return Json::Value(index == std::string::npos ? Json::Int64{-1} : static_cast<Json::Int64>(index));
+}
+
+TemplateValue IndexOfFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    return IndexOf(evaluator, arguments, false);
+}
+
+TemplateValue LastIndexOfFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    return IndexOf(evaluator, arguments, true);
+}
+
+TemplateValue ReplaceFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    auto value = StringArgument(evaluator, arguments, 0);
+    const auto search = StringArgument(evaluator, arguments, 1);
+    const auto replacement = StringArgument(evaluator, arguments, 2);
+    if (search.empty())
+    {
+        ThrowTemplateError("replace can't replace an empty string");
+    }
+
+    for (auto position = value.find(search); position != std::string::npos;
+         position = value.find(search, position + replacement.size()))
+    {
+        value.replace(position, search.size(), replacement);
+    }
+    return Json::Value(value);
+}
+
+TemplateValue StartsWithFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto value = StringArgument(evaluator, arguments, 0);
+    const auto prefix = StringArgument(evaluator, arguments, 1);
+    return Json::Value(value.compare(0, prefix.size(), prefix) == 0);
+}
+
+TemplateValue EndsWithFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto value = StringArgument(evaluator, arguments, 0);
+    const auto suffix = StringArgument(evaluator, arguments, 1);
+    return Json::Value(
+        value.size() >= suffix.size() && value.compare(value.size() - suffix.size(), suffix.size(), suffix) == 0);
+}
+
+TemplateValue SplitFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto value = StringArgument(evaluator, arguments, 0);
+    const auto separator = StringArgument(evaluator, arguments, 1);
+
+    Json::Value result(Json::arrayValue);
+    if (separator.empty())
+    {
+        for (char c : value)
+        {
+            result.append(std::string(1, c));
+        }
+        return result;
+    }
+
+    size_t start = 0;
+    for (auto position = value.find(separator); position != std::string::npos; position = value.find(separator, start))
+    {
+        result.append(value.substr(start, position - start));
+        start = position + separator.size();
+    }
+    result.append(value.substr(start));
+    return result;
+}
+
+TemplateValue JoinFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto items = evaluator.Evaluate(*arguments[0]);
+    const auto& array = ArrayOf(items, "join");
+    const auto separator = StringArgument(evaluator, arguments, 1);
+    const auto lastSeparator = arguments.size() > 2 ? StringArgument(evaluator, arguments, 2) : separator;
+
+    std::string result;
+    for (Json::ArrayIndex i = 0; i < array.size(); ++i)
+    {
+        if (i > 0)
+        {
+            result += i + 1 == array.size() ? lastSeparator : separator;
+        }
+        result += TemplateValueToString(array[i]);
+    }
+    return Json::Value(result);
+}
+
+// Collection functions
+
+TemplateValue ContainsFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto container = evaluator.Evaluate(*arguments[0]);
+    const auto search = evaluator.Evaluate(*arguments[1]);
+    const auto& json = container.Get();
+    if (json.isArray())
+    {
+        return Json::Value(std::any_of(
+            json.begin(), json.end(), [&](const Json::Value& item) { return AreEqual(item, search.Get()); }));
+    }
+    if (json.isObject())
+    {
+        return Json::Value(json.isMember(TemplateValueToString(search.Get())));
+    }
+    return Json::Value(TemplateValueToString(json).find(TemplateValueToString(search.Get())) != std::string::npos);
+}
+
+TemplateValue EmptyFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto value = evaluator.Evaluate(*arguments[0]);
+    const auto& json = value.Get();
+    return Json::Value(json.isNull() || ((json.isString() || json.isArray() || json.isObject()) && json.empty()) ||
+                       (json.isString() && json.asString().empty()));
+}
+
+TemplateValue FirstFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    auto value = evaluator.Evaluate(*arguments[0]);
+    const auto& json = value.Get();
+    if (json.isString())
+    {
+        const auto text = json.asString();
+        return text.empty() ? TemplateValue() : Json::Value(text.substr(0, 1));
+    }
+    if (!json.isArray() || json.empty())
+    {
+        return TemplateValue();
+    }
+    return value.IsReference() ? TemplateValue::Reference(json[0]) : TemplateValue(json[0]);
+}
+
+TemplateValue LastFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    auto value = evaluator.Evaluate(*arguments[0]);
+    const auto& json = value.Get();
+    if (json.isString())
+    {
+        const auto text = json.asString();
+        return text.empty() ? TemplateValue() : Json::Value(text.substr(text.size() - 1));
+    }
+    if (!json.isArray() || json.empty())
+    {
+        return TemplateValue();
+    }
+    return value.IsReference() ? TemplateValue::Reference(json[json.size() - 1]) : TemplateValue(json[json.size() - 1]);
+}
+
+Json::Value SubArray(const Json::Value& array, Json::Int64 start, Json::Int64 end)
+{
+    start = std::clamp<Json::Int64>(start, 0, array.size());
+    end = std::clamp<Json::Int64>(end, start, array.size());
+
+    Json::Value result(Json::arrayValue);
+    for (auto i = start; i < end; ++i)
+    {
+        result.append(array[static_cast<Json::ArrayIndex>(i)]);
+    }
+    return result;
+}
+
+TemplateValue SkipFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto items = evaluator.Evaluate(*arguments[0]);
+    const auto& array = ArrayOf(items, "skip");
+    return SubArray(array, IntegerArgument(evaluator, arguments, 1), array.size());
+}
+
+TemplateValue TakeFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto items = evaluator.Evaluate(*arguments[0]);
+    const auto& array = ArrayOf(items, "take");
+    return SubArray(array, 0, IntegerArgument(evaluator, arguments, 1));
+}
+
+TemplateValue SubArrayFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto items = evaluator.Evaluate(*arguments[0]);
+    const auto& array = ArrayOf(items, "subArray");
+    return SubArray(array, IntegerArgument(evaluator, arguments, 1),
+                    arguments.size() > 2 ? IntegerArgument(evaluator, arguments, 2) : array.size());
+}
+
+TemplateValue ReverseFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto items = evaluator.Evaluate(*arguments[0]);
+    const auto& json = items.Get();
+    if (json.isString())
+    {
+        auto text = json.asString();
+        std::reverse(text.begin(), text.end());
+        return Json::Value(text);
+    }
+
+    const auto& array = ArrayOf(items, "reverse");
+    Json::Value result(Json::arrayValue);
+    for (auto i = array.size(); i > 0; --i)
+    {
+        result.append(array[i - 1]);
+    }
+    return result;
+}
+
+TemplateValue CreateArrayFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    Json::Value result(Json::arrayValue);
+    for (const auto& argument : arguments)
+    {
+        result.append(evaluator.Evaluate(*argument).Release());
+    }
+    return result;
+}
+
+TemplateValue IndicesAndValuesFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto items = evaluator.Evaluate(*arguments[0]);
+    const auto& array = ArrayOf(items, "indicesAndValues");
+
+    Json::Value result(Json::arrayValue);
+    for (Json::ArrayIndex i = 0; i < array.size(); ++i)
+    {
+        Json::Value entry(Json::objectValue);
+        entry["index"] = static_cast<Json::Int64>(i);
+        entry["value"] = array[i];
+        result.append(std::move(entry));
+    }
+    return result;
+}
+
+TemplateValue RangeFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto start = IntegerArgument(evaluator, arguments, 0);
+    const auto count = IntegerArgument(evaluator, arguments, 1);
+    if (count < 0)
+    {
+        ThrowTemplateError("range expects a count that isn't negative");
+    }
+
+    Json::Value result(Json::arrayValue);
+    for (Json::Int64 i = 0; i < count; ++i)
+    {
+        result.append(start + i);
+    }
+    return result;
+}
+
+TemplateValue SortBy(TemplateEvaluator& evaluator, const Arguments& arguments, bool isDescending)
+{
+    const auto items = evaluator.Evaluate(*arguments[0]);
+    const auto& array = ArrayOf(items, "sortBy");
+    const auto property = arguments.size() > 1 ? StringArgument(evaluator, arguments, 1) : std::string();
+
+    std::vector<const Json::Value*> sorted;
+    for (const auto& item : array)
+    {
+        sorted.push_back(&item);
+    }
+
+    const auto key = [&](const Json::Value* item) -> const Json::Value& {
+        if (property.empty())
+        {
+            return *item;
+        }
+        const auto* value = FindProperty(*item, property);
+        return value ? *value : NullValue();
+    };
+    std::stable_sort(sorted.begin(), sorted.end(), [&](const Json::Value* first, const Json::Value* second) {
+        const auto comparison = isDescending ? Compare(key(second), key(first)) : Compare(key(first), key(second));
+        return comparison.value_or(0) < 0;
+    });
+
+    Json::Value result(Json::arrayValue);
+    for (const auto* item : sorted)
+    {
+        result.append(*item);
+    }
+    return result;
+}
+
+TemplateValue SortByFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    return SortBy(evaluator, arguments, false);
+}
+
+TemplateValue SortByDescendingFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    return SortBy(evaluator, arguments, true);
+}
+
+// Logical and comparison functions
+
+bool IsTrueArgument(TemplateEvaluator& evaluator, const Arguments& arguments, size_t index)
+{
+    return IsTrue(evaluator.Evaluate(*arguments[index]));
+}
+
+TemplateValue IfFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    return evaluator.Evaluate(*arguments[IsTrueArgument(evaluator, arguments, 0) ? 1 : 2]);
+}
+
+TemplateValue AndFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    for (size_t i = 0; i < arguments.size(); ++i)
+    {
+        if (!IsTrueArgument(evaluator, arguments, i))
+        {
+            return Json::Value(false);
+        }
+    }
+    return Json::Value(true);
+}
+
+TemplateValue OrFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    for (size_t i = 0; i < arguments.size(); ++i)
+    {
+        if (IsTrueArgument(evaluator, arguments, i))
+        {
+            return Json::Value(true);
+        }
+    }
+    return Json::Value(false);
+}
+
+TemplateValue NotFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    return Json::Value(!IsTrueArgument(evaluator, arguments, 0));
+}
+
+TemplateValue EqualsFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    return Json::Value(AreEqual(evaluator.Evaluate(*arguments[0]).Get(), evaluator.Evaluate(*arguments[1]).Get()));
+}
+
+template <bool (*Test)(int)>
+TemplateValue CompareFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto first = evaluator.Evaluate(*arguments[0]);
+    const auto second = evaluator.Evaluate(*arguments[1]);
+    const auto comparison = Compare(first.Get(), second.Get());
+    if (!comparison.has_value())
+    {
+        ThrowTemplateError(
+            "Can't compare " + TemplateValueToString(first.Get()) + " and " + TemplateValueToString(second.Get()));
+    }
+    return Json::Value(Test(*comparison));
+}
+
+bool IsGreater(int comparison)
+{
+    return comparison > 0;
+}
+
+bool IsGreaterOrEqual(int comparison)
+{
+    return comparison >= 0;
+}
+
+bool IsLess(int comparison)
+{
+    return comparison < 0;
+}
+
+bool IsLessOrEqual(int comparison)
+{
+    return comparison <= 0;
+}
+
+TemplateValue ExistsFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto value = evaluator.Evaluate(*arguments[0]);
+    return Json::Value(!value.IsUndefined() && !value.Get().isNull());
+}
+
+TemplateValue CoalesceFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    for (const auto& argument : arguments)
+    {
+        auto value = evaluator.Evaluate(*argument);
+        if (!value.IsUndefined() && !value.Get().isNull())
+        {
+            return value;
+        }
+    }
+    return Json::Value();
+}
+
+template <bool (*Test)(const Json::Value&)>
+TemplateValue TypeFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    return Json::Value(Test(evaluator.Evaluate(*arguments[0]).Get()));
+}
+
+bool IsStringValue(const Json::Value& value)
+{
+    return value.isString();
+}
+
+bool IsIntegerValue(const Json::Value& value)
+{
+    return IsNumber(value) && std::floor(value.asDouble()) == value.asDouble();
+}
+
+bool IsFloatValue(const Json::Value& value)
+{
+    return IsNumber(value) && !IsIntegerValue(value);
+}
+
+bool IsArrayValue(const Json::Value& value)
+{
+    return value.isArray();
+}
+
+bool IsObjectValue(const Json::Value& value)
+{
+    return value.isObject();
+}
+
+bool IsBooleanValue(const Json::Value& value)
+{
+    return value.isBool();
+}
+
+// Conversion functions
+
+TemplateValue IntFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto value = evaluator.Evaluate(*arguments[0]);
+    const auto& json = value.Get();
+    if (IsNumber(json))
+    {
+        return Json::Value(static_cast<Json::Int64>(json.asDouble()));
+    }
+
+    const auto text = TemplateValueToString(json);
+    Json::Int64 result = 0;
+    const auto parsed = std::from_chars(text.data(), text.data() + text.size(), result);
+    if (text.empty() || parsed.ec != std::errc() || parsed.ptr != text.data() + text.size())
+    {
+        ThrowTemplateError(text + " is not an integer");
+    }
+    return Json::Value(result);
+}
+
+TemplateValue FloatFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto value = evaluator.Evaluate(*arguments[0]);
+    const auto& json = value.Get();
+    if (IsNumber(json))
+    {
+        return Json::Value(json.asDouble());
+    }
+
+    const auto text = TemplateValueToString(json);
+    char* end = nullptr;
+    const double result = std::strtod(text.c_str(), &end);
+    if (text.empty() || end != text.c_str() + text.size())
+    {
+        ThrowTemplateError(text + " is not a number");
+    }
+    return MakeNumber(result);
+}
+
+TemplateValue BoolFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto value = evaluator.Evaluate(*arguments[0]);
+    const auto& json = value.Get();
+    if (json.isString())
+    {
+        return Json::Value(json.asString() == "true");
+    }
+    if (IsNumber(json))
+    {
+        return Json::Value(json.asDouble() != 0);
+    }
+    return Json::Value(IsTrue(value));
+}
+
+TemplateValue JsonFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto value = evaluator.Evaluate(*arguments[0]);
+    if (!value.Get().isString())
+    {
+        return Json::Value(value.Get());
+    }
+    return ParseUtil::GetJsonValueFromString(value.Get().asString());
+}
+
+TemplateValue FormatNumberFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const double value = NumberArgument(evaluator, arguments, 0);
+    const auto precision = IntegerArgument(evaluator, arguments, 1);
+    if (precision < 0 || precision > 20)
+    {
+        ThrowTemplateError("formatNumber expects a precision between 0 and 20");
+    }
+
+    char buffer[400];
+    std::snprintf(buffer, sizeof(buffer), "%.*f", static_cast<int>(precision), std::fabs(value));
+    std::string digits(buffer);
+    const auto point = std::min(digits.find('.'), digits.size());
+
+    // digits grouped in thousands, as en-US writes numbers
+    std::string result = value < 0 && digits.find_first_not_of("0.") != std::string::npos ? "-" : "";
+    for (size_t i = 0; i < point; ++i)
+    {
+        if (i > 0 && (point - i) % 3 == 0)
+        {
+            result += ',';
+        }
+        result += digits[i];
+    }
+    return Json::Value(result + digits.substr(point));
+}
+
+// Math functions
+
+TemplateValue ArithmeticFunction(TemplateEvaluator& evaluator, const Arguments& arguments, TemplateOperator op)
+{
+    auto result = evaluator.Evaluate(*arguments[0]).Release();
+    for (size_t i = 1; i < arguments.size(); ++i)
+    {
+        result = Arithmetic(op, result, evaluator.Evaluate(*arguments[i]).Get());
+    }
+    return result;
+}
+
+TemplateValue AddFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    return ArithmeticFunction(evaluator, arguments, TemplateOperator::Add);
+}
+
+TemplateValue SubFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    return ArithmeticFunction(evaluator, arguments, TemplateOperator::Subtract);
+}
+
+TemplateValue MulFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    return ArithmeticFunction(evaluator, arguments, TemplateOperator::Multiply);
+}
+
+TemplateValue DivFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    return ArithmeticFunction(evaluator, arguments, TemplateOperator::Divide);
+}
+
+TemplateValue ModFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    return ArithmeticFunction(evaluator, arguments, TemplateOperator::Modulo);
+}
+
+TemplateValue ExpFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    return ArithmeticFunction(evaluator, arguments, TemplateOperator::Power);
+}
+
+TemplateValue Extreme(TemplateEvaluator& evaluator, const Arguments& arguments, bool isMax)
+{
+    const auto values = ValuesArgument(evaluator, arguments);
+    if (values.empty())
+    {
+        ThrowTemplateError(std::string(isMax ? "max" : "min") + " expects at least one number");
+    }
+
+    const Json::Value* result = nullptr;
+    for (const auto& value : values)
+    {
+        ToDouble(value);
+        if (result == nullptr || Compare(value, *result).value_or(0) == (isMax ? 1 : -1))
+        {
+            result = &value;
+        }
+    }
+    return *result;
+}
+
+TemplateValue MinFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    return Extreme(evaluator, arguments, false);
+}
+
+TemplateValue MaxFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    return Extreme(evaluator, arguments, true);
+}
+
+TemplateValue SumFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto values = ValuesArgument(evaluator, arguments);
+    Json::Value result(Json::Int64{0});
+    for (const auto& value : values)
+    {
+        ToDouble(value);
+        result = Arithmetic(TemplateOperator::Add, result, value);
+    }
+    return result;
+}
+
+TemplateValue AverageFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto values = ValuesArgument(evaluator, arguments);
+    if (values.empty())
+    {
+        ThrowTemplateError("average expects at least one number");
+    }
+
+    double sum = 0;
+    for (const auto& value : values)
+    {
+        sum += ToDouble(value);
+    }
+    return MakeNumber(sum / values.size());
+}
+
+TemplateValue RoundFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const double value = NumberArgument(evaluator, arguments, 0);
+    const auto digits = arguments.size() > 1 ? IntegerArgument(evaluator, arguments, 1) : 0;
+    if (digits < 0 || digits > 15)
+    {
+        ThrowTemplateError("round expects a number of digits between 0 and 15");
+    }
+    const double scale = std::pow(10.0, static_cast<double>(digits));
+    return MakeNumber(std::round(value * scale) / scale);
+}
+
+TemplateValue FloorFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    return MakeNumber(std::floor(NumberArgument(evaluator, arguments, 0)));
+}
+
+TemplateValue CeilingFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    return MakeNumber(std::ceil(NumberArgument(evaluator, arguments, 0)));
+}
+
+TemplateValue AbsFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto value = evaluator.Evaluate(*arguments[0]);
+    if (IsIntegral(value.Get()))
+    {
+        return Json::Value(std::abs(value.Get().asInt64()));
+    }
+    return MakeNumber(std::fabs(ToDouble(value.Get())));
+}
+
+// Lambda functions, which evaluate their last argument for each item of a collection, with the item bound to the
+// name given by their second
+
+template <typename Visit>
+void ForEachItem(TemplateEvaluator& evaluator, const Arguments& arguments, const char* function, Visit visit)
+{
+    if (arguments[1]->GetKind() != TemplateExpressionKind::Identifier)
+    {
+        ThrowTemplateError(std::string(function) + " expects the name of an iterator");
+    }
+    const auto& name = arguments[1]->GetName();
+
+    const auto collection = evaluator.Evaluate(*arguments[0]);
+    const auto& json = collection.Get();
+    if (json.isArray())
+    {
+        for (const auto& item : json)
+        {
+            if (!visit(item, evaluator.EvaluateWith(*arguments[2], name, item)))
+            {
+                return;
+            }
+        }
+    }
+    else if (json.isObject())
+    {
+        // an object is iterated as its properties, each as {"key": name, "value": value}
+        for (auto it = json.begin(); it != json.end(); ++it)
+        {
+            Json::Value item(Json::objectValue);
+            item["key"] = it.name();
+            item["value"] = *it;
+            if (!visit(item, evaluator.EvaluateWith(*arguments[2], name, item)))
+            {
+                return;
+            }
+        }
+    }
+    else if (!collection.IsUndefined() && !json.isNull())
+    {
+        ThrowTemplateError(std::string(function) + " expects an array or an object");
+    }
+}
+
+TemplateValue SelectFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    Json::Value result(Json::arrayValue);
+    ForEachItem(evaluator, arguments, "select", [&](const Json::Value&, TemplateValue value) {
+        result.append(value.Release());
+        return true;
+    });
+    return result;
+}
+
+TemplateValue WhereFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    Json::Value result(Json::arrayValue);
+    ForEachItem(evaluator, arguments, "where", [&](const Json::Value& item, TemplateValue condition) {
+        if (IsTrue(condition))
+        {
+            result.append(item);
+        }
+        return true;
+    });
+    return result;
+}
+
+TemplateValue AnyFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    bool result = false;
+    ForEachItem(evaluator, arguments, "any", [&](const Json::Value&, TemplateValue condition) {
+        result = IsTrue(condition);
+        return !result;
+    });
+    return Json::Value(result);
+}
+
+TemplateValue AllFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    bool result = true;
+    ForEachItem(evaluator, arguments, "all", [&](const Json::Value&, TemplateValue condition) {
+        result = IsTrue(condition);
+        return result;
+    });
+    return Json::Value(result);
+}
+
+TemplateValue GetPropertyFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    auto object = evaluator.Evaluate(*arguments[0]);
+    const auto* value = FindProperty(object.Get(), StringArgument(evaluator, arguments, 1));
+    if (value == nullptr)
+    {
+        return TemplateValue();
+    }
+    return object.IsReference() ? TemplateValue::Reference(*value) : TemplateValue(*value);
+}
+
+// Date and time functions. Times are kept as milliseconds since the Unix epoch, in UTC; a time written without an
+// offset is taken to be in UTC.
+
+constexpr Json::Int64 c_millisecondsPerDay = 86400000;
+
+Json::Int64 DaysFromCivil(Json::Int64 year, unsigned int month, unsigned int day)
+{
+    year -= month <= 2;
+    const Json::Int64 era = (year >= 0 ? year : year - 399) / 400;
+    const auto yearOfEra = static_cast<unsigned int>(year - era * 400);
+    const unsigned int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const unsigned int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + static_cast<Json::Int64>(dayOfEra) - 719468;
+}
+
+struct CivilTime
+{
+    Json::Int64 year;
+    unsigned int month;
+    unsigned int day;
+    unsigned int hour;
+    unsigned int minute;
+    unsigned int second;
+    unsigned int millisecond;
+    unsigned int dayOfWeek; // 0 for Sunday
+    unsigned int dayOfYear; // 1 for January 1
+};
+
+CivilTime ToCivil(Json::Int64 time)
+{
+    Json::Int64 days = time / c_millisecondsPerDay;
+    Json::Int64 milliseconds = time % c_millisecondsPerDay;
+    if (milliseconds < 0)
+    {
+        milliseconds += c_millisecondsPerDay;
+        --days;
+    }
+
+    CivilTime civil{};
+    civil.dayOfWeek = static_cast<unsigned int>(days >= -4 ? (days + 4) % 7 : (days + 5) % 7 + 6);
+    const Json::Int64 shifted = days + 719468;
+    const Json::Int64 era = (shifted >= 0 ? shifted : shifted - 146096) / 146097;
+    const auto dayOfEra = static_cast<unsigned int>(shifted - era * 146097);
+    const unsigned int yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    const unsigned int dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    const unsigned int monthIndex = (5 * dayOfYear + 2) / 153;
+    civil.day = dayOfYear - (153 * monthIndex + 2) / 5 + 1;
+    civil.month = monthIndex < 10 ? monthIndex + 3 : monthIndex - 9;
+    civil.year = static_cast<Json::Int64>(yearOfEra) + era * 400 + (civil.month <= 2);
+    civil.dayOfYear = static_cast<unsigned int>(days - DaysFromCivil(civil.year, 1, 1) + 1);
+    civil.hour = static_cast<unsigned int>(milliseconds / 3600000);
+    civil.minute = static_cast<unsigned int>(milliseconds / 60000 % 60);
+    civil.second = static_cast<unsigned int>(milliseconds / 1000 % 60);
+    civil.millisecond = static_cast<unsigned int>(milliseconds % 1000);
+    return civil;
+}
+
+// Reads the digits at position (at least one, at most maxDigits)
+std::optional<unsigned int> ReadDigits(std::string_view text, size_t& position, size_t maxDigits)
+{
+    unsigned int value = 0;
+    size_t count = 0;
+    while (position < text.size() && count < maxDigits && std::isdigit(static_cast<unsigned char>(text[position])))
+    {
+        value = value * 10 + (text[position++] - '0');
+        ++count;
+    }
+    return count > 0 ? std::optional<unsigned int>(value) : std::nullopt;
+}
+
+// ISO 8601 (2018-03-15, 2018-03-15T12:00:00.000Z, 2018-03-15T12:00:00+02:00), or as en-US writes dates
+// (03/15/2018, 03/15/2018 12:00:00, 3/15/2018 1:00 PM)
+Json::Int64 ParseTimestamp(const std::string& text)
+{
+    const auto fail = [&]() { ThrowTemplateError(text + " is not a valid timestamp"); };
+
+    size_t position = 0;
+    std::optional<unsigned int> year, month, day;
+    const bool isIso = text.size() > 4 && text[4] == '-';
+    if (isIso)
+    {
+        year = ReadDigits(text, position, 4);
+        month = ++position < text.size() ? ReadDigits(text, position, 2) : std::nullopt;
+        day = position < text.size() && text[position++] == '-' ? ReadDigits(text, position, 2) : std::nullopt;
+    }
+    else
+    {
+        month = ReadDigits(text, position, 2);
+        day = position < text.size() && text[position++] == '/' ? ReadDigits(text, position, 2) : std::nullopt;
+        year = position < text.size() && text[position++] == '/' ? ReadDigits(text, position, 4) : std::nullopt;
+    }
+    if (!year || !month || !day || *month < 1 || *month > 12 || *day < 1 || *day > 31)
+    {
+        fail();
+    }
+
+    unsigned int hour = 0, minute = 0, second = 0, millisecond = 0;
+    Json::Int64 offset = 0;
+    if (position < text.size())
+    {
+        if (text[position] != (isIso ? 'T' : ' ') && text[position] != ' ')
+        {
+            fail();
+        }
+        ++position;
+
+        const auto readHour = ReadDigits(text, position, 2);
+        const auto readMinute =
+            position < text.size() && text[position++] == ':' ? ReadDigits(text, position, 2) : std::nullopt;
+        if (!readHour || !readMinute)
+        {
+            fail();
+        }
+        hour = *readHour;
+        minute = *readMinute;
+
+        if (position < text.size() && text[position] == ':')
+        {
+            ++position;
+            const auto readSecond = ReadDigits(text, position, 2);
+            if (!readSecond)
+            {
+                fail();
+            }
+            second = *readSecond;
+        }
+        if (position < text.size() && text[position] == '.')
+        {
+            ++position;
+            const size_t start = position;
+            const auto fraction = ReadDigits(text, position, 9);
+            if (!fraction)
+            {
+                fail();
+            }
+            millisecond = static_cast<unsigned int>(*fraction * std::pow(10.0, 3.0 - (position - start)));
+        }
+
+        if (!isIso && position < text.size())
+        {
+            const auto marker = text.substr(position);
+            if ((marker != " AM" && marker != " PM") || hour < 1 || hour > 12)
+            {
+                fail();
+            }
+            hour = hour % 12 + (marker == " PM" ? 12 : 0);
+            position = text.size();
+        }
+        else if (position < text.size() && text[position] == 'Z')
+        {
+            ++position;
+        }
+        else if (position < text.size() && (text[position] == '+' || text[position] == '-'))
+        {
+            const bool isNegative = text[position++] == '-';
+            const auto offsetHours = ReadDigits(text, position, 2);
+            if (position < text.size() && text[position] == ':')
+            {
+                ++position;
+            }
+            const auto offsetMinutes = ReadDigits(text, position, 2);
+            if (!offsetHours || !offsetMinutes)
+            {
+                fail();
+            }
+            offset = (*offsetHours * 60 + *offsetMinutes) * Json::Int64{60000} * (isNegative ? -1 : 1);
+        }
+    }
+    if (position != text.size() || hour > 23 || minute > 59 || second > 59)
+    {
+        fail();
+    }
+
+    return DaysFromCivil(*year, *month, *day) * c_millisecondsPerDay +
+           ((hour * 60 + minute) * 60 + second) * Json::Int64{1000} + millisecond - offset;
+}
+
+// Formats time with a .NET custom date and time format string (yyyy-MM-ddTHH:mm:ss.fffZ, dddd, MMMM d, yyyy, ...)
+std::string FormatTimestamp(Json::Int64 time, const std::string& format)
+{
+    static const char* const monthNames[] = {"January", "February", "March", "April", "May", "June", "July",
+                                             "August", "September", "October", "November", "December"};
+    static const char* const dayNames[] = {
+        "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
+
+    const auto civil = ToCivil(time);
+    const auto pad = [](Json::Int64 value, size_t width) {
+        auto text = std::to_string(value);
+        return text.size() < width ? std::string(width - text.size(), '0') + text : text;
+    };
+
+    std::string result;
+    for (size_t i = 0; i < format.size();)
+    {
+        const char c = format[i];
+        size_t count = 1;
+        while (i + count < format.size() && format[i + count] == c)
+        {
+            ++count;
+        }
+
+        switch (c)
+        {
+        case 'y':
+            result += count == 2 ? pad(civil.year % 100, 2) : pad(civil.year, count);
+            break;
+        case 'M':
+            result += count >= 4 ? monthNames[civil.month - 1] :
+                                   count == 3 ? std::string(monthNames[civil.month - 1], 3) : pad(civil.month, count);
+            break;
+        case 'd':
+            result += count >= 4 ? dayNames[civil.dayOfWeek] :
+                                   count == 3 ? std::string(dayNames[civil.dayOfWeek], 3) : pad(civil.day, count);
+            break;
+        case 'H':
+            result += pad(civil.hour, std::min<size_t>(count, 2));
+            break;
+        case 'h':
+            result += pad(civil.hour % 12 == 0 ? 12 : civil.hour % 12, std::min<size_t>(count, 2));
+            break;
+        case 'm':
+            result += pad(civil.minute, std::min<size_t>(count, 2));
+            break;
+        case 's':
+            result += pad(civil.second, std::min<size_t>(count, 2));
+            break;
+        case 'f':
+        case 'F':
+        {
+            auto fraction = pad(civil.millisecond, 3) + "0000";
+            fraction.resize(std::min<size_t>(count, 7));
+            if (c == 'F')
+            {
+                fraction.erase(fraction.find_last_not_of('0') + 1);
+            }
+            result += fraction;
+            break;
+        }
+        case 't':
+            result += std::string(civil.hour < 12 ? "AM" : "PM").substr(0, count == 1 ? 1 : 2);
+            break;
+        case 'K':
+            result += 'Z';
+            break;
+        case 'z':
+            result += count == 1 ? "+0" : (count == 2 ? "+00" : "+00:00");
+            break;
+        case '\'':
+        case '"':
+        {
+            const auto end = format.find(c, i + 1);
+            result += format.substr(i + 1, end == std::string::npos ? std::string::npos : end - i - 1);
+            i = end == std::string::npos ? format.size() : end + 1;
+            continue;
+        }
+        case '\\':
+            if (i + 1 < format.size())
+            {
+                result += format[i + 1];
+            }
+            i += 2;
+            continue;
+        default:
+            result.append(count, c);
+            break;
+        }
+        i += count;
+    }
+    return result;
+}
+
+constexpr const char* c_defaultTimestampFormat = "yyyy-MM-ddTHH:mm:ss.fffZ";
+
+std::string FormatArgument(TemplateEvaluator& evaluator, const Arguments& arguments, size_t index)
+{
+    return arguments.size() > index ? StringArgument(evaluator, arguments, index) : c_defaultTimestampFormat;
+}
+
+Json::Int64 TimestampArgument(TemplateEvaluator& evaluator, const Arguments& arguments, size_t index)
+{
+    return ParseTimestamp(StringArgument(evaluator, arguments, index));
+}
+
+TemplateValue FormatDateTimeFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    return Json::Value(
+        FormatTimestamp(TimestampArgument(evaluator, arguments, 0), FormatArgument(evaluator, arguments, 1)));
+}
+
+TemplateValue FormatEpochFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto seconds = NumberArgument(evaluator, arguments, 0);
+    return Json::Value(
+        FormatTimestamp(static_cast<Json::Int64>(seconds * 1000), FormatArgument(evaluator, arguments, 1)));
+}
+
+TemplateValue UtcNowFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto now =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch());
+    return Json::Value(FormatTimestamp(now.count(), FormatArgument(evaluator, arguments, 0)));
+}
+
+template <Json::Int64 Milliseconds>
+TemplateValue AddTimeFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    const auto time = TimestampArgument(evaluator, arguments, 0);
+    const auto amount = NumberArgument(evaluator, arguments, 1);
+    return Json::Value(FormatTimestamp(
+        time + static_cast<Json::Int64>(amount * Milliseconds), FormatArgument(evaluator, arguments, 2)));
+}
+
+template <unsigned int CivilTime::*Field>
+TemplateValue DatePartFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    return Json::Value(static_cast<Json::Int64>(ToCivil(TimestampArgument(evaluator, arguments, 0)).*Field));
+}
+
+TemplateValue YearFunction(TemplateEvaluator& evaluator, const Arguments& arguments)
+{
+    return Json::Value(ToCivil(TimestampArgument(evaluator, arguments, 0)).year);
+}
+
+constexpr size_t c_anyNumberOfArguments = std::numeric_limits<size_t>::max();
+
+// Sorted by name
+const TemplateFunction c_templateFunctions[] = {
+    {"abs", 1, 1, AbsFunction},
+    {"add", 2, c_anyNumberOfArguments, AddFunction},
+    {"addDays", 2, 3, AddTimeFunction<c_millisecondsPerDay>},
+    {"addHours", 2, 3, AddTimeFunction<3600000>},
+    {"addMinutes", 2, 3, AddTimeFunction<60000>},
+    {"addSeconds", 2, 3, AddTimeFunction<1000>},
+    {"all", 3, 3, AllFunction},
+    {"and", 1, c_anyNumberOfArguments, AndFunction},
+    {"any", 3, 3, AnyFunction},
+    {"average", 1, c_anyNumberOfArguments, AverageFunction},
+    {"bool", 1, 1, BoolFunction},
+    {"ceiling", 1, 1, CeilingFunction},
+    {"coalesce", 1, c_anyNumberOfArguments, CoalesceFunction},
+    {"concat", 1, c_anyNumberOfArguments, ConcatFunction},
+    {"contains", 2, 2, ContainsFunction},
+    {"count", 1, 1, LengthFunction},
+    {"createArray", 0, c_anyNumberOfArguments, CreateArrayFunction},
+    {"dayOfMonth", 1, 1, DatePartFunction<&CivilTime::day>},
+    {"dayOfWeek", 1, 1, DatePartFunction<&CivilTime::dayOfWeek>},
+    {"dayOfYear", 1, 1, DatePartFunction<&CivilTime::dayOfYear>},
+    {"div", 2, c_anyNumberOfArguments, DivFunction},
+    {"empty", 1, 1, EmptyFunction},
+    {"endsWith", 2, 2, EndsWithFunction},
+    {"equals", 2, 2, EqualsFunction},
+    {"exists", 1, 1, ExistsFunction},
+    {"exp", 2, 2, ExpFunction},
+    {"filter", 3, 3, WhereFunction},
+    {"first", 1, 1, FirstFunction},
+    {"float", 1, 1, FloatFunction},
+    {"floor", 1, 1, FloorFunction},
+    {"foreach", 3, 3, SelectFunction},
+    {"formatDateTime", 1, 2, FormatDateTimeFunction},
+    {"formatEpoch", 1, 2, FormatEpochFunction},
+    {"formatNumber", 2, 2, FormatNumberFunction},
+    {"getProperty", 2, 2, GetPropertyFunction},
+    {"greater", 2, 2, CompareFunction<IsGreater>},
+    {"greaterOrEquals", 2, 2, CompareFunction<IsGreaterOrEqual>},
+    {"if", 3, 3, IfFunction},
+    {"indexOf", 2, 2, IndexOfFunction},
+    {"indicesAndValues", 1, 1, IndicesAndValuesFunction},
+    {"int", 1, 1, IntFunction},
+    {"isArray", 1, 1, TypeFunction<IsArrayValue>},
+    {"isBoolean", 1, 1, TypeFunction<IsBooleanValue>},
+    {"isFloat", 1, 1, TypeFunction<IsFloatValue>},
+    {"isInteger", 1, 1, TypeFunction<IsIntegerValue>},
+    {"isObject", 1, 1, TypeFunction<IsObjectValue>},
+    {"isString", 1, 1, TypeFunction<IsStringValue>},
+    {"join", 2, 3, JoinFunction},
+    {"json", 1, 1, JsonFunction},
+    {"last", 1, 1, LastFunction},
+    {"lastIndexOf", 2, 2, LastIndexOfFunction},
+    {"length", 1, 1, LengthFunction},
+    {"less", 2, 2, CompareFunction<IsLess>},
+    {"lessOrEquals", 2, 2, CompareFunction<IsLessOrEqual>},
+    {"max", 1, c_anyNumberOfArguments, MaxFunction},
+    {"min", 1, c_anyNumberOfArguments, MinFunction},
+    {"mod", 2, 2, ModFunction},
+    {"month", 1, 1, DatePartFunction<&CivilTime::month>},
+    {"mul", 2, c_anyNumberOfArguments, MulFunction},
+    {"not", 1, 1, NotFunction},
+    {"or", 1, c_anyNumberOfArguments, OrFunction},
+    {"range", 2, 2, RangeFunction},
+    {"replace", 3, 3, ReplaceFunction},
+    {"reverse", 1, 1, ReverseFunction},
+    {"round", 1, 2, RoundFunction},
+    {"select", 3, 3, SelectFunction},
+    {"skip", 2, 2, SkipFunction},
+    {"sortBy", 1, 2, SortByFunction},
+    {"sortByDescending", 1, 2, SortByDescendingFunction},
+    {"split", 2, 2, SplitFunction},
+    {"startsWith", 2, 2, StartsWithFunction},
+    {"string", 1, 1, StringFunction},
+    {"sub", 2, c_anyNumberOfArguments, SubFunction},
+    {"subArray", 2, 3, SubArrayFunction},
+    {"substring", 2, 3, SubstringFunction},
+    {"sum", 1, c_anyNumberOfArguments, SumFunction},
+    {"take", 2, 2, TakeFunction},
+    {"toLower", 1, 1, ToLowerFunction},
+    {"toUpper", 1, 1, ToUpperFunction},
+    {"trim", 1, 1, TrimFunction},
+    {"utcNow", 0, 1, UtcNowFunction},
+    {"where", 3, 3, WhereFunction},
+    {"year", 1, 1, YearFunction},
+};
+
+const TemplateFunction* FindTemplateFunction(const std::string& name)
+{
+    const auto end = std::end(c_templateFunctions);
+    const auto found = std::lower_bound(
+        std::begin(c_templateFunctions), end, name, [](const TemplateFunction& function, const std::string& name) {
+            return std::strcmp(function.name, name.c_str()) < 0;
+        });
+    return found != end && name == found->name ? found : nullptr;
+}
+
+// The end of the expression that starts at position (just past its "${"): the "}" that closes it, skipping braces
+// and strings inside of it
+size_t FindExpressionEnd(const std::string& value, size_t position)
+{
+    int depth = 0;
+    while (position < value.size())
+    {
+        const char c = value[position];
+        if (c == '\'' || c == '"')
+        {
+            position = SkipQuoted(value, position);
+            continue;
+        }
+        if (c == '}' && depth-- == 0)
+        {
+            return position;
+        }
+        depth += c == '{';
+        ++position;
+    }
+    return std::string::npos;
+}
+
+bool IsPath(const TemplateExpression& expression)
+{
+    const auto kind = expression.GetKind();
+    return kind == TemplateExpressionKind::Identifier || kind == TemplateExpressionKind::Member ||
+           kind == TemplateExpressionKind::Index;
+}
+} // namespace
+
+std::unique_ptr<TemplateExpression> TemplateExpressionParser::ParseCall(const std::string& name)
+{
+    Expect("(");
+    auto node = MakeNode(TemplateExpressionKind::Call);
+    node->m_name = name;
+    while (!IsSymbol(")"))
+    {
+        node->m_children.push_back(ParseBinary(0));
+        if (!IsSymbol(")"))
+        {
+            Expect(",");
+        }
+    }
+    Advance();
+
+    node->m_function = FindTemplateFunction(name);
+    const auto count = node->m_children.size();
+    if (node->m_function != nullptr &&
+        (count < node->m_function->minArguments || count > node->m_function->maxArguments))
+    {
+        Fail("wrong number of arguments to " + name);
+    }
+    return node;
+}
+
+std::unique_ptr<TemplateExpression> TemplateExpressionParser::Fold(std::unique_ptr<TemplateExpression> expression)
+{
+    switch (expression->m_kind)
+    {
+    case TemplateExpressionKind::Not:
+    case TemplateExpressionKind::Negate:
+    case TemplateExpressionKind::Binary:
+    case TemplateExpressionKind::Array:
+    case TemplateExpressionKind::Object:
+        break;
+    case TemplateExpressionKind::Call:
+        // utcNow is the one function whose value isn't decided by its arguments
+        if (expression->m_function == nullptr || expression->m_name == "utcNow")
+        {
+            return expression;
+        }
+        break;
+    default:
+        // paths aren't folded, even of constants: a path to a property that's missing is left as written
+        return expression;
+    }
+
+    const auto& children = expression->m_children;
+    if (!std::all_of(children.cbegin(), children.cend(), [](const std::unique_ptr<TemplateExpression>& child) {
+            return child->m_kind == TemplateExpressionKind::Constant;
+        }))
+    {
+        return expression;
+    }
+
+    try
+    {
+        static const Json::Value noData;
+        const TemplateScope scope{&noData, nullptr, nullptr, std::nullopt};
+        TemplateEvaluator evaluator(scope);
+        auto value = evaluator.Evaluate(*expression);
+        if (value.IsUndefined())
+        {
+            return expression;
+        }
+
+        auto constant = MakeNode(TemplateExpressionKind::Constant);
+        constant->m_constant = value.Release();
+        constant->m_text = std::move(expression->m_text);
+        return constant;
+    }
+    catch (const AdaptiveCardParseException&)
+    {
+        // fails again when it's evaluated, and is then left as written
+        return expression;
+    }
+    catch (const Json::Exception&)
+    {
+        return expression;
+    }
+}
+
+std::unique_ptr<TemplateExpression> TemplateExpression::Parse(std::string_view text)
+{
+    return TemplateExpressionParser(text).ParseAll();
+}
+
+TemplateEvaluator::TemplateEvaluator(const TemplateScope& scope) : m_scope(scope)
+{
+}
+
+TemplateValue TemplateEvaluator::Evaluate(const TemplateExpression& expression)
+{
+    const auto& children = expression.GetChildren();
+    switch (expression.GetKind())
+    {
+    case TemplateExpressionKind::Constant:
+        return TemplateValue::Reference(expression.GetConstant());
+    case TemplateExpressionKind::Identifier:
+        return EvaluateIdentifier(expression.GetName());
+    case TemplateExpressionKind::Member:
+    case TemplateExpressionKind::Index:
+        return EvaluatePath(expression);
+    case TemplateExpressionKind::Not:
+        return Json::Value(!IsTrue(Evaluate(*children[0])));
+    case TemplateExpressionKind::Negate:
+    {
+        const auto operand = Evaluate(*children[0]);
+        if (IsIntegral(operand.Get()))
+        {
+            return Json::Value(-operand.Get().asInt64());
+        }
+        return MakeNumber(-ToDouble(operand.Get()));
+    }
+    case TemplateExpressionKind::Binary:
+        return EvaluateBinary(expression);
+    case TemplateExpressionKind::Call:
+        if (expression.GetFunction() == nullptr)
+        {
+            ThrowTemplateError(expression.GetName() + " is not a function");
+        }
+        return expression.GetFunction()->evaluate(*this, children);
+    case TemplateExpressionKind::Array:
+    {
+        Json::Value result(Json::arrayValue);
+        for (const auto& child : children)
+        {
+            result.append(Evaluate(*child).Release());
+        }
+        return result;
+    }
+    case TemplateExpressionKind::Object:
+    {
+        Json::Value result(Json::objectValue);
+        for (size_t i = 0; i < children.size(); ++i)
+        {
+            auto value = Evaluate(*children[i]);
+            if (!value.IsUndefined())
+            {
+                result[expression.GetKeys()[i]] = value.Release();
+            }
+        }
+        return result;
+    }
+    default:
+        ThrowTemplateError("Unknown expression");
+    }
+}
+
+TemplateValue TemplateEvaluator::EvaluateWith(
+    const TemplateExpression& expression, std::string_view name, const Json::Value& value)
+{
+    m_locals.emplace_back(name, &value);
+    try
+    {
+        auto result = Evaluate(expression);
+        m_locals.pop_back();
+        // the value may be one that only lives while the lambda function iterates
+        return result.IsReference() ? TemplateValue(result.Release()) : std::move(result);
+    }
+    catch (...)
+    {
+        m_locals.pop_back();
+        throw;
+    }
+}
+
+TemplateValue TemplateEvaluator::EvaluatePath(const TemplateExpression& expression)
+{
+    const auto& children = expression.GetChildren();
+    auto object = Evaluate(*children[0]);
+    const auto& json = object.Get();
+
+    const Json::Value* found = nullptr;
+    if (expression.GetKind() == TemplateExpressionKind::Member)
+    {
+        found = FindProperty(json, expression.GetName());
+    }
+    else
+    {
+        const auto index = Evaluate(*children[1]);
+        if (json.isArray() && IsIntegral(index.Get()))
+        {
+            const auto i = index.Get().asInt64();
+            found =
+                i >= 0 && i < static_cast<Json::Int64>(json.size()) ? &json[static_cast<Json::ArrayIndex>(i)] : nullptr;
+        }
+        else if (json.isObject() && index.Get().isString())
+        {
+            found = FindProperty(json, index.Get().asString());
+        }
+    }
+
+    if (found == nullptr)
+    {
+        return TemplateValue();
+    }
+    return object.IsReference() ? TemplateValue::Reference(*found) : TemplateValue(*found);
+}
+
+TemplateValue TemplateEvaluator::EvaluateIdentifier(const std::string& name)
+{
+    for (auto local = m_locals.crbegin(); local != m_locals.crend(); ++local)
+    {
+        if (local->first == name)
+        {
+            return TemplateValue::Reference(*local->second);
+        }
+    }
+
+    const auto& data = m_scope.data ? *m_scope.data : *m_scope.root;
+    if (name[0] == '$')
+    {
+        if (name == "$root")
+        {
+            return TemplateValue::Reference(*m_scope.root);
+        }
+        if (name == "$data")
+        {
+            return TemplateValue::Reference(data);
+        }
+        if (name == "$host")
+        {
+            return m_scope.host ? TemplateValue::Reference(*m_scope.host) : TemplateValue();
+        }
+        if (name == "$index")
+        {
+            return m_scope.index.has_value() ? TemplateValue(Json::Value(*m_scope.index)) : TemplateValue();
+        }
+    }
+
+    const auto* found = FindProperty(data, name);
+    return found ? TemplateValue::Reference(*found) : TemplateValue();
+}
+
+TemplateValue TemplateEvaluator::EvaluateBinary(const TemplateExpression& expression)
+{
+    const auto& children = expression.GetChildren();
+    const auto op = expression.GetOperator();
+    if (op == TemplateOperator::And || op == TemplateOperator::Or)
+    {
+        const bool first = IsTrue(Evaluate(*children[0]));
+        if (first == (op == TemplateOperator::Or))
+        {
+            return Json::Value(first);
+        }
+        return Json::Value(IsTrue(Evaluate(*children[1])));
+    }
+
+    const auto first = Evaluate(*children[0]);
+    const auto second = Evaluate(*children[1]);
+    switch (op)
+    {
+    case TemplateOperator::Concatenate:
+        return Json::Value(TemplateValueToString(first.Get()) + TemplateValueToString(second.Get()));
+    case TemplateOperator::Equal:
+        return Json::Value(AreEqual(first.Get(), second.Get()));
+    case TemplateOperator::NotEqual:
+        return Json::Value(!AreEqual(first.Get(), second.Get()));
+    case TemplateOperator::Less:
+    case TemplateOperator::LessOrEqual:
+    case TemplateOperator::Greater:
+    case TemplateOperator::GreaterOrEqual:
+    {
+        const auto comparison = Compare(first.Get(), second.Get());
+        if (!comparison.has_value())
+        {
+            return Json::Value(false);
+        }
+        switch (op)
+        {
+        case TemplateOperator::Less:
+            return Json::Value(*comparison < 0);
+        case TemplateOperator::LessOrEqual:
+            return Json::Value(*comparison <= 0);
+        case TemplateOperator::Greater:
+            return Json::Value(*comparison > 0);
+        default:
+            return Json::Value(*comparison >= 0);
+        }
+    }
+    default:
+        return Arithmetic(op, first.Get(), second.Get());
+    }
+}
+
+std::optional<TemplateString> TemplateString::Parse(const std::string& value)
+{
+    auto start = value.find("${");
+    if (start == std::string::npos)
+    {
+        return std::nullopt;
+    }
+
+    TemplateString result;
+    size_t literalStart = 0;
+    while (start != std::string::npos)
+    {
+        const auto end = FindExpressionEnd(value, start + 2);
+        if (end == std::string::npos)
+        {
+            break;
+        }
+
+        if (start > literalStart)
+        {
+            result.m_parts.push_back({value.substr(literalStart, start - literalStart), nullptr, false});
+        }
+
+        Part part{value.substr(start + 2, end - start - 2), nullptr, true};
+        try
+        {
+            part.expression = TemplateExpression::Parse(part.text);
+        }
+        catch (const AdaptiveCardParseException&)
+        {
+            // kept as written
+        }
+        result.m_parts.push_back(std::move(part));
+
+        literalStart = end + 1;
+        start = value.find("${", literalStart);
+    }
+
+    if (literalStart < value.size())
+    {
+        result.m_parts.push_back({value.substr(literalStart), nullptr, false});
+    }
+    return result;
+}
+
+TemplateValue TemplateString::EvaluatePart(const Part& part, const TemplateScope& scope)
+{
+    if (part.expression != nullptr)
+    {
+        try
+        {
+            TemplateEvaluator evaluator(scope);
+            auto value = evaluator.Evaluate(*part.expression);
+            // a property the data doesn't have is left as written, so that it can be bound later on
+            if (!value.IsUndefined() && !(value.Get().isNull() && IsPath(*part.expression)))
+            {
+                return value;
+            }
+        }
+        catch (const AdaptiveCardParseException&)
+        {
+        }
+        catch (const Json::Exception&)
+        {
+        }
+    }
+    return Json::Value("${" + part.text + "}");
+}
+
+TemplateValue TemplateString::Evaluate(const TemplateScope& scope) const
+{
+    if (m_parts.size() == 1 && m_parts[0].isExpression)
+    {
+        return EvaluatePart(m_parts[0], scope);
+    }
+
+    std::string result;
+    for (const auto& part : m_parts)
+    {
+        if (part.isExpression)
+        {
+            result += TemplateValueToString(EvaluatePart(part, scope).Get());
+        }
+        else
+        {
+            result += part.text;
+        }
+    }
+    return Json::Value(result);
+}
+
+TemplateValue TemplateString::EvaluateCondition(const TemplateScope& scope) const
+{
+    if (m_parts.size() != 1 || m_parts[0].expression == nullptr)
+    {
+        throw AdaptiveCardParseException(
+            ErrorStatusCode::InvalidPropertyValue, "$when is not a single valid expression");
+    }
+
+    TemplateEvaluator evaluator(scope);
+    return evaluator.Evaluate(*m_parts[0].expression);
+}
+
+const std::string& TemplateString::GetExpressionText() const
+{
+    return m_parts[0].text;
+}
+
+bool TemplateString::IsConstant() const
+{
+    return std::all_of(m_parts.cbegin(), m_parts.cend(), [](const Part& part) {
+        return part.expression == nullptr || part.expression->GetKind() == TemplateExpressionKind::Constant;
+    });
+}
+
+bool AdaptiveCards::IsTemplateKeyword(const std::string& name)
+{
+    return !name.empty() && name[0] == '$' &&
+           (name == "$data" || name == "$when" || name == "$root" || name == "$index" || name == "$host" ||
+            name == "$_acTemplateVersion");
+}
+
+bool AdaptiveCards::EvaluateTemplateCondition(const Json::Value& when,
+                                              const TemplateString* condition,
+                                              const TemplateScope& scope,
+                                              std::vector<std::string>* warnings)
+{
+    const auto addWarning = [warnings](std::string warning) {
+        if (warnings != nullptr)
+        {
+            warnings->push_back(std::move(warning));
+        }
+    };
+
+    if (condition != nullptr)
+    {
+        try
+        {
+            const auto value = condition->EvaluateCondition(scope);
+            if (value.IsUndefined())
+            {
+                addWarning("WARN: Could not evaluate " + when.asString() +
+                           " because it could not be found in the provided data. The condition has been set to false "
+                           "by default.");
+                return false;
+            }
+            return value.Get().isBool() && value.Get().asBool();
+        }
+        catch (const AdaptiveCardParseException&)
+        {
+        }
+        catch (const Json::Exception&)
+        {
+        }
+    }
+
+    addWarning("WARN: Could not evaluate \"" + TemplateValueToString(when) +
+               "\" because it is not an expression or the expression is invalid. The $when condition has been set to "
+               "false by default.");
+    return false;
+}
+
+std::string AdaptiveCards::TemplateValueToString(const Json::Value& value)
+{
+    switch (value.type())
+    {
+    case Json::nullValue:
+        return "";
+    case Json::stringValue:
+        return value.asString();
+    case Json::booleanValue:
+        return value.asBool() ? "true" : "false";
+    case Json::intValue:
+        return std::to_string(value.asInt64());
+    case Json::uintValue:
+        return std::to_string(value.asUInt64());
+    case Json::realValue:
+        break;
+    default:
+    {
+        std::string json;
+        ParseUtil::WriteJson(value, json);
+        return json;
+    }
+    }
+
+    // the shortest digits that read back as the same number, laid out as JavaScript's Number.prototype.toString does
+    const double number = value.asDouble();
+    if (std::isnan(number))
+    {
+        return "NaN";
+    }
+    if (std::isinf(number))
+    {
+        return number < 0 ? "-Infinity" : "Infinity";
+    }
+    if (number == 0)
+    {
+        return "0";
+    }
+
+    char buffer[32];
+    for (int precision = 1; precision <= 17; ++precision)
+    {
+        std::snprintf(buffer, sizeof(buffer), "%.*e", precision - 1, std::fabs(number));
+        if (std::strtod(buffer, nullptr) == std::fabs(number))
+        {
+            break;
+        }
+    }
+
+    std::string digits;
+    const char* c = buffer;
+    for (; *c != 'e'; ++c)
+    {
+        if (*c != '.')
+        {
+            digits += *c;
+        }
+    }
+    const int exponent = std::atoi(c + 1);
+    const int digitCount = static_cast<int>(digits.size());
+    const int point = exponent + 1;
+
+    std::string result = number < 0 ? "-" : "";
+    if (digitCount <= point && point <= 21)
+    {
+        result += digits + std::string(point - digitCount, '0');
+    }
+    else if (0 < point && point <= 21)
+    {
+        result += digits.substr(0, point) + "." + digits.substr(point);
+    }
+    else if (-6 < point && point <= 0)
+    {
+        result += "0." + std::string(-point, '0') + digits;
+    }
+    else
+    {
+        result += digits.substr(0, 1) + (digitCount > 1 ? "." + digits.substr(1) : "") + "e" +
+                  (exponent < 0 ? "-" : "+") + std::to_string(std::abs(exponent));
+    }
+    return result;
+}
@@ -0,0 +1,218 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveCards
+{
+// The value of a template expression: a value in the data (referred to rather than copied), a value computed by the
+// expression, or undefined (the data has no such property).
+class TemplateValue
+{
+public:
+    TemplateValue() : m_reference(nullptr), m_isUndefined(true) {}
+    TemplateValue(Json::Value value) : m_reference(nullptr), m_value(std::move(value)), m_isUndefined(false) {}
+
+    static TemplateValue Reference(const Json::Value& value)
+    {
+        TemplateValue result;
+        result.m_reference = &value;
+        result.m_isUndefined = false;
+        return result;
+    }
+
+    bool IsUndefined() const { return m_isUndefined; }
+    bool IsReference() const { return m_reference != nullptr; }
+
+    // A null value when undefined
+    const Json::Value& Get() const { return m_reference ? *m_reference : m_value; }
+
+    // Moves a computed value out; copies a referred to one
+    Json::Value Release() { return m_reference ? *m_reference : std::move(m_value); }
+
+private:
+    const Json::Value* m_reference;
+    Json::Value m_value;
+    bool m_isUndefined;
+};
+
+// What a template expression is evaluated against. $data is $root until a $data property changes it, and $index is
+// only set inside the repetitions of a $data array.
+struct TemplateScope
+{
+    const Json::Value* root;
+    const Json::Value* data;
+    const Json::Value* host;
+    std::optional<unsigned int> index;
+};
+
+enum class TemplateExpressionKind
+{
+    Constant,
+    Identifier,
+    Member,
+    Index,
+    Not,
+    Negate,
+    Binary,
+    Call,
+    Array,
+    Object
+};
+
+enum class TemplateOperator
+{
+    Power,
+    Multiply,
+    Divide,
+    Modulo,
+    Add,
+    Subtract,
+    Concatenate,
+    Less,
+    LessOrEqual,
+    Greater,
+    GreaterOrEqual,
+    Equal,
+    NotEqual,
+    And,
+    Or
+};
+
+class TemplateExpression;
+struct TemplateFunction;
+
+// Evaluates a call to a function of the expression language. The evaluator evaluates the arguments it's given, so
+// that functions such as if and select decide which arguments to evaluate and in what scope.
+class TemplateEvaluator
+{
+public:
+    explicit TemplateEvaluator(const TemplateScope& scope);
+
+    // Throws an AdaptiveCardParseException when the expression can't be evaluated (such as a call to a function the
+    // expression language doesn't have)
+    TemplateValue Evaluate(const TemplateExpression& expression);
+
+    // Binds name to value (as the iterator of select does) while evaluating expression
+    TemplateValue EvaluateWith(const TemplateExpression& expression, std::string_view name, const Json::Value& value);
+
+private:
+    TemplateValue EvaluatePath(const TemplateExpression& expression);
+    TemplateValue EvaluateIdentifier(const std::string& name);
+    TemplateValue EvaluateBinary(const TemplateExpression& expression);
+
+    const TemplateScope& m_scope;
+    // names bound by the lambda functions, innermost last
+    std::vector<std::pair<std::string_view, const Json::Value*>> m_locals;
+};
+
+// A node of a parsed template expression (the part of a template string between "${" and "}")
+class TemplateExpression
+{
+public:
+    // Throws an AdaptiveCardParseException when text isn't a valid expression
+    static std::unique_ptr<TemplateExpression> Parse(std::string_view text);
+
+    TemplateExpressionKind GetKind() const { return m_kind; }
+    TemplateOperator GetOperator() const { return m_operator; }
+
+    // The constant of a Constant; the name of an Identifier, Member, Call or of each child of an Object
+    const Json::Value& GetConstant() const { return m_constant; }
+    const std::string& GetName() const { return m_name; }
+    const std::vector<std::unique_ptr<TemplateExpression>>& GetChildren() const { return m_children; }
+    const std::vector<std::string>& GetKeys() const { return m_keys; }
+
+    // nullptr for a function the expression language doesn't have, which fails when it's evaluated
+    const TemplateFunction* GetFunction() const { return m_function; }
+
+    // The text of the expression, as written in the template
+    const std::string& GetText() const { return m_text; }
+
+private:
+    friend class TemplateExpressionParser;
+
+    TemplateExpression(TemplateExpressionKind kind) :
+        m_kind(kind), m_operator(TemplateOperator::Add), m_function(nullptr)
+    {
+    }
+
+    TemplateExpressionKind m_kind;
+    TemplateOperator m_operator;
+    Json::Value m_constant;
+    std::string m_name;
+    std::vector<std::unique_ptr<TemplateExpression>> m_children;
+    std::vector<std::string> m_keys;
+    const TemplateFunction* m_function;
+    std::string m_text;
+};
+
+struct TemplateFunction
+{
+    const char* name;
+    size_t minArguments;
+    size_t maxArguments;
+    TemplateValue (*evaluate)(
+        TemplateEvaluator& evaluator, const std::vector<std::unique_ptr<TemplateExpression>>& arguments);
+};
+
+// A template string, split into its literal text and its ${...} expressions
+class TemplateString
+{
+public:
+    // nullopt when value has no "${" in it
+    static std::optional<TemplateString> Parse(const std::string& value);
+
+    TemplateString(TemplateString&&) = default;
+    TemplateString& operator=(TemplateString&&) = default;
+    TemplateString(const TemplateString&) = delete;
+    TemplateString& operator=(const TemplateString&) = delete;
+
+    // A string that is a single expression evaluates to the value of that expression, of whatever type it is; any
+    // other evaluates to a string. An expression that can't be parsed or evaluated is left in the string as written.
+    // The value may refer to the data or to the constants of the string, and so must not outlive either.
+    TemplateValue Evaluate(const TemplateScope& scope) const;
+
+    // For $when, which doesn't substitute undefined properties. Throws an AdaptiveCardParseException when the
+    // string isn't a single valid expression.
+    TemplateValue EvaluateCondition(const TemplateScope& scope) const;
+
+    // The text between "${" and "}" of a string that is a single expression
+    const std::string& GetExpressionText() const;
+
+    // Whether the string evaluates to the same value whatever the data: its expressions are all constants (or can't
+    // be parsed)
+    bool IsConstant() const;
+
+private:
+    TemplateString() = default;
+
+    struct Part
+    {
+        std::string text;
+        // nullptr for literal text, and for an expression that couldn't be parsed (whose text is kept as written)
+        std::unique_ptr<TemplateExpression> expression;
+        bool isExpression;
+    };
+
+    static TemplateValue EvaluatePart(const Part& part, const TemplateScope& scope);
+
+    std::vector<Part> m_parts;
+};
+
+// Whether a property of a template object is one of the keywords of templating ($data, $when, $root, ...), which
+// aren't expanded into the card
+bool IsTemplateKeyword(const std::string& name);
+
+// Whether the object a $when belongs to is kept: only when its expression evaluates to true. Properties the data
+// doesn't have aren't substituted, so a $when that refers to one is false. condition is when parsed, or nullptr when
+// when isn't a template string. Adds a warning to warnings (unless it's nullptr) when when can't be evaluated.
+bool EvaluateTemplateCondition(const Json::Value& when,
+                               const TemplateString* condition,
+                               const TemplateScope& scope,
+                               std::vector<std::string>* warnings);
+
+// The text template strings use for a value: JSON for arrays and objects, and numbers written the way JavaScript
+// writes them
+std::string TemplateValueToString(const Json::Value& value);
+} // namespace AdaptiveCards
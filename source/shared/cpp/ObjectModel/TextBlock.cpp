@@ -29,23 +29,23 @@ Json::Value TextBlock::SerializeToJsonValue() const
 
     if (m_hAlignment.has_value())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment)] =
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::HorizontalAlignment)] =
             HorizontalAlignmentToString(m_hAlignment.value_or(HorizontalAlignment::Left));
     }
 
     if (m_maxLines != 0)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MaxLines)] = m_maxLines;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::MaxLines)] = m_maxLines;
     }
 
     if (m_wrap)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap)] = m_wrap;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Wrap)] = m_wrap;
     }
 
     if (m_textStyle.has_value())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style)] =
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Style)] =
             TextStyleToString(m_textStyle.value_or(TextStyle::Default));
     }
 
@@ -67,6 +67,11 @@ DateTimePreparser TextBlock::GetTextForDateParsing() const
     return m_textElementProperties->GetTextForDateParsing();
 }
 
+const TextFeatures& TextBlock::GetTextFeatures() const
+{
+    return m_textElementProperties->GetTextFeatures();
+}
+
 std::optional<TextStyle> TextBlock::GetStyle() const
 {
     return m_textStyle;
@@ -175,10 +180,10 @@ std::shared_ptr<BaseCardElement> TextBlockParser::Deserialize(ParseContext& cont
     textBlock->m_textElementProperties->Deserialize(context, json);
 
     textBlock->SetWrap(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Wrap, false));
-    textBlock->SetStyle(ParseUtil::GetOptionalEnumValue<TextStyle>(json, AdaptiveCardSchemaKey::Style, TextStyleFromString));
+    textBlock->SetStyle(ParseUtil::GetOptionalEnumValue<TextStyle>(json, AdaptiveCardSchemaKey::Style, TextStyleTryFromString));
     textBlock->SetMaxLines(ParseUtil::GetUInt(json, AdaptiveCardSchemaKey::MaxLines, 0));
     textBlock->SetHorizontalAlignment(ParseUtil::GetOptionalEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentFromString));
+        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignmentTryFromString));
 
     return textBlock;
 }
@@ -190,11 +195,15 @@ std::shared_ptr<BaseCardElement> TextBlockParser::DeserializeFromString(ParseCon
 
 void TextBlock::PopulateKnownPropertiesSet()
 {
-    m_textElementProperties->PopulateKnownPropertiesSet(m_knownProperties);
-
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MaxLines),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment)});
+    static const std::unordered_set<std::string> knownProperties = [this]() {
+        auto textBlockProperties = ExtendKnownProperties(
+            *m_knownProperties,
+            {AdaptiveCardSchemaKey::Wrap,
+             AdaptiveCardSchemaKey::Style,
+             AdaptiveCardSchemaKey::MaxLines,
+             AdaptiveCardSchemaKey::HorizontalAlignment});
+        m_textElementProperties->PopulateKnownPropertiesSet(textBlockProperties);
+        return textBlockProperties;
+    }();
+    m_knownProperties = &knownProperties;
 }
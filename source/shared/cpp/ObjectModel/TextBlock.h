@@ -29,6 +29,7 @@ public:
     std::string GetText() const;
     void SetText(const std::string& value);
     DateTimePreparser GetTextForDateParsing() const;
+    const TextFeatures& GetTextFeatures() const;
 
     std::optional<TextStyle> GetStyle() const;
     void SetStyle(const std::optional<TextStyle> value);
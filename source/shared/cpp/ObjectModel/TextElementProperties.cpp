@@ -12,13 +12,13 @@
 
 using namespace AdaptiveCards;
 
-TextElementProperties::TextElementProperties() : m_language()
+TextElementProperties::TextElementProperties() : m_textFeatures(), m_language()
 {
 }
 
 TextElementProperties::TextElementProperties(const TextStyleConfig& config, const std::string& text, const std::string& language) :
-    m_textSize(config.size), m_textWeight(config.weight), m_fontType(config.fontType), m_textColor(config.color),
-    m_isSubtle(config.isSubtle), m_language(language)
+    m_textFeatures(), m_textSize(config.size), m_textWeight(config.weight), m_fontType(config.fontType),
+    m_textColor(config.color), m_isSubtle(config.isSubtle), m_language(language)
 {
     SetText(text);
 }
@@ -27,34 +27,34 @@ Json::Value TextElementProperties::SerializeToJsonValue(Json::Value& root) const
 {
     if (m_textSize.has_value())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Size)] =
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Size)] =
             TextSizeToString(m_textSize.value_or(TextSize::Default));
     }
 
     if (m_textColor.has_value())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Color)] =
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Color)] =
             ForegroundColorToString(m_textColor.value_or(ForegroundColor::Default));
     }
 
     if (m_textWeight.has_value())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Weight)] =
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Weight)] =
             TextWeightToString(m_textWeight.value_or(TextWeight::Default));
     }
 
     if (m_fontType.has_value())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FontType)] =
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::FontType)] =
             FontTypeToString(m_fontType.value_or(FontType::Default));
     }
 
     if (m_isSubtle.has_value())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsSubtle)] = m_isSubtle.value_or(false);
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::IsSubtle)] = m_isSubtle.value_or(false);
     }
 
-    root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Text)] = GetText();
+    root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Text)] = GetText();
 
     return root;
 }
@@ -99,14 +99,30 @@ std::string TextElementProperties::_ProcessHTMLEntities(const std::string& input
     }
 }
 
+// The text is classified once here, for renderers to skip the processing it doesn't need. Most text has no '&' at all,
+// and even a regex_search that fails allocates its match state.
 void TextElementProperties::SetText(const std::string& value)
 {
-    m_text = _ProcessHTMLEntities(value);
+    m_textFeatures = TextFeatures::Classify(value);
+    if (m_textFeatures.mayHaveHtmlEntities)
+    {
+        m_text = _ProcessHTMLEntities(value);
+        m_textFeatures = TextFeatures::Classify(m_text);
+    }
+    else
+    {
+        m_text = value;
+    }
 }
 
 DateTimePreparser TextElementProperties::GetTextForDateParsing() const
 {
-    return DateTimePreparser(m_text);
+    return DateTimePreparser(m_text, m_textFeatures.mayHaveDateTokens);
+}
+
+const TextFeatures& TextElementProperties::GetTextFeatures() const
+{
+    return m_textFeatures;
 }
 
 std::optional<TextSize> TextElementProperties::GetTextSize() const
@@ -172,16 +188,16 @@ void TextElementProperties::SetLanguage(const std::string& value)
 void TextElementProperties::Deserialize(ParseContext& context, const Json::Value& json)
 {
     SetText(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Text, false));
-    if (GetText().empty())
+    if (m_text.empty())
     {
         context.warnings.emplace_back(std::make_shared<AdaptiveCardParseWarning>(
             WarningStatusCode::RequiredPropertyMissing, "required property, \"text\", is either empty or missing"));
     }
 
-    SetTextSize(ParseUtil::GetOptionalEnumValue<TextSize>(json, AdaptiveCardSchemaKey::Size, TextSizeFromString));
-    SetTextColor(ParseUtil::GetOptionalEnumValue<ForegroundColor>(json, AdaptiveCardSchemaKey::Color, ForegroundColorFromString));
-    SetTextWeight(ParseUtil::GetOptionalEnumValue<TextWeight>(json, AdaptiveCardSchemaKey::TextWeight, TextWeightFromString));
-    SetFontType(ParseUtil::GetOptionalEnumValue<FontType>(json, AdaptiveCardSchemaKey::FontType, FontTypeFromString));
+    SetTextSize(ParseUtil::GetOptionalEnumValue<TextSize>(json, AdaptiveCardSchemaKey::Size, TextSizeTryFromString));
+    SetTextColor(ParseUtil::GetOptionalEnumValue<ForegroundColor>(json, AdaptiveCardSchemaKey::Color, ForegroundColorTryFromString));
+    SetTextWeight(ParseUtil::GetOptionalEnumValue<TextWeight>(json, AdaptiveCardSchemaKey::TextWeight, TextWeightTryFromString));
+    SetFontType(ParseUtil::GetOptionalEnumValue<FontType>(json, AdaptiveCardSchemaKey::FontType, FontTypeTryFromString));
     SetIsSubtle(ParseUtil::GetOptionalBool(json, AdaptiveCardSchemaKey::IsSubtle));
     SetLanguage(context.GetLanguage());
 }
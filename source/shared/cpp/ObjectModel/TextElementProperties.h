@@ -7,6 +7,7 @@
 #include "ElementParserRegistration.h"
 #include "DateTimePreparser.h"
 #include "HostConfig.h"
+#include "TextFeatures.h"
 
 namespace AdaptiveCards
 {
@@ -26,6 +27,8 @@ public:
     std::string GetText() const;
     void SetText(const std::string& value);
     DateTimePreparser GetTextForDateParsing() const;
+    // what the text has in it that renderers process it for (markdown and dates), classified when it's set
+    const TextFeatures& GetTextFeatures() const;
 
     std::optional<TextSize> GetTextSize() const;
     void SetTextSize(const std::optional<TextSize> value);
@@ -52,6 +55,7 @@ private:
     static std::string _ProcessHTMLEntities(const std::string& input);
 
     std::string m_text;
+    TextFeatures m_textFeatures;
     std::optional<TextSize> m_textSize;
     std::optional<TextWeight> m_textWeight;
     std::optional<FontType> m_fontType;
@@ -0,0 +1,116 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "TextFeatures.h"
+#include <array>
+
+using namespace AdaptiveCards;
+
+namespace
+{
+enum CharacterClass : std::uint8_t
+{
+    // scanned as markdown (or its escape character) wherever it is
+    MarkDown = 0x01,
+    // ends a run of text, so that what follows it is scanned as the start of a block
+    BlockEnd = 0x02,
+    // starts a list, or an ordered list's number, at the start of a block
+    ListMarker = 0x04,
+    Digit = 0x08,
+    Ampersand = 0x10,
+    OpenBrace = 0x20,
+    HtmlCharacter = 0x40
+};
+
+constexpr std::array<std::uint8_t, 256> c_characterClasses = []() {
+    std::array<std::uint8_t, 256> classes{};
+    for (const unsigned char ch : {'*', '_', '[', '\n', '\r', '\\'})
+    {
+        classes[ch] |= MarkDown;
+    }
+    for (const unsigned char ch : {']', ')'})
+    {
+        classes[ch] |= BlockEnd;
+    }
+    for (const unsigned char ch : {'-', '+', '*'})
+    {
+        classes[ch] |= ListMarker;
+    }
+    for (unsigned char ch = '0'; ch <= '9'; ++ch)
+    {
+        classes[ch] |= Digit;
+    }
+    classes['&'] |= Ampersand;
+    classes['{'] |= OpenBrace;
+    for (const unsigned char ch : {'<', '>', '"', '&'})
+    {
+        classes[ch] |= HtmlCharacter;
+    }
+    return classes;
+}();
+
+std::uint8_t GetClass(char ch)
+{
+    return c_characterClasses[static_cast<unsigned char>(ch)];
+}
+
+// Whether a block starting at position starts a list: a list marker or a number and '.', followed by a space. A marker
+// that isn't followed by one is text, and what follows it starts a block in turn.
+bool IsListStart(std::string_view text, size_t position)
+{
+    while (position < text.size())
+    {
+        const auto markerStart = position;
+        while (position < text.size() && (GetClass(text[position]) & Digit) != 0)
+        {
+            ++position;
+        }
+
+        if (position == text.size())
+        {
+            return false;
+        }
+
+        const bool isNumber = (position != markerStart);
+        if ((isNumber && text[position] == '.') || (!isNumber && (GetClass(text[position]) & ListMarker) != 0))
+        {
+            ++position;
+            if (position < text.size() && text[position] == ' ')
+            {
+                return true;
+            }
+        }
+        else if (!isNumber)
+        {
+            return false;
+        }
+    }
+    return false;
+}
+} // namespace
+
+TextFeatures TextFeatures::Classify(std::string_view text)
+{
+    // the classes of all of the characters are gathered without branching, and only those that are found looked at.
+    // This is a table lookup per character, which compilers don't vectorise at -O2 (GCC does at -O3, by emulating the
+    // lookups); it's kept portable rather than given SSE2 and NEON versions.
+    std::uint8_t classes = 0;
+    for (const char ch : text)
+    {
+        classes |= GetClass(ch);
+    }
+
+    TextFeatures features{};
+    features.mayHaveMarkDown = (classes & MarkDown) != 0 || IsListStart(text, 0);
+    if (!features.mayHaveMarkDown && (classes & BlockEnd) != 0)
+    {
+        for (size_t i = 0; i < text.size() && !features.mayHaveMarkDown; ++i)
+        {
+            features.mayHaveMarkDown = (GetClass(text[i]) & BlockEnd) != 0 && IsListStart(text, i + 1);
+        }
+    }
+    features.mayHaveHtmlEntities = (classes & Ampersand) != 0;
+    features.mayHaveDateTokens = (classes & OpenBrace) != 0 && text.find("{{") != std::string_view::npos;
+    features.hasHtmlCharacters = (classes & HtmlCharacter) != 0;
+    return features;
+}
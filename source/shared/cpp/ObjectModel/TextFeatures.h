@@ -0,0 +1,26 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveCards
+{
+// What a text has in it that its processing depends on, found in one scan so that text with none of it (most text) can
+// skip that processing. A flag that's set means the text may need processing, not that it does.
+struct TextFeatures
+{
+    // emphasis, links, lists or new lines, which MarkDownParser writes as more than a paragraph of text
+    bool mayHaveMarkDown;
+    // an '&', which may start an HTML entity
+    bool mayHaveHtmlEntities;
+    // a "{{", which may start a DATE or TIME token
+    bool mayHaveDateTokens;
+    // '<', '>', '"' or '&', which are escaped when the text is written as HTML
+    bool hasHtmlCharacters;
+
+    bool IsPlainText() const { return !mayHaveMarkDown && !mayHaveHtmlEntities && !mayHaveDateTokens; }
+
+    static TextFeatures Classify(std::string_view text);
+};
+} // namespace AdaptiveCards
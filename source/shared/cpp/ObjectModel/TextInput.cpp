@@ -19,38 +19,38 @@ Json::Value TextInput::SerializeToJsonValue() const
 
     if (m_isMultiline)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsMultiline)] = m_isMultiline;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::IsMultiline)] = m_isMultiline;
     }
 
     if (m_maxLength != 0)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MaxLength)] = m_maxLength;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::MaxLength)] = m_maxLength;
     }
 
     if (!m_placeholder.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder)] = m_placeholder;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Placeholder)] = m_placeholder;
     }
 
     if (!m_value.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value)] = m_value;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Value)] = m_value;
     }
 
     if (m_style != TextInputStyle::Text)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style)] = TextInputStyleToString(m_style);
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Style)] = TextInputStyleToString(m_style);
     }
 
     if (m_inlineAction != nullptr)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::InlineAction)] =
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::InlineAction)] =
             BaseCardElement::SerializeSelectAction(m_inlineAction);
     }
 
     if (!m_regex.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Regex)] = m_regex;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Regex)] = m_regex;
     }
 
     return root;
@@ -139,7 +139,7 @@ std::shared_ptr<BaseCardElement> TextInputParser::Deserialize(ParseContext& cont
     textInput->SetIsMultiline(isMultiline);
 
     const auto textInputStyle =
-        ParseUtil::GetEnumValue<TextInputStyle>(json, AdaptiveCardSchemaKey::Style, TextInputStyle::Text, TextInputStyleFromString);
+        ParseUtil::GetEnumValue<TextInputStyle>(json, AdaptiveCardSchemaKey::Style, TextInputStyle::Text, TextInputStyleTryFromString);
     textInput->SetTextInputStyle(textInputStyle);
 
     // emit warning in the case where style is `password` but multiline is specified (this is an invalid combination.
@@ -163,10 +163,12 @@ std::shared_ptr<BaseCardElement> TextInputParser::DeserializeFromString(ParseCon
 
 void TextInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsMultiline),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MaxLength),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TextInput)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Placeholder,
+         AdaptiveCardSchemaKey::Value,
+         AdaptiveCardSchemaKey::IsMultiline,
+         AdaptiveCardSchemaKey::MaxLength,
+         AdaptiveCardSchemaKey::TextInput});
+    m_knownProperties = &knownProperties;
 }
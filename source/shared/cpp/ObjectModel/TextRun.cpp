@@ -14,23 +14,28 @@ TextRun::TextRun() :
 
 void TextRun::PopulateKnownPropertiesSet()
 {
-    m_textElementProperties->PopulateKnownPropertiesSet(m_knownProperties);
+    static const std::unordered_set<std::string> knownProperties = [this]() {
+        auto textRunProperties = *m_knownProperties;
+        m_textElementProperties->PopulateKnownPropertiesSet(textRunProperties);
+        return textRunProperties;
+    }();
+    m_knownProperties = &knownProperties;
 }
 
 Json::Value TextRun::SerializeToJsonValue() const
 {
     Json::Value root{};
     root = m_textElementProperties->SerializeToJsonValue(root);
-    root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = GetInlineTypeString();
+    root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Type)] = GetInlineTypeString();
 
     if (m_highlight)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Highlight)] = true;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Highlight)] = true;
     }
 
     if (m_selectAction != nullptr)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction)] = m_selectAction->SerializeToJsonValue();
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::SelectAction)] = m_selectAction->SerializeToJsonValue();
     }
 
     return root;
@@ -51,6 +56,11 @@ DateTimePreparser TextRun::GetTextForDateParsing() const
     return m_textElementProperties->GetTextForDateParsing();
 }
 
+const TextFeatures& TextRun::GetTextFeatures() const
+{
+    return m_textElementProperties->GetTextFeatures();
+}
+
 std::optional<TextSize> TextRun::GetTextSize() const
 {
     return m_textElementProperties->GetTextSize();
@@ -163,7 +173,7 @@ void TextRun::SetUnderline(const bool value)
 
 std::shared_ptr<Inline> TextRun::Deserialize(ParseContext& context, const Json::Value& json)
 {
-    std::shared_ptr<TextRun> inlineTextRun = std::make_shared<TextRun>();
+    std::shared_ptr<TextRun> inlineTextRun = MakeSharedInArena<TextRun>(context.GetArena());
 
     if (json.isString())
     {
@@ -178,7 +188,7 @@ std::shared_ptr<Inline> TextRun::Deserialize(ParseContext& context, const Json::
         inlineTextRun->SetUnderline(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Underline, false));
         inlineTextRun->SetSelectAction(ParseUtil::GetAction(context, json, AdaptiveCardSchemaKey::SelectAction, false));
 
-        HandleUnknownProperties(json, inlineTextRun->m_knownProperties, inlineTextRun->m_additionalProperties);
+        HandleUnknownProperties(json, *inlineTextRun->m_knownProperties, inlineTextRun->m_additionalProperties);
     }
 
     return inlineTextRun;
@@ -26,6 +26,7 @@ public:
     std::string GetText() const;
     void SetText(const std::string& value);
     DateTimePreparser GetTextForDateParsing() const;
+    const TextFeatures& GetTextFeatures() const;
 
     std::optional<TextSize> GetTextSize() const;
     void SetTextSize(const std::optional<TextSize> value);
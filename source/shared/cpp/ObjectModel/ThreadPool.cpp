@@ -0,0 +1,115 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ThreadPool.h"
+
+using namespace AdaptiveCards;
+
+namespace
+{
+// The pool whose items the current thread is running, if any
+thread_local const ThreadPool* t_runningPool = nullptr;
+} // namespace
+
+ThreadPool::ThreadPool(unsigned int threadCount) :
+    m_fn(nullptr), m_count(0), m_next(0), m_generation(0), m_busyWorkers(0), m_isStopping(false)
+{
+    const unsigned int workerCount = threadCount > 1 ? threadCount - 1 : 0;
+    m_workers.reserve(workerCount);
+    try
+    {
+        for (unsigned int i = 0; i < workerCount; ++i)
+        {
+            m_workers.emplace_back([this]() { Work(); });
+        }
+    }
+    catch (const std::system_error&)
+    {
+        // out of threads: make do with the workers already started
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+    }
+    m_workAvailable.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+unsigned int ThreadPool::GetThreadCount() const
+{
+    return static_cast<unsigned int>(m_workers.size()) + 1;
+}
+
+void ThreadPool::ParallelFor(size_t count, const std::function<void(size_t)>& fn)
+{
+    if (count < 2 || m_workers.empty() || t_runningPool == this)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            fn(i);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> runLock(m_runMutex);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_fn = &fn;
+        m_count = count;
+        m_next = 0;
+        m_busyWorkers = m_workers.size();
+        ++m_generation;
+    }
+    m_workAvailable.notify_all();
+
+    RunItems();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_workDone.wait(lock, [this]() { return m_busyWorkers == 0; });
+    m_fn = nullptr;
+}
+
+void ThreadPool::Work()
+{
+    std::uint64_t generation = 0;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_workAvailable.wait(lock, [&]() { return m_isStopping || m_generation != generation; });
+        if (m_isStopping)
+        {
+            return;
+        }
+
+        generation = m_generation;
+        lock.unlock();
+        RunItems();
+        lock.lock();
+
+        if (--m_busyWorkers == 0)
+        {
+            m_workDone.notify_one();
+        }
+    }
+}
+
+// m_fn and m_count don't change until every worker is done with them
+void ThreadPool::RunItems()
+{
+    const auto runningPool = t_runningPool;
+    t_runningPool = this;
+    for (size_t i = m_next++; i < m_count; i = m_next++)
+    {
+        (*m_fn)(i);
+    }
+    t_runningPool = runningPool;
+}
@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include <condition_variable>
+
+namespace AdaptiveCards
+{
+// Worker threads that are started once, when the pool is built, and reused by every ParallelFor call on it until the
+// pool is destroyed.
+class ThreadPool
+{
+public:
+    // threadCount counts the thread that calls ParallelFor, so threadCount - 1 workers are started. If the system
+    // can't start that many, the pool keeps those it could start, down to none.
+    explicit ThreadPool(unsigned int threadCount);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // The workers plus the calling thread
+    unsigned int GetThreadCount() const;
+
+    // Calls fn(i) for every i in [0, count) on the calling thread and the workers, returning once every call has
+    // returned. Every thread claims the next i from one shared cursor, rather than being handed a fixed slice up front,
+    // so a thread that draws a few expensive items doesn't leave the others idle while it finishes. fn must not throw.
+    //
+    // The workers run one ParallelFor at a time: a call made from another thread while they're busy waits for them to
+    // finish the call before, then runs on them. A call made from fn, which would wait on itself, runs on its calling
+    // thread alone. So fn mustn't call ParallelFor on another pool whose items call back into this one.
+    void ParallelFor(size_t count, const std::function<void(size_t)>& fn);
+
+private:
+    void Work();
+    void RunItems();
+
+    std::vector<std::thread> m_workers;
+
+    // Held for the whole of a ParallelFor that runs on the workers, so that the next waits for it
+    std::mutex m_runMutex;
+
+    // The ParallelFor the workers are running, guarded by m_mutex apart from m_next
+    std::mutex m_mutex;
+    std::condition_variable m_workAvailable;
+    std::condition_variable m_workDone;
+    const std::function<void(size_t)>* m_fn;
+    size_t m_count;
+    std::atomic<size_t> m_next;
+    // Counts the ParallelFor calls the workers have been woken for, so that each worker joins each call once
+    std::uint64_t m_generation;
+    size_t m_busyWorkers;
+    bool m_isStopping;
+};
+} // namespace AdaptiveCards
@@ -17,26 +17,26 @@ Json::Value ToggleInput::SerializeToJsonValue() const
 {
     Json::Value root = BaseInputElement::SerializeToJsonValue();
 
-    root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title)] = GetTitle();
+    root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Title)] = GetTitle();
 
     if (m_wrap)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap)] = m_wrap;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Wrap)] = m_wrap;
     }
 
     if (!m_value.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value)] = m_value;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Value)] = m_value;
     }
 
     if (m_valueOff != "false")
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ValueOff)] = m_valueOff;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::ValueOff)] = m_valueOff;
     }
 
     if (m_valueOn != "true")
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ValueOn)] = m_valueOn;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::ValueOn)] = m_valueOn;
     }
 
     return root;
@@ -113,10 +113,12 @@ std::shared_ptr<BaseCardElement> ToggleInputParser::DeserializeFromString(ParseC
 
 void ToggleInput::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert(
-        {AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ValueOn),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ValueOff),
-         AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::Title,
+         AdaptiveCardSchemaKey::Value,
+         AdaptiveCardSchemaKey::ValueOn,
+         AdaptiveCardSchemaKey::ValueOff,
+         AdaptiveCardSchemaKey::Wrap});
+    m_knownProperties = &knownProperties;
 }
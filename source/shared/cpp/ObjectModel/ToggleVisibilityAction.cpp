@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "ParseUtil.h"
 #include "ToggleVisibilityAction.h"
+#include "Util.h"
 
 using namespace AdaptiveCards;
 
@@ -25,7 +26,7 @@ Json::Value ToggleVisibilityAction::SerializeToJsonValue() const
 {
     Json::Value root = BaseActionElement::SerializeToJsonValue();
 
-    const std::string& targetElementsPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TargetElements);
+    const Json::StaticString& targetElementsPropertyName = AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::TargetElements);
     root[targetElementsPropertyName] = Json::Value(Json::arrayValue);
     for (const auto& targetElement : GetTargetElements())
     {
@@ -53,5 +54,8 @@ std::shared_ptr<BaseActionElement> ToggleVisibilityActionParser::DeserializeFrom
 
 void ToggleVisibilityAction::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TargetElements)});
+    static const std::unordered_set<std::string> knownProperties = ExtendKnownProperties(
+        *m_knownProperties,
+        {AdaptiveCardSchemaKey::TargetElements});
+    m_knownProperties = &knownProperties;
 }
@@ -42,10 +42,10 @@ std::shared_ptr<ToggleVisibilityTarget> ToggleVisibilityTarget::Deserialize(Pars
     {
         toggleVisibilityTargetElement->SetElementId(ParseUtil::GetString(json, AdaptiveCardSchemaKey::ElementId, true));
 
-        auto propertyValue = json.get(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsVisible), Json::Value());
-        if (!propertyValue.empty())
+        const Json::Value* propertyValue = ParseUtil::FindJsonValue(json, AdaptiveCardSchemaKey::IsVisible);
+        if (propertyValue != nullptr && !propertyValue->empty())
         {
-            if (!propertyValue.isBool())
+            if (!propertyValue->isBool())
             {
                 throw AdaptiveCardParseException(
                     ErrorStatusCode::InvalidPropertyValue,
@@ -53,7 +53,7 @@ std::shared_ptr<ToggleVisibilityTarget> ToggleVisibilityTarget::Deserialize(Pars
                         " was invalid. Expected type bool.");
             }
 
-            toggleVisibilityTargetElement->SetIsVisible(propertyValue.asBool() ? IsVisibleTrue : IsVisibleFalse);
+            toggleVisibilityTargetElement->SetIsVisible(propertyValue->asBool() ? IsVisibleTrue : IsVisibleFalse);
         }
     }
 
@@ -82,8 +82,8 @@ Json::Value ToggleVisibilityTarget::SerializeToJsonValue()
     {
         // For true and false targets return a json object with a "targetId" and "isVisible" properties
         Json::Value root;
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ElementId)] = GetElementId();
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsVisible)] = (visibilityToggle == IsVisibleTrue);
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::ElementId)] = GetElementId();
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::IsVisible)] = (visibilityToggle == IsVisibleTrue);
         return root;
     }
 }
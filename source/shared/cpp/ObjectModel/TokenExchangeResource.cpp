@@ -68,17 +68,17 @@ Json::Value TokenExchangeResource::SerializeToJsonValue() const
 
     if (!m_id.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Id)] = m_id;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Id)] = m_id;
     }
 
     if (!m_uri.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Uri)] = m_uri;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::Uri)] = m_uri;
     }
 
     if (!m_providerId.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ProviderId)] = m_providerId;
+        root[AdaptiveCardSchemaKeyToJsonKey(AdaptiveCardSchemaKey::ProviderId)] = m_providerId;
     }
 
     return root;
@@ -48,41 +48,31 @@ std::string ValidateColor(const std::string& backgroundColor, std::vector<std::s
     return validBackgroundColor;
 }
 
+// pattern is expected to capture the integral part of the dimension as its first group
 void ValidateUserInputForDimensionWithUnit(
-    const std::string& unit,
+    const std::regex& pattern,
     const std::string& requestedDimension,
     std::optional<int>& parsedDimension,
     std::vector<std::shared_ptr<AdaptiveCardParseWarning>>* warnings)
 {
     constexpr auto warningMessage =
         "expected input argument to be specified as \\d+(\\.\\d+)?px with no spaces, but received ";
-    std::string stringPattern = "^([1-9]+\\d*)(\\.\\d+)?";
-    stringPattern += ("(" + unit + ")$");
-    std::regex pattern(stringPattern);
     std::smatch matches;
 
     if (std::regex_search(requestedDimension, matches, pattern))
     {
-        try
+        // matches[1] is the integral part of the dimension
+        int dimension = 0;
+        const auto result = std::from_chars(&*matches[1].first, &*matches[1].first + matches[1].length(), dimension);
+        if (result.ec == std::errc())
         {
-            // stoi will get integral value upto non digit char indexed by idx
-            parsedDimension = std::stoi(matches[0]);
+            parsedDimension = dimension;
         }
-        catch (const std::invalid_argument&)
+        else if (warnings)
         {
-            if (warnings)
-            {
-                warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(
-                    WarningStatusCode::InvalidDimensionSpecified, warningMessage + requestedDimension));
-            }
-        }
-        catch (const std::out_of_range&)
-        {
-            if (warnings)
-            {
-                warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(
-                    WarningStatusCode::InvalidDimensionSpecified, "out of range: " + requestedDimension));
-            }
+            warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(
+                WarningStatusCode::InvalidDimensionSpecified,
+                (result.ec == std::errc::result_out_of_range) ? "out of range: " + requestedDimension : warningMessage + requestedDimension));
         }
     }
     else
@@ -128,8 +118,9 @@ std::optional<int> ParseSizeForPixelSize(const std::string& sizeString, std::vec
     std::optional<int> parsedSize{};
     if (ShouldParseForExplicitDimension(sizeString))
     {
-        const std::string unit = "px";
-        ValidateUserInputForDimensionWithUnit(unit, sizeString, parsedSize, warnings);
+        // compiled once; building a std::regex allocates far more than matching with one
+        static const std::regex pixelPattern(R"regex(^([1-9]+\d*)(\.\d+)?(px)$)regex");
+        ValidateUserInputForDimensionWithUnit(pixelPattern, sizeString, parsedSize, warnings);
     }
     return parsedSize;
 }
@@ -140,11 +131,7 @@ void EnsureShowCardVersions(const std::vector<std::shared_ptr<BaseActionElement>
     {
         if (action->GetElementType() == ActionType::ShowCard)
         {
-            auto showCardAction = std::static_pointer_cast<ShowCardAction>(action);
-            if (showCardAction->GetCard()->GetVersion().empty())
-            {
-                showCardAction->GetCard()->SetVersion(version);
-            }
+            std::static_pointer_cast<ShowCardAction>(action)->SetVersion(version);
         }
     }
 }
@@ -160,3 +147,14 @@ void HandleUnknownProperties(const Json::Value& json, const std::unordered_set<s
         }
     }
 }
+
+std::unordered_set<std::string> ExtendKnownProperties(
+    const std::unordered_set<std::string>& knownProperties, std::initializer_list<AdaptiveCards::AdaptiveCardSchemaKey> keys)
+{
+    std::unordered_set<std::string> extendedProperties(knownProperties);
+    for (const auto key : keys)
+    {
+        extendedProperties.insert(AdaptiveCardSchemaKeyToString(key));
+    }
+    return extendedProperties;
+}
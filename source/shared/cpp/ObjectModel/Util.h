@@ -13,3 +13,8 @@ std::optional<int> ParseSizeForPixelSize(
 void EnsureShowCardVersions(const std::vector<std::shared_ptr<AdaptiveCards::BaseActionElement>>& actions, const std::string& version);
 
 void HandleUnknownProperties(const Json::Value& json, const std::unordered_set<std::string>& knownProperties, Json::Value& unknownProperties);
+
+// Builds a known-property table from an existing one plus the names of the given schema keys. Element types call this
+// once, from a function-local static, so every instance of a type shares the same table.
+std::unordered_set<std::string> ExtendKnownProperties(
+    const std::unordered_set<std::string>& knownProperties, std::initializer_list<AdaptiveCards::AdaptiveCardSchemaKey> keys);
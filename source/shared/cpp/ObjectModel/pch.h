@@ -3,19 +3,27 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <charconv>
 #include <exception>
 #include <fstream>
 #include <functional>
+#include <limits>
+#include <list>
 #include <locale>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <optional>
 #include <regex>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
+#include <variant>
 #include <vector>
 
 #if defined(_MSC_BUILD) && !defined(__ANDROID__) && !defined(__APPLE__)